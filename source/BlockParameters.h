@@ -0,0 +1,72 @@
+// The parameter step of ChronosProcessor::processBlock, outside the
+// processor so delay_functional_test runs the same code under its
+// real-time guard.
+#pragma once
+
+#ifndef CHRONOS_BLOCK_PARAMETERS_H
+#define CHRONOS_BLOCK_PARAMETERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "dsp/engine/delay/delay_engine.h"
+#include "dsp/engine/delay/param_event_scheduler.h"
+#include "PluginParameters.h"
+
+namespace Chronos
+{
+    struct AppliedParameters
+    {
+        int      numEvents = 0;     // this block's events, in the scheduler's events()
+        uint32_t dirty = 0;         // Param bits that moved since the last block
+        uint32_t retried = 0;       // of those, held back by an event and marked dirty again
+    };
+
+    // Audio thread, once per block before engine.process(). Collects the
+    // block's timestamped events, then pushes only the parameters that moved
+    // since the last block into the engine. One with events this block keeps
+    // the value the events leave behind, and its host value is retried next
+    // block.
+    template<std::size_t QueueCapacity, int MaxPending, int MaxDrainPerBlock>
+    AppliedParameters applyBlockParameters(ParameterBridge& params,
+                                           MarsDSP::DSP::ParamEventScheduler<QueueCapacity, MaxPending, MaxDrainPerBlock>& scheduler,
+                                           MarsDSP::DSP::DelayEngine<float>& engine,
+                                           const int64_t blockStart, const int numSamples) noexcept
+    {
+        AppliedParameters applied;
+        applied.numEvents = scheduler.collect(blockStart, numSamples);
+        const auto* events = scheduler.events();
+        uint32_t eventMask = 0;
+        for (int i = 0; i < applied.numEvents; ++i)
+            eventMask |= 1u << static_cast<int>(events[i].param);
+
+        const uint32_t dirty = params.poll();
+        applied.dirty = dirty;
+        for (int i = 0; i < kNumParams; ++i)
+        {
+            const auto& spec = kParamSpecs[static_cast<size_t>(i)];
+            if (spec.engine < 0 || (dirty & (1u << i)) == 0)
+                continue;
+            if ((eventMask & (1u << spec.engine)) != 0)
+                applied.retried |= 1u << i;
+            else
+                engine.setParam(static_cast<MarsDSP::DSP::EngineParam>(spec.engine), params.get(static_cast<Param>(i)));
+        }
+        params.markDirty(applied.retried);
+
+        if (dirty & ParameterBridge::bit(Param::ModShape))
+            engine.setModShape(static_cast<MarsDSP::DSP::LfoShape>(params.getChoice(Param::ModShape)));
+        if (dirty & (ParameterBridge::bit(Param::ModSync) | ParameterBridge::bit(Param::ModDivision)))
+            engine.setModSync(params.getBool(Param::ModSync),
+                              static_cast<MarsDSP::SyncDivision>(params.getChoice(Param::ModDivision)));
+        if (dirty & ParameterBridge::bit(Param::Mono))
+            engine.setMono(params.getBool(Param::Mono));
+        if (dirty & ParameterBridge::bit(Param::Bypass))
+            engine.setBypassed(params.getBool(Param::Bypass));
+        if (dirty & ParameterBridge::bit(Param::DelayMode))
+            engine.setDelayTimeMode(static_cast<MarsDSP::DSP::DelayTimeMode>(params.getChoice(Param::DelayMode)));
+        if (dirty & ParameterBridge::bit(Param::JumpFade))
+            engine.setJumpFadeMs(params.get(Param::JumpFade));
+        return applied;
+    }
+}
+#endif
@@ -5,20 +5,158 @@
 ChronosEditor::ChronosEditor (ChronosProcessor& p)
     : AudioProcessorEditor (&p), pref (p)
 {
-    ignoreUnused (pref);
-    setSize (400, 300);
+    addAndMakeVisible (controls);
+    spectrum.fill (kSpectrumFloorDb);
+
+    // whatever queued up while no editor was open is stale
+    MarsDSP::DSP::DelayTelemetry frame;
+    while (pref.popTelemetry (frame)) {}
+    pref.setTelemetryEnabled (true);
+    startTimerHz (kFrameRateHz);
+
+    setSize (jmax (400, controls.getWidth()), controls.getHeight() + kMeterHeight + kWaveformHeight + kSpectrumHeight);
 }
 
 ChronosEditor::~ChronosEditor()
 {
+    stopTimer();
+    pref.setTelemetryEnabled (false);
 }
 
 //==============================================================================
+void ChronosEditor::timerCallback()
+{
+    MarsDSP::DSP::DelayTelemetry frame;
+    bool any = false;
+    float peak[2] { shown.peak[0] * kPeakFallPerFrame, shown.peak[1] * kPeakFallPerFrame };
+    while (pref.popTelemetry (frame))
+    {
+        any = true;
+        peak[0] = jmax (peak[0], frame.peak[0]);
+        peak[1] = jmax (peak[1], frame.peak[1]);
+    }
+
+    // large host blocks can skip a frame; half a second with none means
+    // the host stopped calling processBlock
+    idleFrames = any ? 0 : idleFrames + 1;
+    if (any)
+        shown = frame;
+    else if (idleFrames > kFrameRateHz / 2)
+        shown.rms[0] = shown.rms[1] = shown.tailEnergy = 0.0f;
+    shown.peak[0] = peak[0];
+    shown.peak[1] = peak[1];
+
+    // O(width) whatever the zoom: the engine keeps a min/max pyramid
+    const int numSamples = roundToInt (kWaveformSeconds * pref.getSampleRate());
+    for (int ch = 0; ch < 2; ++ch)
+        pref.renderWaveform (ch, numSamples, waveform[ch].data(), static_cast<int> (waveform[ch].size()));
+    pref.readSpectrum (spectrum);
+    loadStats = pref.getLoadStats();
+    repaint (0, 0, getWidth(), kMeterHeight + kWaveformHeight + kSpectrumHeight);
+}
+
 void ChronosEditor::paint (Graphics& g)
 {
-    ignoreUnused (g);
+    g.fillAll (getLookAndFeel().findColour (ResizableWindow::backgroundColourId));
+
+    // -60..0 dBFS onto the bar length
+    auto toWidth = [] (float gain, int width) {
+        const float db = Decibels::gainToDecibels (gain, -60.0f);
+        return roundToInt (jmap (db, -60.0f, 0.0f, 0.0f, static_cast<float> (width)));
+    };
+
+    auto area = getLocalBounds().removeFromTop (kMeterHeight).reduced (8);
+    auto text = area.removeFromRight (170);
+    g.setFont (13.0f);
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        auto bar = area.removeFromTop (14);
+        area.removeFromTop (4);
+        g.setColour (Colours::black.withAlpha (0.4f));
+        g.fillRect (bar);
+        g.setColour (Colours::seagreen);
+        g.fillRect (bar.withWidth (toWidth (shown.rms[ch], bar.getWidth())));
+        g.setColour (shown.peak[ch] >= 1.0f ? Colours::red : Colours::lightgreen);
+        g.fillRect (bar.withX (bar.getX() + toWidth (shown.peak[ch], bar.getWidth())).withWidth (2));
+    }
+
+    // duck gain fills from the right as the ducker pulls the wet signal down
+    auto duck = area.removeFromTop (14);
+    g.setColour (Colours::black.withAlpha (0.4f));
+    g.fillRect (duck);
+    g.setColour (Colours::orange);
+    g.fillRect (duck.removeFromRight (roundToInt ((1.0f - shown.duckGain) * static_cast<float> (duck.getWidth()))));
+
+    g.setColour (Colours::white);
+    g.drawText ("L / R  peak + RMS", text.removeFromTop (18), Justification::centredLeft);
+    g.drawText ("Duck  " + String (Decibels::gainToDecibels (shown.duckGain, -60.0f), 1) + " dB",
+                text.removeFromTop (18), Justification::centredLeft);
+    g.drawText ("Time  " + String (shown.delayMs, 1) + " ms", text.removeFromTop (18), Justification::centredLeft);
+    g.drawText ("Tail  " + String (Decibels::gainToDecibels (std::sqrt (shown.tailEnergy), -90.0f), 1) + " dB",
+                text.removeFromTop (18), Justification::centredLeft);
+
+    // L above R, each column a min..max line
+    auto strip = getLocalBounds().withTrimmedTop (kMeterHeight).removeFromTop (kWaveformHeight).reduced (8, 4);
+    g.setColour (Colours::black.withAlpha (0.4f));
+    g.fillRect (strip);
+    g.setColour (Colours::skyblue);
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        const auto lane = strip.removeFromTop (strip.getHeight() / (2 - ch)).toFloat();
+        const float mid = lane.getCentreY(), half = lane.getHeight() * 0.5f;
+        const auto& columns = waveform[ch];
+        for (size_t x = 0; x < columns.size(); ++x)
+        {
+            const float top    = mid - half * jlimit (-1.0f, 1.0f, columns[x].max);
+            const float bottom = mid - half * jlimit (-1.0f, 1.0f, columns[x].min);
+            g.drawVerticalLine (static_cast<int> (lane.getX()) + static_cast<int> (x), top, jmax (bottom, top + 1.0f));
+        }
+    }
+
+    // kSpectrumFloorDb..0 dB, 20 Hz on the left
+    const auto plot = getLocalBounds().withTrimmedTop (kMeterHeight + kWaveformHeight)
+                                      .removeFromTop (kSpectrumHeight).reduced (8, 4).toFloat();
+    g.setColour (Colours::black.withAlpha (0.4f));
+    g.fillRect (plot);
+
+    Path curve;
+    const float bandWidth = plot.getWidth() / static_cast<float> (spectrum.size());
+    for (size_t b = 0; b < spectrum.size(); ++b)
+    {
+        const float x = plot.getX() + (static_cast<float> (b) + 0.5f) * bandWidth;
+        const float y = jmap (jlimit (kSpectrumFloorDb, 0.0f, spectrum[b]), kSpectrumFloorDb, 0.0f, plot.getBottom(), plot.getY());
+        if (b == 0)
+            curve.startNewSubPath (x, y);
+        else
+            curve.lineTo (x, y);
+    }
+    g.setColour (Colours::gold);
+    g.strokePath (curve, PathStrokeType (1.5f));
+
+    g.setColour (Colours::white.withAlpha (0.7f));
+    g.setFont (11.0f);
+    g.drawText ("Analyzer  " + String (100.0f * pref.getAnalyzerLoad(), 2) + " % CPU",
+                plot.reduced (4.0f, 2.0f), Justification::topRight);
+
+    // percent of the block's real-time budget
+    auto percent = [] (float load) { return String (100.0f * load, 1) + "%"; };
+    g.setColour (loadStats.overruns > 0 ? Colours::orangered : Colours::white.withAlpha (0.7f));
+    g.drawText ("DSP  p50 " + percent (loadStats.p50) + "  p99 " + percent (loadStats.p99)
+                    + "  p99.9 " + percent (loadStats.p999) + "  max " + percent (loadStats.max)
+                    + "  overruns " + String (loadStats.overruns),
+                plot.reduced (4.0f, 2.0f), Justification::topLeft);
+}
+
+void ChronosEditor::mouseDown (const MouseEvent& e)
+{
+    if (e.y >= kMeterHeight + kWaveformHeight && e.y < kMeterHeight + kWaveformHeight + kSpectrumHeight)
+        pref.resetLoadStats();
 }
 
 void ChronosEditor::resized()
 {
+    controls.setBounds (getLocalBounds().withTrimmedTop (kMeterHeight + kWaveformHeight + kSpectrumHeight));
+    for (auto& columns : waveform)
+        columns.assign (static_cast<size_t> (jmax (1, getWidth() - 16)), MarsDSP::DSP::WaveformColumn {});
 }
@@ -2,7 +2,8 @@
 
 #include "ChronosProcessor.h"
 //==============================================================================
-class ChronosEditor final : public AudioProcessorEditor
+class ChronosEditor final : public AudioProcessorEditor,
+                            private Timer
 {
 public:
     explicit ChronosEditor (ChronosProcessor&);
@@ -11,9 +12,36 @@ public:
     //==============================================================================
     void paint (Graphics&) override;
     void resized() override;
+    void mouseDown (const MouseEvent&) override;
 
 private:
+    void timerCallback() override;
+
     ChronosProcessor& pref;
+    GenericAudioProcessorEditor controls { pref };
+
+    // Meter state, UI thread only. Each frame drains every block the audio
+    // thread pushed since the last one: peaks hold the loudest block and
+    // then fall, the rest show the newest block.
+    static constexpr int   kFrameRateHz      = 30;
+    static constexpr float kPeakFallPerFrame = 0.85f;
+    static constexpr int   kMeterHeight      = 90;
+
+    MarsDSP::DSP::DelayTelemetry shown {};
+    int idleFrames = 0;
+
+    // what the delay line holds, newest on the right, one column per pixel
+    static constexpr int    kWaveformHeight  = 100;
+    static constexpr double kWaveformSeconds = 2.0;
+    std::vector<MarsDSP::DSP::WaveformColumn> waveform[2];
+
+    // output spectrum, bands evenly across the width (log frequency)
+    static constexpr int   kSpectrumHeight = 120;
+    static constexpr float kSpectrumFloorDb = -90.0f;
+    MarsDSP::DSP::SpectrumAnalyzer::Bands spectrum {};
+
+    // this instance's processBlock load; click the spectrum to reset it
+    MarsDSP::DSP::LoadStats loadStats {};
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChronosEditor)
 };
@@ -1,12 +1,22 @@
+#include <bit>
 #include "ChronosProcessor.h"
 #include "ChronosEditor.h"
 #include "PluginParameters.h"
+#include "PluginState.h"
+#include "PresetBank.h"
+#include "FactoryPresets.h"
 //==============================================================================
 ChronosProcessor::ChronosProcessor() : AudioProcessor (BusesProperties()
                        .withInput  ("Input",  AudioChannelSet::stereo(), true)
                        .withOutput ("Output", AudioChannelSet::stereo(), true)),
-                       apvts(*this, nullptr, "Parameters", createParameterLayout())
+                       apvts(*this, nullptr, "Parameters", Chronos::createParameterLayout())
 {
+    params.attach(apvts);
+    // first run writes the factory bank; an existing bank file is kept
+    const auto bankFile = Chronos::PresetBank::defaultFile();
+    Chronos::PresetBank::installIfMissing(bankFile, Chronos::factoryPresets());
+    presets = Chronos::PresetBank::openShared(bankFile);
+
     xorshiftL = 1.0;
     while (xorshiftL < 16386)
         xorshiftL = rand() * UINT32_MAX;
@@ -58,73 +68,35 @@ double ChronosProcessor::getTailLengthSeconds() const
 }
 int ChronosProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return jmax (1, presets->size());   // NB: some hosts don't cope very well if you tell them there are 0 programs,
+                                        // so this should be at least 1, even if you're not really implementing programs.
 }
 int ChronosProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load (std::memory_order_relaxed);
 }
 void ChronosProcessor::setCurrentProgram (int index)
 {
-    ignoreUnused (index);
+    // Decoded straight out of the mapped bank onto the stack. The engine
+    // glides to the new values (see processBlock) rather than resetting, so
+    // this is safe to do live.
+    std::array<float, Chronos::kNumParams> values {};
+    if (!presets->load (index, values))
+        return;
+
+    presetRampPending.store (true, std::memory_order_release);
+    params.restore (values);
+    currentProgram.store (index, std::memory_order_relaxed);
 }
 const String ChronosProcessor::getProgramName (int index)
 {
-    ignoreUnused (index);
-    return {};
+    const auto name = presets->name (index);
+    return String::fromUTF8 (name.data(), static_cast<int> (name.size()));
 }
 void ChronosProcessor::changeProgramName (int index, const String& newName)
 {
     ignoreUnused (index, newName);
 }
-//=============================================================================
-AudioProcessorValueTreeState::ParameterLayout ChronosProcessor::createParameterLayout()
-{
-    using namespace Chronos::ParamID;
-    AudioProcessorValueTreeState::ParameterLayout layout;
-
-    layout.add(std::make_unique<AudioParameterFloat>(
-        ParameterID(kDelayTime, 1), "Delay Time",
-        NormalisableRange(5.0f, 5000.0f, 0.1f, 0.3f), 200.0f,
-        AudioParameterFloatAttributes().withLabel("ms")));
-
-    layout.add(std::make_unique<AudioParameterFloat>(
-        ParameterID(kMix, 1), "Mix",
-        NormalisableRange(0.0f, 1.0f, 0.01f), 0.5f,
-        AudioParameterFloatAttributes().withLabel("%")));
-
-    layout.add(std::make_unique<AudioParameterFloat>(
-        ParameterID(kFeedback, 1), "Feedback",
-        NormalisableRange(0.0f, 0.99f, 0.01f), 0.3f,
-        AudioParameterFloatAttributes().withLabel("%")));
-
-    // Feedback-path low-cut (highpass) corner frequency.
-    layout.add(std::make_unique<AudioParameterFloat>(
-        ParameterID(kLowCut, 1), "Low Cut",
-        NormalisableRange(20.0f, 20000.0f, 1.0f, 0.3f), 20.0f,
-        AudioParameterFloatAttributes().withLabel("Hz")));
-
-    // Feedback-path high-cut (lowpass) corner frequency.
-    layout.add(std::make_unique<AudioParameterFloat>(
-        ParameterID(kHighCut, 1), "High Cut",
-        NormalisableRange(20.0f, 20000.0f, 1.0f, 0.3f), 20000.0f,
-        AudioParameterFloatAttributes().withLabel("Hz")));
-
-    // Stereo crossfeed (ping-pong amount). 0 = none, 1 = full swap.
-    layout.add(std::make_unique<AudioParameterFloat>(
-        ParameterID(kCrossfeed, 1), "Crossfeed",
-        NormalisableRange(0.0f, 1.0f, 0.01f), 0.0f,
-        AudioParameterFloatAttributes().withLabel("%")));
-
-    layout.add(std::make_unique<AudioParameterBool>(
-        ParameterID(kMono, 1), "Mono", false));
-
-    layout.add(std::make_unique<AudioParameterBool>(
-        ParameterID(kBypass, 1), "Bypass", false));
-
-    return layout;
-}
 //==============================================================================
 void ChronosProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
@@ -133,6 +105,11 @@ void ChronosProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     spec.maximumBlockSize = static_cast<uint32>(samplesPerBlock);
     spec.numChannels = static_cast<uint32>(getTotalNumOutputChannels());
     delay.prepare(spec);
+    analyzer.prepare(sampleRate);
+    loadMeter.prepare(sampleRate);
+
+    // push every parameter into the freshly prepared engine on the next block
+    params.markAllDirty();
 }
 //=============================================================================
 void ChronosProcessor::releaseResources()
@@ -171,20 +148,41 @@ void ChronosProcessor::processBlock (AudioBuffer<float> &buffer, MidiBuffer &mid
     const int numSamples = buffer.getNumSamples();
     if (numSamples == 0)
         return;
+    const MarsDSP::DSP::LoadMeter::ScopedBlock timing(loadMeter, numSamples);
+
+    // a program change glides from the values the engine has now
+    if (presetRampPending.exchange(false, std::memory_order_acquire))
+        delay.startCrossRamp(kPresetRampMs);
+
+    // this block's events, and only the parameters that moved since the last block
+    const auto applied = Chronos::applyBlockParameters(params, paramEvents, delay, getTimelineSample(), numSamples);
+    CHRONOS_ENGINE_PLOT("Dirty params", std::popcount(applied.dirty));
+    CHRONOS_ENGINE_PLOT("Param events", applied.numEvents);
 
-    // read parameters (all IDs funnel through Chronos::ParamID)
-    using namespace Chronos::ParamID;
-    delay.setDelayTimeParam(apvts.getRawParameterValue(kDelayTime)->load());
-    delay.setMixParam     (apvts.getRawParameterValue(kMix)->load());
-    delay.setFeedbackParam(apvts.getRawParameterValue(kFeedback)->load());
-    delay.setLowCutParam  (apvts.getRawParameterValue(kLowCut)->load());
-    delay.setHighCutParam (apvts.getRawParameterValue(kHighCut)->load());
-    delay.setCrossfeedParam(apvts.getRawParameterValue(kCrossfeed)->load());
-    delay.setMono    (apvts.getRawParameterValue(kMono)  ->load() >= 0.5f);
-    delay.setBypassed(apvts.getRawParameterValue(kBypass)->load() >= 0.5f);
+    // host transport for tempo-synced modulation; free-runs when unavailable
+    if (auto* playHead = getPlayHead())
+    {
+        if (const auto position = playHead->getPosition())
+            delay.setHostTempo(position->getBpm().orFallback(120.0),
+                               position->getPpqPosition().orFallback(0.0),
+                               position->getIsPlaying());
+    }
+
+    // the waveform history only runs while an editor is drawing it
+    delay.setWaveformHistoryEnabled(telemetryEnabled.load(std::memory_order_relaxed));
 
     const dsp::AudioBlock<float> block(buffer);
-    delay.process(block, numSamples);
+    delay.process(block, numSamples, paramEvents.events(), applied.numEvents);
+    timelineSample.store(getTimelineSample() + numSamples, std::memory_order_release);
+
+    // meters only run while an editor is open; a full ring drops the block
+    if (telemetryEnabled.load(std::memory_order_relaxed))
+    {
+        MarsDSP::DSP::DelayTelemetry frame;
+        delay.measure(block, numSamples, frame);
+        telemetry.push(frame);
+        analyzer.push(buffer.getReadPointer(0), buffer.getNumChannels() > 1 ? buffer.getReadPointer(1) : nullptr, numSamples);
+    }
 
     // advance dither state
     xorshiftL ^= xorshiftL << 13;
@@ -201,29 +199,83 @@ void ChronosProcessor::processBlock (AudioBuffer<float> &buffer, MidiBuffer &mid
     FrameMark;
 }
 //==============================================================================
+void ChronosProcessor::setTelemetryEnabled(const bool enabled)
+{
+    if (enabled)
+        analyzer.start();
+    telemetryEnabled.store(enabled, std::memory_order_relaxed);
+    if (!enabled)
+        analyzer.stop();
+}
+bool ChronosProcessor::popTelemetry(MarsDSP::DSP::DelayTelemetry& frame) noexcept
+{
+    return telemetry.pop(frame);
+}
+void ChronosProcessor::renderWaveform(const int channel, const int numSamples,
+                                      MarsDSP::DSP::WaveformColumn* columns, const int numColumns) const noexcept
+{
+    delay.getWaveformHistory(channel).render(numSamples, columns, numColumns);
+}
+bool ChronosProcessor::readSpectrum(MarsDSP::DSP::SpectrumAnalyzer::Bands& bands) noexcept
+{
+    return analyzer.readSpectrum(bands);
+}
+float ChronosProcessor::getAnalyzerLoad() const noexcept
+{
+    return analyzer.getLoad();
+}
+MarsDSP::DSP::LoadStats ChronosProcessor::getLoadStats() const noexcept
+{
+    return loadMeter.getStats();
+}
+void ChronosProcessor::resetLoadStats() noexcept
+{
+    loadMeter.requestReset();
+}
+//==============================================================================
+bool ChronosProcessor::pushParameterEvent(MarsDSP::DSP::EngineParam param, float value, int64_t sampleTime) noexcept
+{
+    return paramEvents.push(param, value, sampleTime);
+}
+//==============================================================================
 bool ChronosProcessor::hasEditor() const
 {
     return true; // (change this to false if you choose to not supply an editor)
 }
 AudioProcessorEditor* ChronosProcessor::createEditor()
 {
-    return new GenericAudioProcessorEditor(*this);
+    return new ChronosEditor(*this);
 }
 //==============================================================================
 void ChronosProcessor::getStateInformation(MemoryBlock &destData)
 {
-    // Stamp the current state-tree version so a future build can migrate
-    // this state forward if the schema changes.
-    auto state = apvts.copyState();
-    state.setProperty(Chronos::kStateVersionProperty,
-                      Chronos::kPluginStateVersion, nullptr);
-
-    std::unique_ptr xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    // Flat binary records straight from the parameter atomics; see
+    // PluginState.h for the layout. No ValueTree or XML is built.
+    destData.setSize(Chronos::BinaryState::kStateSize);
+    Chronos::BinaryState::write(destData.getData(), params.snapshot());
 }
 
 void ChronosProcessor::setStateInformation(const void *data, int sizeInBytes)
 {
+    if (data == nullptr || sizeInBytes <= 0)
+        return;
+
+    if (Chronos::BinaryState::isBinaryState(data, static_cast<size_t>(sizeInBytes)))
+    {
+        auto values = Chronos::BinaryState::defaults();
+        Chronos::BinaryState::Header header {};
+        if (!Chronos::BinaryState::read(data, static_cast<size_t>(sizeInBytes), values, header))
+            return;
+
+        if (header.streamingVersion < MarsDSP::DSP::DelayEngine<float>::streamingVersion)
+            MarsDSP::DSP::DelayEngine<float>::remapParametersForStreamingVersion(
+                static_cast<int16_t>(header.streamingVersion), values.data());
+
+        params.restore(values);
+        return;
+    }
+
+    // Sessions saved before the binary format: XML state tree.
     std::unique_ptr xml(getXmlFromBinary(data, sizeInBytes));
     if (xml == nullptr || !xml->hasTagName(apvts.state.getType()))
         return;
@@ -3,7 +3,14 @@
 #include <JuceHeader.h>
 #include <tracy/Tracy.hpp>
 #include "dsp/engine/delay/delay_engine.h"
+#include "dsp/engine/delay/param_event_scheduler.h"
+#include "dsp/engine/metering/spectrum_analyzer.h"
+#include "dsp/engine/metering/load_meter.h"
 #include "utils/helpers/overload.h"
+#include "utils/helpers/spsc_ring.h"
+#include "PluginParameters.h"
+#include "BlockParameters.h"
+#include "PresetBank.h"
 //==============================================================================
 class ChronosProcessor final : public AudioProcessor {
 public:
@@ -36,11 +43,65 @@ public:
     void setStateInformation (const void *data, int sizeInBytes) override;
 
     AudioProcessorValueTreeState apvts;
+    //==============================================================================
+    // Sample-accurate automation. Events are stamped on the processor's own
+    // sample timeline (getTimelineSample() is the start of the next block)
+    // and rendered at their offset inside whichever block they fall in.
+    // Events don't write the APVTS: the engine keeps an event's value until
+    // the host / UI value of that parameter next changes.
+    //
+    // Any thread. Returns false when the queue is full and the event was dropped.
+    bool pushParameterEvent (MarsDSP::DSP::EngineParam param, float value, int64_t sampleTime) noexcept;
+    int64_t getTimelineSample() const noexcept { return timelineSample.load (std::memory_order_acquire); }
+
+    // Block meters for the editor. While enabled, every processed block
+    // pushes one DelayTelemetry; the UI thread (the only consumer) pops
+    // them at its frame rate. Enabling also starts the spectrum analyser's
+    // thread, so call it from the message thread.
+    void setTelemetryEnabled (bool enabled);
+    bool popTelemetry (MarsDSP::DSP::DelayTelemetry& frame) noexcept;
+
+    // Min/max of the newest numSamples the delay line holds, across
+    // numColumns columns, oldest first. Any thread, O(numColumns); silent
+    // until telemetry is enabled.
+    void renderWaveform (int channel, int numSamples, MarsDSP::DSP::WaveformColumn* columns, int numColumns) const noexcept;
+
+    // Newest output spectrum (dB per log band) and the analyser thread's
+    // share of one core. UI thread only; floor until telemetry is enabled.
+    bool readSpectrum (MarsDSP::DSP::SpectrumAnalyzer::Bands& bands) noexcept;
+    float getAnalyzerLoad() const noexcept;
+
+    // processBlock time against its real-time budget, every block since
+    // prepareToPlay or the last reset (which lands at the end of the next
+    // block). Any thread.
+    MarsDSP::DSP::LoadStats getLoadStats() const noexcept;
+    void resetLoadStats() noexcept;
 
 private:
     MarsDSP::DSP::DelayEngine<float> delay;
 
-    static AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // queue → pending (sorted, may hold events for later blocks) → this block's offsets
+    MarsDSP::DSP::ParamEventScheduler<1024, 512> paramEvents;
+    std::atomic<int64_t> timelineSample { 0 };
+
+    // audio thread → editor; 256 blocks is several UI frames at 32-sample blocks
+    MarsDSP::SpscRing<MarsDSP::DSP::DelayTelemetry, 256> telemetry;
+    std::atomic<bool> telemetryEnabled { false };
+
+    // the audio thread only memcpys the output into it, see spectrum_analyzer.h
+    MarsDSP::DSP::SpectrumAnalyzer analyzer;
+
+    MarsDSP::DSP::LoadMeter loadMeter;
+
+    // cached parameter atomics and per-block dirty mask (see PluginParameters.h)
+    Chronos::ParameterBridge params;
+
+    // read-only bank shared by every instance; a program change glides the
+    // engine to the preset over kPresetRampMs instead of jumping
+    static constexpr float kPresetRampMs = 50.0f;
+    std::shared_ptr<const Chronos::PresetBank> presets;
+    std::atomic<int>  currentProgram { 0 };
+    std::atomic<bool> presetRampPending { false };
 
     // Xorshift32 PRNG
     uint32_t xorshiftL;
@@ -0,0 +1,55 @@
+// Factory preset bank.
+//
+// Installed as PresetBank::defaultFile() on first run (see
+// PresetBank::installIfMissing), so hosts have programs to step through
+// before the user has saved any. Each preset starts from the parameter
+// defaults in kParamSpecs and only lists what it changes. Values are raw
+// parameter values, in the units the table declares.
+#pragma once
+#include <initializer_list>
+#include <vector>
+#include "PresetBank.h"
+
+namespace Chronos
+{
+    inline std::vector<PresetBank::Preset> factoryPresets()
+    {
+        struct Setting
+        {
+            Param param;
+            float value;
+        };
+
+        auto preset = [](const char* name, const std::initializer_list<Setting> settings)
+        {
+            PresetBank::Preset p { name, BinaryState::defaults() };
+            for (const auto& s : settings)
+                p.values[static_cast<size_t>(s.param)] = s.value;
+            return p;
+        };
+
+        return {
+            preset("Init", {}),
+            preset("Slapback", {
+                { Param::DelayTime, 90.0f }, { Param::Mix, 0.35f }, { Param::Feedback, 0.1f },
+                { Param::LowCut, 120.0f }, { Param::HighCut, 6000.0f }, { Param::Mono, 1.0f } }),
+            preset("Ping Pong", {
+                { Param::DelayTime, 375.0f }, { Param::Mix, 0.4f }, { Param::Feedback, 0.55f },
+                { Param::HighCut, 9000.0f }, { Param::Crossfeed, 1.0f } }),
+            preset("Dub Echo", {
+                { Param::DelayTime, 450.0f }, { Param::Mix, 0.45f }, { Param::Feedback, 0.75f },
+                { Param::LowCut, 250.0f }, { Param::HighCut, 3000.0f }, { Param::Crossfeed, 0.3f } }),
+            preset("Tape Wobble", {
+                { Param::DelayTime, 320.0f }, { Param::Mix, 0.4f }, { Param::Feedback, 0.5f },
+                { Param::HighCut, 7000.0f }, { Param::ModRate, 0.8f }, { Param::ModDepth, 3.0f },
+                { Param::ModFeedback, 0.15f } }),
+            preset("Ambient Wash", {
+                { Param::DelayTime, 1200.0f }, { Param::Mix, 0.5f }, { Param::Feedback, 0.85f },
+                { Param::LowCut, 200.0f }, { Param::HighCut, 5000.0f }, { Param::Crossfeed, 0.5f },
+                { Param::ModRate, 0.2f }, { Param::ModDepth, 8.0f }, { Param::ModShape, 2.0f } }),
+            preset("Jump Rhythm", {
+                { Param::DelayTime, 250.0f }, { Param::Mix, 0.4f }, { Param::Feedback, 0.6f },
+                { Param::DelayMode, 1.0f }, { Param::JumpFade, 20.0f } }),
+        };
+    }
+}
@@ -4,19 +4,33 @@
 //   1. Parameter IDs are referenced ONLY through the constants in this file.
 //      Never hard-code the string literal elsewhere. Renaming a param means
 //      editing this file (and bumping kPluginStateVersion + adding a migration).
-//   2. Every saved state includes the property "pluginStateVersion" at the
-//      root of the APVTS ValueTree. On load, the processor dispatches the old
-//      tree through migrateStateTree() before calling replaceState().
+//   2. Every saved state carries its version. States are saved in the
+//      binary format in PluginState.h, whose header holds kPluginStateVersion
+//      and the engine's streamingVersion. Older XML states include the
+//      property "pluginStateVersion" at the root of the APVTS ValueTree; on
+//      load, the processor dispatches the old tree through migrateStateTree()
+//      before calling replaceState(). A rename must be migrated in both:
+//      a renameParam() call there and a row in BinaryState::kIdRenames.
 //   3. Adding a brand-new parameter with a sensible default is SAFE without a
 //      version bump: JUCE's APVTS leaves missing parameters at their default
 //      when loading older states.
-//   4. Any of the following REQUIRE a version bump AND a migration branch:
+//   4. Every parameter is declared once, in kParamSpecs below. The APVTS
+//      layout, the cached atomics in ParameterBridge and (through
+//      MarsDSP::DSP::kEngineParamRanges) the engine's clamps all come from
+//      that table. Adding a parameter means adding a Param entry and a row.
+//   5. Any of the following REQUIRE a version bump AND a migration branch:
 //        - renaming / removing a parameter
 //        - changing a parameter's units, range, skew, or default in a way
 //          that changes interpretation of a stored normalized value
 //        - splitting or merging parameters
 #pragma once
 #include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include "dsp/engine/delay/delay_params.h"
+#include "utils/helpers/temposync.h"
 
 namespace Chronos
 {
@@ -41,8 +55,261 @@ namespace Chronos
         inline constexpr auto kCrossfeed = "crossfeed";
         inline constexpr auto kMono      = "mono";
         inline constexpr auto kBypass    = "bypass";
+        inline constexpr auto kModRate     = "modRate";
+        inline constexpr auto kModDepth    = "modDepth";
+        inline constexpr auto kModFeedback = "modFeedback";
+        inline constexpr auto kModShape    = "modShape";
+        inline constexpr auto kModSync     = "modSync";
+        inline constexpr auto kModDivision = "modDivision";
+        inline constexpr auto kDelayMode   = "delayMode";
+        inline constexpr auto kJumpFade    = "jumpFade";
     } // namespace ParamID
 
+    // --------------------------------------------------------------
+    // Parameter table
+    // --------------------------------------------------------------
+    // Index of every parameter in kParamSpecs, in host order. The order is
+    // what hosts see as parameter indices; append, don't reorder.
+    enum class Param : int
+    {
+        DelayTime, Mix, Feedback, LowCut, HighCut, Crossfeed, Mono, Bypass,
+        ModRate, ModDepth, ModFeedback, ModShape, ModSync, ModDivision,
+        DelayMode, JumpFade,
+        Count
+    };
+
+    inline constexpr int kNumParams = static_cast<int>(Param::Count);
+
+    enum class ParamKind { Float, Bool, Choice };
+
+    struct ParamSpec
+    {
+        const char* id;
+        const char* name;
+        ParamKind   kind;
+        float       min, max, step, skew;
+        float       defaultValue;               // bools 0 / 1, choices the index
+        const char* label;
+        int         engine;                     // MarsDSP::DSP::EngineParam, or -1 when not engine-backed
+        const char* const* choices;
+        int         numChoices;
+    };
+
+    inline constexpr std::array<const char*, 3> kModShapeNames { "Sine", "Triangle", "Random" };
+    inline constexpr std::array<const char*, 2> kDelayModeNames { "Glide", "Jump" };    // MarsDSP::DSP::DelayTimeMode
+
+    namespace Detail
+    {
+        // continuous parameter whose range is the engine's clamp range
+        constexpr ParamSpec engineFloat(const char* id, const char* name, MarsDSP::DSP::EngineParam param,
+                                        float step, float skew, float defaultValue, const char* label)
+        {
+            const auto range = MarsDSP::DSP::paramRange(param);
+            return { id, name, ParamKind::Float, range.min, range.max, step, skew, defaultValue, label,
+                     static_cast<int>(param), nullptr, 0 };
+        }
+
+        // continuous parameter the processor forwards itself
+        constexpr ParamSpec plainFloat(const char* id, const char* name, MarsDSP::DSP::ParamRange range,
+                                       float step, float skew, float defaultValue, const char* label)
+        {
+            return { id, name, ParamKind::Float, range.min, range.max, step, skew, defaultValue, label, -1, nullptr, 0 };
+        }
+
+        constexpr ParamSpec boolean(const char* id, const char* name, bool defaultValue)
+        {
+            return { id, name, ParamKind::Bool, 0.0f, 1.0f, 1.0f, 1.0f, defaultValue ? 1.0f : 0.0f, "", -1, nullptr, 0 };
+        }
+
+        template<std::size_t N>
+        constexpr ParamSpec choice(const char* id, const char* name, const std::array<const char*, N>& choices, int defaultIndex)
+        {
+            return { id, name, ParamKind::Choice, 0.0f, static_cast<float>(N - 1), 1.0f, 1.0f,
+                     static_cast<float>(defaultIndex), "", -1, choices.data(), static_cast<int>(N) };
+        }
+    }
+
+    inline constexpr std::array<ParamSpec, kNumParams> kParamSpecs
+    {{
+        Detail::engineFloat(ParamID::kDelayTime,   "Delay Time",   MarsDSP::DSP::EngineParam::DelayTime,   0.1f,  0.3f, 200.0f,   "ms"),
+        Detail::engineFloat(ParamID::kMix,         "Mix",          MarsDSP::DSP::EngineParam::Mix,         0.01f, 1.0f, 0.5f,     "%"),
+        Detail::engineFloat(ParamID::kFeedback,    "Feedback",     MarsDSP::DSP::EngineParam::Feedback,    0.01f, 1.0f, 0.3f,     "%"),
+        // feedback-path low-cut (highpass) / high-cut (lowpass) corners
+        Detail::engineFloat(ParamID::kLowCut,      "Low Cut",      MarsDSP::DSP::EngineParam::LowCut,      1.0f,  0.3f, 20.0f,    "Hz"),
+        Detail::engineFloat(ParamID::kHighCut,     "High Cut",     MarsDSP::DSP::EngineParam::HighCut,     1.0f,  0.3f, 20000.0f, "Hz"),
+        // stereo crossfeed (ping-pong amount). 0 = none, 1 = full swap
+        Detail::engineFloat(ParamID::kCrossfeed,   "Crossfeed",    MarsDSP::DSP::EngineParam::Crossfeed,   0.01f, 1.0f, 0.0f,     "%"),
+        Detail::boolean    (ParamID::kMono,        "Mono",         false),
+        Detail::boolean    (ParamID::kBypass,      "Bypass",       false),
+        // delay-time / feedback modulation. depth 0 leaves the engine untouched
+        Detail::engineFloat(ParamID::kModRate,     "Mod Rate",     MarsDSP::DSP::EngineParam::ModRate,     0.01f, 0.3f, 0.5f,     "Hz"),
+        Detail::engineFloat(ParamID::kModDepth,    "Mod Depth",    MarsDSP::DSP::EngineParam::ModDepth,    0.01f, 0.5f, 0.0f,     "ms"),
+        Detail::engineFloat(ParamID::kModFeedback, "Mod Feedback", MarsDSP::DSP::EngineParam::ModFeedback, 0.01f, 1.0f, 0.0f,     "%"),
+        Detail::choice     (ParamID::kModShape,    "Mod Shape",    kModShapeNames, 0),
+        Detail::boolean    (ParamID::kModSync,     "Mod Sync",     false),
+        Detail::choice     (ParamID::kModDivision, "Mod Division", MarsDSP::kSyncDivisionNames,
+                            static_cast<int>(MarsDSP::SyncDivision::Quarter)),
+        // glide bends pitch on a time change, jump crossfades to the new tap
+        Detail::choice     (ParamID::kDelayMode,   "Delay Mode",   kDelayModeNames, 0),
+        Detail::plainFloat (ParamID::kJumpFade,    "Jump Fade",    MarsDSP::DSP::kJumpFadeRange,    0.1f,  0.5f, 30.0f,    "ms"),
+    }};
+
+    constexpr const ParamSpec& spec(const Param param) noexcept { return kParamSpecs[static_cast<std::size_t>(param)]; }
+
+    // the table and the engine can only disagree at compile time
+    namespace Detail
+    {
+        consteval bool tableIsConsistent()
+        {
+            for (std::size_t i = 0; i < kParamSpecs.size(); ++i)
+            {
+                const auto& p = kParamSpecs[i];
+                if (p.id == nullptr || !(p.min <= p.defaultValue && p.defaultValue <= p.max))
+                    return false;
+                for (std::size_t j = 0; j < i; ++j)
+                    if (std::string_view(p.id) == kParamSpecs[j].id)
+                        return false;
+                // rows sit in host order; the engine field alone says which
+                // EngineParam a row drives
+                if (p.engine < -1 || p.engine >= static_cast<int>(MarsDSP::DSP::EngineParam::Count))
+                    return false;
+                if (p.engine >= 0)
+                {
+                    const auto range = MarsDSP::DSP::kEngineParamRanges[static_cast<std::size_t>(p.engine)];
+                    if (p.kind != ParamKind::Float || p.min != range.min || p.max != range.max)
+                        return false;
+                }
+            }
+            // row -> EngineParam is one-to-one and covers every engine parameter
+            for (int e = 0; e < static_cast<int>(MarsDSP::DSP::EngineParam::Count); ++e)
+            {
+                int rows = 0;
+                for (const auto& p : kParamSpecs)
+                    rows += p.engine == e ? 1 : 0;
+                if (rows != 1)
+                    return false;
+            }
+            return true;
+        }
+    }
+    static_assert(Detail::tableIsConsistent(), "kParamSpecs out of sync with itself or with kEngineParamRanges");
+    static_assert(std::string_view(spec(Param::Bypass).id) == ParamID::kBypass, "Param order must match kParamSpecs rows");
+    static_assert(std::string_view(spec(Param::ModRate).id) == ParamID::kModRate, "Param order must match kParamSpecs rows");
+    static_assert(std::string_view(spec(Param::JumpFade).id) == ParamID::kJumpFade, "Param order must match kParamSpecs rows");
+
+    // --------------------------------------------------------------
+    // APVTS layout, generated from kParamSpecs
+    // --------------------------------------------------------------
+    inline juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
+    {
+        juce::AudioProcessorValueTreeState::ParameterLayout layout;
+        for (const auto& p : kParamSpecs)
+        {
+            const juce::ParameterID id(p.id, 1);
+            switch (p.kind)
+            {
+                case ParamKind::Float:
+                    layout.add(std::make_unique<juce::AudioParameterFloat>(
+                        id, p.name, juce::NormalisableRange(p.min, p.max, p.step, p.skew), p.defaultValue,
+                        juce::AudioParameterFloatAttributes().withLabel(p.label)));
+                    break;
+
+                case ParamKind::Bool:
+                    layout.add(std::make_unique<juce::AudioParameterBool>(id, p.name, p.defaultValue >= 0.5f));
+                    break;
+
+                case ParamKind::Choice:
+                {
+                    juce::StringArray choices;
+                    for (int i = 0; i < p.numChoices; ++i)
+                        choices.add(p.choices[i]);
+                    layout.add(std::make_unique<juce::AudioParameterChoice>(
+                        id, p.name, choices, static_cast<int>(p.defaultValue)));
+                    break;
+                }
+            }
+        }
+        return layout;
+    }
+
+    // --------------------------------------------------------------
+    // Audio-thread view of the parameters
+    // --------------------------------------------------------------
+    // Looks every atomic up by ID once in attach(), then poll() loads each
+    // one per block and returns a bit per parameter whose value changed
+    // since the last poll, so the processor only calls the setters (and the
+    // engine only recomputes) for what actually moved.
+    class ParameterBridge
+    {
+    public:
+        static_assert(kNumParams <= 32, "dirty mask is 32 bits");
+
+        static constexpr uint32_t bit(const Param param) noexcept { return 1u << static_cast<int>(param); }
+
+        void attach(juce::AudioProcessorValueTreeState& apvts)
+        {
+            for (int i = 0; i < kNumParams; ++i)
+            {
+                atomics[static_cast<std::size_t>(i)] = apvts.getRawParameterValue(kParamSpecs[static_cast<std::size_t>(i)].id);
+                parameters[static_cast<std::size_t>(i)] = apvts.getParameter(kParamSpecs[static_cast<std::size_t>(i)].id);
+                jassert(atomics[static_cast<std::size_t>(i)] != nullptr && parameters[static_cast<std::size_t>(i)] != nullptr);
+            }
+            markAllDirty();
+        }
+
+        // Message thread, for state save / load. Raw values in kParamSpecs
+        // order, read straight from the atomics and written back through the
+        // parameters so the host sees the change.
+        std::array<float, kNumParams> snapshot() const noexcept
+        {
+            std::array<float, kNumParams> raw {};
+            for (int i = 0; i < kNumParams; ++i)
+                raw[static_cast<std::size_t>(i)] = atomics[static_cast<std::size_t>(i)]->load(std::memory_order_relaxed);
+            return raw;
+        }
+
+        void restore(const std::array<float, kNumParams>& raw)
+        {
+            for (int i = 0; i < kNumParams; ++i)
+            {
+                auto* parameter = parameters[static_cast<std::size_t>(i)];
+                parameter->setValueNotifyingHost(parameter->convertTo0to1(raw[static_cast<std::size_t>(i)]));
+            }
+        }
+
+        // audio thread, once per block
+        uint32_t poll() noexcept
+        {
+            uint32_t dirty = pendingDirty;
+            pendingDirty = 0;
+            for (int i = 0; i < kNumParams; ++i)
+            {
+                const float v = atomics[static_cast<std::size_t>(i)]->load(std::memory_order_relaxed);
+                if (v != values[static_cast<std::size_t>(i)])
+                {
+                    values[static_cast<std::size_t>(i)] = v;
+                    dirty |= 1u << i;
+                }
+            }
+            return dirty;
+        }
+
+        // report these as dirty again on the next poll
+        void markDirty(const uint32_t mask) noexcept { pendingDirty |= mask; }
+        void markAllDirty() noexcept { pendingDirty = (kNumParams == 32) ? ~0u : ((1u << kNumParams) - 1u); }
+
+        // values as of the last poll()
+        float get(const Param param) const noexcept { return values[static_cast<std::size_t>(param)]; }
+        bool  getBool(const Param param) const noexcept { return get(param) >= 0.5f; }
+        int   getChoice(const Param param) const noexcept { return static_cast<int>(get(param)); }
+
+    private:
+        std::array<std::atomic<float>*, kNumParams> atomics {};
+        std::array<juce::RangedAudioParameter*, kNumParams> parameters {};
+        std::array<float, kNumParams> values {};
+        uint32_t pendingDirty = 0;
+    };
+
     // --------------------------------------------------------------
     // State-tree version property name
     // --------------------------------------------------------------
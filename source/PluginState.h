@@ -0,0 +1,215 @@
+// Binary plugin-state format.
+//
+// The saved state is a flat, fixed-stride little-endian blob:
+//
+//   offset  size  field
+//   0       4     magic "CHRS"
+//   4       2     kPluginStateVersion at save time
+//   6       2     DelayEngine::streamingVersion at save time (signed)
+//   8       2     record count
+//   10      2     record size in bytes (8 today; readers skip any extra)
+//   12      8·n   records: FNV-1a hash of the parameter ID, value (float)
+//
+// Values are the APVTS raw (denormalised) values. Records are matched by ID
+// hash, not position, so a state with parameters this build doesn't know
+// loads fine (unknown hashes are skipped) and one missing newer parameters
+// leaves them at their defaults, same as APVTS rule 3 in PluginParameters.h.
+// A renamed parameter keeps its value: read() rewrites the hashes of records
+// saved before the rename (kIdRenames, keyed on the header's
+// kPluginStateVersion) before matching them, so the binary path migrates IDs
+// the way migrateStateTree does for XML. The streaming version is handed to
+// remapParametersForStreamingVersion so flat-array migrations run exactly as
+// they would for any other stream.
+//
+// Writing and reading touch no DOM and no allocation beyond the host's
+// output block. Anything that does not start with the magic is not ours and
+// goes down the old XML path, so sessions saved before this format still load.
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include "PluginParameters.h"
+#include "dsp/engine/delay/delay_engine.h"
+
+namespace Chronos::BinaryState
+{
+    // --------------------------------------------------------------
+    // Layout
+    // --------------------------------------------------------------
+    inline constexpr uint32_t kMagic      = 0x53524843u;    // "CHRS" read little-endian
+    inline constexpr size_t   kHeaderSize = 12;
+    inline constexpr size_t   kRecordSize = 8;
+
+    constexpr uint32_t idHash(const std::string_view id) noexcept
+    {
+        uint32_t h = 2166136261u;
+        for (const char c : id)
+            h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+        return h;
+    }
+
+    namespace Detail
+    {
+        // a collision between two IDs would silently swap their values
+        consteval bool hashesAreUnique()
+        {
+            for (size_t i = 0; i < kParamSpecs.size(); ++i)
+                for (size_t j = 0; j < i; ++j)
+                    if (idHash(kParamSpecs[i].id) == idHash(kParamSpecs[j].id))
+                        return false;
+            return true;
+        }
+
+        inline void put16(uint8_t* p, const uint16_t v) noexcept
+        {
+            p[0] = static_cast<uint8_t>(v);
+            p[1] = static_cast<uint8_t>(v >> 8);
+        }
+
+        inline void put32(uint8_t* p, const uint32_t v) noexcept
+        {
+            for (int i = 0; i < 4; ++i)
+                p[i] = static_cast<uint8_t>(v >> (8 * i));
+        }
+
+        inline uint16_t get16(const uint8_t* p) noexcept
+        {
+            return static_cast<uint16_t>(p[0] | (p[1] << 8));
+        }
+
+        inline uint32_t get32(const uint8_t* p) noexcept
+        {
+            return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+                 | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+        }
+
+        inline constexpr auto kIdHashes = []
+        {
+            std::array<uint32_t, kNumParams> hashes {};
+            for (size_t i = 0; i < hashes.size(); ++i)
+                hashes[i] = idHash(kParamSpecs[i].id);
+            return hashes;
+        }();
+    }
+    static_assert(Detail::hashesAreUnique(), "two parameter IDs share an FNV-1a hash");
+
+    inline constexpr size_t kStateSize = kHeaderSize + kRecordSize * kNumParams;
+
+    // --------------------------------------------------------------
+    // ID migrations
+    // --------------------------------------------------------------
+    // One row per parameter rename, oldest first: states saved before
+    // plugin state version `version` stored the parameter as `from`. Every
+    // rename bumps kPluginStateVersion and gets a row here next to its
+    // renameParam() in migrateStateTree (rule 5 in PluginParameters.h).
+    struct IdRename
+    {
+        int              version;
+        std::string_view from;
+        std::string_view to;
+    };
+
+    inline constexpr std::array<IdRename, 0> kIdRenames {};
+
+    // the hash a record saved at fromVersion goes by in this build; renames
+    // chain, so an ID renamed twice ends at its current name
+    constexpr uint32_t migrateIdHash(uint32_t hash, const int fromVersion,
+                                     const std::span<const IdRename> renames = kIdRenames) noexcept
+    {
+        for (const auto& rename : renames)
+            if (fromVersion < rename.version && hash == idHash(rename.from))
+                hash = idHash(rename.to);
+        return hash;
+    }
+
+    // --------------------------------------------------------------
+    // Save / load
+    // --------------------------------------------------------------
+
+    struct Header
+    {
+        int pluginStateVersion;
+        int streamingVersion;
+    };
+
+    // every parameter's default, the starting point for read()
+    inline std::array<float, kNumParams> defaults() noexcept
+    {
+        std::array<float, kNumParams> values {};
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = kParamSpecs[i].defaultValue;
+        return values;
+    }
+
+    // dest must hold kStateSize bytes; values are in kParamSpecs order
+    inline void write(void* dest, const std::array<float, kNumParams>& values,
+                      const int16_t streamingVersion = MarsDSP::DSP::DelayEngine<float>::streamingVersion) noexcept
+    {
+        auto* p = static_cast<uint8_t*>(dest);
+        Detail::put32(p, kMagic);
+        Detail::put16(p + 4, static_cast<uint16_t>(kPluginStateVersion));
+        Detail::put16(p + 6, static_cast<uint16_t>(streamingVersion));
+        Detail::put16(p + 8, static_cast<uint16_t>(kNumParams));
+        Detail::put16(p + 10, static_cast<uint16_t>(kRecordSize));
+        p += kHeaderSize;
+
+        for (size_t i = 0; i < values.size(); ++i, p += kRecordSize)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &values[i], sizeof(bits));
+            Detail::put32(p, Detail::kIdHashes[i]);
+            Detail::put32(p + 4, bits);
+        }
+    }
+
+    [[nodiscard]] inline bool isBinaryState(const void* data, const size_t size) noexcept
+    {
+        return size >= kHeaderSize && Detail::get32(static_cast<const uint8_t*>(data)) == kMagic;
+    }
+
+    // Overwrites the values it finds a record for and leaves the rest alone
+    // (start from defaults()). Records from an older plugin state version
+    // are matched under their migrated IDs. Fails on foreign, truncated or
+    // newer-than-this-build data. Values come back as stored: the caller
+    // runs remapParametersForStreamingVersion on them when header says so.
+    [[nodiscard]] inline bool read(const void* data, const size_t size,
+                                   std::array<float, kNumParams>& values, Header& header,
+                                   const std::span<const IdRename> renames = kIdRenames) noexcept
+    {
+        if (!isBinaryState(data, size))
+            return false;
+
+        const auto* p = static_cast<const uint8_t*>(data);
+        header.pluginStateVersion = Detail::get16(p + 4);
+        header.streamingVersion   = static_cast<int16_t>(Detail::get16(p + 6));
+        const size_t numRecords   = Detail::get16(p + 8);
+        const size_t recordSize   = Detail::get16(p + 10);
+
+        if (header.pluginStateVersion > kPluginStateVersion
+            || header.streamingVersion > MarsDSP::DSP::DelayEngine<float>::streamingVersion
+            || recordSize < kRecordSize
+            || size < kHeaderSize + numRecords * recordSize)
+            return false;
+
+        const bool migrate = header.pluginStateVersion < kPluginStateVersion && !renames.empty();
+
+        p += kHeaderSize;
+        for (size_t r = 0; r < numRecords; ++r, p += recordSize)
+        {
+            uint32_t hash = Detail::get32(p);
+            if (migrate)
+                hash = migrateIdHash(hash, header.pluginStateVersion, renames);
+            const uint32_t bits = Detail::get32(p + 4);
+            for (size_t i = 0; i < Detail::kIdHashes.size(); ++i)
+            {
+                if (Detail::kIdHashes[i] != hash) continue;
+                std::memcpy(&values[i], &bits, sizeof(float));
+                break;
+            }
+        }
+        return true;
+    }
+}
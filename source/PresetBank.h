@@ -0,0 +1,201 @@
+// Memory-mapped preset bank.
+//
+// One file holds every preset as fixed-stride records, mapped read-only and
+// shared by every plugin instance in the process (the OS shares the pages
+// across processes too):
+//
+//   offset  size  field
+//   0       4     magic "CHPB"
+//   4       2     bank format version
+//   6       2     preset count
+//   8       2     name size in bytes (32 today)
+//   10      2     state size in bytes
+//   12      4     reserved, 0
+//   16      ...   presets, stride = name size + state size:
+//                   name   NUL-padded UTF-8
+//                   state  a BinaryState blob (PluginState.h)
+//
+// Selecting preset i is a pointer offset and a BinaryState::read of a few
+// dozen bytes: nothing is parsed up front and nothing allocates after the
+// bank is opened. Because the state records carry their own versions and
+// ID hashes, a bank written by an older build loads exactly like an older
+// session does.
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "PluginState.h"
+
+namespace Chronos
+{
+    class PresetBank
+    {
+    public:
+        static constexpr uint32_t kMagic       = 0x42504843u;    // "CHPB" read little-endian
+        static constexpr int      kVersion     = 1;
+        static constexpr size_t   kHeaderSize  = 16;
+        static constexpr size_t   kNameSize    = 32;
+
+        // view over bytes the caller keeps alive; malformed data is an empty bank
+        PresetBank(const void* bytes, const size_t size) noexcept
+        {
+            parse(static_cast<const uint8_t*>(bytes), size);
+        }
+
+        PresetBank(const PresetBank&) = delete;
+        PresetBank& operator=(const PresetBank&) = delete;
+
+        // --------------------------------------------------------------
+        // Shared mapping
+        // --------------------------------------------------------------
+        // Every caller asking for the same file gets the same mapping for as
+        // long as any of them holds it. Opening maps the file (and may
+        // allocate); call it from the constructor, never while switching.
+        // Entries whose banks every holder has released are dropped on the
+        // next open, so the map only holds paths still in use.
+        static std::shared_ptr<const PresetBank> openShared(const juce::File& file)
+        {
+            static std::mutex lock;
+            static std::map<juce::String, std::weak_ptr<const PresetBank>> banks;
+
+            const std::scoped_lock scoped(lock);
+            std::erase_if(banks, [](const auto& entry) { return entry.second.expired(); });
+            auto& slot = banks[file.getFullPathName()];
+            if (auto bank = slot.lock())
+                return bank;
+
+            std::shared_ptr<const PresetBank> bank(new PresetBank(
+                std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly)));
+            slot = bank;
+            return bank;
+        }
+
+        static juce::File defaultFile()
+        {
+            return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+                .getChildFile("MarsDSP").getChildFile("Chronos").getChildFile("Presets.chronosbank");
+        }
+
+        // --------------------------------------------------------------
+        // Lookup, any thread, no allocation
+        // --------------------------------------------------------------
+        [[nodiscard]] int size() const noexcept { return numPresets; }
+
+        [[nodiscard]] std::string_view name(const int index) const noexcept
+        {
+            if (index < 0 || index >= numPresets)
+                return {};
+            const auto* p = reinterpret_cast<const char*>(record(index));
+            size_t length = 0;
+            while (length < nameSize && p[length] != '\0')
+                ++length;
+            return { p, length };
+        }
+
+        // Raw parameter values in kParamSpecs order, migrated to this build's
+        // streaming version. Parameters the preset doesn't store keep their
+        // defaults. False, with values untouched, for a bad index or record.
+        [[nodiscard]] bool load(const int index, std::array<float, kNumParams>& values) const noexcept
+        {
+            if (index < 0 || index >= numPresets)
+                return false;
+
+            auto decoded = BinaryState::defaults();
+            BinaryState::Header header {};
+            if (!BinaryState::read(record(index) + nameSize, stateSize, decoded, header))
+                return false;
+
+            if (header.streamingVersion < MarsDSP::DSP::DelayEngine<float>::streamingVersion)
+                MarsDSP::DSP::DelayEngine<float>::remapParametersForStreamingVersion(
+                    static_cast<int16_t>(header.streamingVersion), decoded.data());
+            values = decoded;
+            return true;
+        }
+
+        // --------------------------------------------------------------
+        // Authoring (factory banks, tests)
+        // --------------------------------------------------------------
+        struct Preset
+        {
+            std::string name;                       // truncated to kNameSize - 1 bytes
+            std::array<float, kNumParams> values;
+        };
+
+        static std::vector<uint8_t> serialise(const std::vector<Preset>& presets)
+        {
+            const size_t stride = kNameSize + BinaryState::kStateSize;
+            std::vector<uint8_t> bytes(kHeaderSize + stride * presets.size(), 0);
+
+            BinaryState::Detail::put32(bytes.data(), kMagic);
+            BinaryState::Detail::put16(bytes.data() + 4, static_cast<uint16_t>(kVersion));
+            BinaryState::Detail::put16(bytes.data() + 6, static_cast<uint16_t>(presets.size()));
+            BinaryState::Detail::put16(bytes.data() + 8, static_cast<uint16_t>(kNameSize));
+            BinaryState::Detail::put16(bytes.data() + 10, static_cast<uint16_t>(BinaryState::kStateSize));
+
+            auto* p = bytes.data() + kHeaderSize;
+            for (const auto& preset : presets)
+            {
+                preset.name.copy(reinterpret_cast<char*>(p), kNameSize - 1);
+                BinaryState::write(p + kNameSize, preset.values);
+                p += stride;
+            }
+            return bytes;
+        }
+
+        // Writes presets to file unless something is already there, so a
+        // first run gets the factory bank and a bank the user replaced it
+        // with is left alone. Message thread, before openShared().
+        static bool installIfMissing(const juce::File& file, const std::vector<Preset>& presets)
+        {
+            if (file.existsAsFile())
+                return true;
+            if (!file.getParentDirectory().createDirectory().wasOk())
+                return false;
+            const auto bytes = serialise(presets);
+            return file.replaceWithData(bytes.data(), bytes.size());
+        }
+
+    private:
+        explicit PresetBank(std::unique_ptr<juce::MemoryMappedFile> file) noexcept
+            : mapping(std::move(file))
+        {
+            if (mapping->getData() != nullptr)
+                parse(static_cast<const uint8_t*>(mapping->getData()), mapping->getSize());
+        }
+
+        void parse(const uint8_t* bytes, const size_t size) noexcept
+        {
+            if (bytes == nullptr || size < kHeaderSize || BinaryState::Detail::get32(bytes) != kMagic
+                || BinaryState::Detail::get16(bytes + 4) > kVersion)
+                return;
+
+            const size_t count = BinaryState::Detail::get16(bytes + 6);
+            nameSize  = BinaryState::Detail::get16(bytes + 8);
+            stateSize = BinaryState::Detail::get16(bytes + 10);
+            stride    = nameSize + stateSize;
+            if (stateSize < BinaryState::kHeaderSize || size < kHeaderSize + count * stride)
+                return;
+
+            data       = bytes + kHeaderSize;
+            numPresets = static_cast<int>(count);
+        }
+
+        const uint8_t* record(const int index) const noexcept
+        {
+            return data + static_cast<size_t>(index) * stride;
+        }
+
+        std::unique_ptr<juce::MemoryMappedFile> mapping;
+        const uint8_t* data = nullptr;
+        size_t nameSize  = 0;
+        size_t stateSize = 0;
+        size_t stride    = 0;
+        int numPresets   = 0;
+    };
+}
@@ -6,13 +6,52 @@
 #include <cassert>
 #include <JuceHeader.h>
 #include "dsp/math/fastermath.h"
+#include "dsp/math/fastermath_double.h"
+#include "dsp/math/constexpr_gen.h"
+#include "dsp/engine/saturation/tanh_adaa.h"
+#include "dsp/engine/modulation/lfo_bank.h"
+#include "dsp/engine/smoothing/smoother_bank.h"
+#include "dsp/engine/metering/level_meter.h"
+#include "dsp/engine/metering/waveform_pyramid.h"
+#include "dsp/engine/delay/delay_params.h"
+#include "utils/helpers/temposync.h"
+#include "utils/helpers/profiling.h"
+
+// Default PASS 3 saturator precision (see MarsDSP::FasterMath::TanhTier).
+// Set from CMake via CHRONOS_SATURATOR_TIER, e.g. -DCHRONOS_SATURATOR_TIER=Pade54
+// for CPU-bound deployments.
+#ifndef CHRONOS_SATURATOR_TIER
+#define CHRONOS_SATURATOR_TIER Pade76
+#endif
+
+// Default PASS 3 saturator mode. ADAA1 trades one log-cosh + divide per vector
+// for most of the alias rejection of 2-4x oversampling under heavy drive.
+#ifndef CHRONOS_SATURATOR_MODE
+#define CHRONOS_SATURATOR_MODE Memoryless
+#endif
 
 namespace MarsDSP::DSP {
-    template<typename SampleType, int N_BLOCK = 4112>
+    enum class SaturatorMode
+    {
+        Memoryless,     // fasterTanhTiered<SaturatorTier>, no state
+        ADAA1           // first-order antiderivative anti-aliasing, see TanhADAA1
+    };
+
+    template<typename SampleType, int N_BLOCK = 4112,
+             TanhTier SaturatorTier = TanhTier::CHRONOS_SATURATOR_TIER,
+             SaturatorMode SatMode  = SaturatorMode::CHRONOS_SATURATOR_MODE>
     class DelayEngine {
     public:
         DelayEngine() = default;
 
+        // longest block process() takes; the scratch arrays hold N_BLOCK
+        // with room for the interpolator's tail
+        static constexpr int maxBlockSize() noexcept { return N_BLOCK - 8; }
+
+        // longest read-head distance the fixed ring buffer holds; a delay
+        // time past this at the running sample rate reads a wrapped distance
+        static constexpr int maxDelaySamples() noexcept { return kBufSize - 1; }
+
         void AllocBuffer() noexcept
         {
             if (bufferL.size() < static_cast<size_t>(kBufSize + kTail))
@@ -54,22 +93,43 @@ namespace MarsDSP::DSP {
         void reset() noexcept
         {
             writeIdxL = writeIdxR = 0;
-            prevPos   = SampleType(0);
             duckGain  = SampleType(1);
             if (!bufferL.empty()) std::fill(bufferL.begin(), bufferL.end(), SampleType(0));
             if (!bufferR.empty()) std::fill(bufferR.begin(), bufferR.end(), SampleType(0));
+            for (auto& h : history)
+                h.clear();
 
             // snap smoothers so the first block after reset doesn't ramp from 0.
-            lMix.instantize(std::clamp(mix,       0.0f, 1.0f));
-            lFbL.instantize(std::clamp(feedbackL, 0.0f, 0.99f));
-            lFbR.instantize(std::clamp(feedbackR, 0.0f, 0.99f));
-            lCrossfeed.instantize(std::clamp(crossfeed, 0.0f, 1.0f));
-            lagDelayMs.newValue(std::clamp(delayTime, minDelayTime, maxDelayTime));
-            lagDelayMs.instantize();
+            smoothers.snap(kSmMix,       mix);
+            smoothers.snap(kSmFbL,       feedbackL);
+            smoothers.snap(kSmFbR,       feedbackR);
+            smoothers.snap(kSmCrossfeed, crossfeed);
+            smoothers.snap(kSmDelayMs,   std::clamp(delayTime, minDelayTime, maxDelayTime));
+            smoothers.snap(kSmLowCut,    lowCutHz);
+            smoothers.snap(kSmHighCut,   highCutHz);
+            // and the duck sees no motion: the head starts where it is
+            prevPos = delayMsToPos(delayTime, 0);
 
             // Clear biquad state on reset.
             fbLP_L.reset(); fbLP_R.reset();
             fbHP_L.reset(); fbHP_R.reset();
+
+            // ADAA saturators carry one sample of input history.
+            satWriteL.reset(); satOutL.reset();
+            satWriteR.reset(); satOutR.reset();
+
+            // Modulation restarts from phase 0, R feedback a quarter cycle ahead.
+            modLfo.reset();
+            modLfo.setPhase(kModFbR, kModStereoOffset);
+            modDelayOffsetMs = 0.0f;
+            std::fill(std::begin(modLfoFrom), std::end(modLfoFrom), 0.0f);
+            std::fill(std::begin(modLfoTo),   std::end(modLfoTo),   0.0f);
+
+            // jump mode: one head at the current time, no fade in progress
+            jumpHeadMs    = std::clamp(delayTime, minDelayTime, maxDelayTime);
+            jumpFromMs    = jumpHeadMs;
+            jumpFadeTotal = 0;
+            jumpFadeDone  = 0;
         }
 
         void prepare(const dsp::ProcessSpec &spec) noexcept
@@ -78,13 +138,17 @@ namespace MarsDSP::DSP {
             AllocBuffer();
 
             // 10ms attack, 100ms release for ducking response
-            duckAtkCoeff = static_cast<SampleType>(1.0 - std::exp(-1.0 / (0.010 * sampleRate)));
-            duckRelCoeff = static_cast<SampleType>(1.0 - std::exp(-1.0 / (0.100 * sampleRate)));
+            const float fs = static_cast<float>(sampleRate);
+            duckAtkCoeff = static_cast<SampleType>(1.0f - fasterExp(-1.0f / (0.010f * fs)));
+            duckRelCoeff = static_cast<SampleType>(1.0f - fasterExp(-1.0f / (0.100f * fs)));
+
+            smoothers.setLagMs(kSmDelayMs, kDelayLagMs, sampleRate);
+            endCrossRamp();
 
-            lagDelayMs.setRateInMilliseconds(150.0, sampleRate, 1.0);
+            modLfo.prepare(sampleRate);
 
             // Initial filter coefficients.
-            updateFilterCoeffs();
+            updateFilterCoeffs(lowCutHz, highCutHz);
             lastLowCutHz  = lowCutHz;
             lastHighCutHz = highCutHz;
 
@@ -96,46 +160,150 @@ namespace MarsDSP::DSP {
             if (bypassed)
                 return;
 
+            CHRONOS_ENGINE_ZONE("DelayEngine::process");
+            CHRONOS_ENGINE_NS_PER_SAMPLE("Engine ns/sample", numSamples);
+
+            beginHostBlock(numSamples);
+            renderSubBlock(block, numSamples);
+            endHostBlock(numSamples);
+        }
+
+    private:
+        // Once per host block, however many event sub-blocks render it:
+        // advances the LFOs to the block end, and steps the duck envelope on
+        // the knob-driven head motion over the whole block, so neither runs
+        // faster when automation splits the block.
+        void beginHostBlock(const int numSamples) noexcept
+        {
+            hostBlockSamples = numSamples;
+            hostBlockDone    = 0;
+
+            // LFO values at both ends of the block; sub-blocks ramp between
+            // them, so modulation is linear within a block like every other param.
+            for (const int i : { kModDelay, kModFbL, kModFbR })
+                modLfoFrom[i] = modLfoTo[i];
+            updateModulation(numSamples);
+            for (const int i : { kModDelay, kModFbL, kModFbR })
+                modLfoTo[i] = modLfo.value(i);
+
+            // duck on where the lag will be at the end of the block against
+            // where it was at the end of the last one. Only knob-driven motion
+            // ducks; LFO motion is the intended effect, and a jump is already
+            // hidden by its fade.
+            if (delayMode == DelayTimeMode::Jump)
+            {
+                updateDuckGain(SampleType(0));
+            }
+            else
+            {
+                const float lagEnd = smoothers.projectEnd(kSmDelayMs, std::clamp(delayTime, minDelayTime, maxDelayTime), numSamples);
+                updateDuckGain(std::abs(delayMsToPos(lagEnd, numSamples) - prevPos));
+            }
+            CHRONOS_ENGINE_PLOT("Duck gain", duckGain);
+        }
+
+        void endHostBlock(const int numSamples) noexcept
+        {
+            const float headMs = delayMode == DelayTimeMode::Jump ? jumpHeadMs : smoothers.getCurrent(kSmDelayMs);
+            prevPos = delayMsToPos(headMs, numSamples);
+
+            if (crossRampSamplesLeft > 0 && (crossRampSamplesLeft -= numSamples) <= 0)
+                endCrossRamp();
+        }
+
+        // LFO lane at the end of the next numSamples of the host block; 1 at
+        // the block end exactly, so an unsplit block reads modLfoTo as is
+        [[nodiscard]] float modLfoAfter(const int lfo, const int numSamples) const noexcept
+        {
+            const float t = static_cast<float>(hostBlockDone + numSamples) / static_cast<float>(std::max(hostBlockSamples, 1));
+            return modLfoTo[lfo] + (modLfoFrom[lfo] - modLfoTo[lfo]) * (1.0f - t);
+        }
+
+        // read-head distance in samples, never inside the block being written
+        [[nodiscard]] SampleType delayMsToPos(const float ms, const int numSamples) const noexcept
+        {
+            const auto pos = static_cast<SampleType>(sampleRate * (std::clamp(ms, minDelayTime, maxDelayTime) * 0.001));
+            return std::max(pos, static_cast<SampleType>(numSamples + 1));
+        }
+
+        // The sample work for numSamples of the current host block: smoother
+        // ramps, reads, filters, feedback and the write. Runs once per
+        // sub-block, between beginHostBlock and endHostBlock.
+        void renderSubBlock(const dsp::AudioBlock<SampleType> &block, const int numSamples) noexcept
+        {
             const size_t numCh = block.getNumChannels();
             auto *ch0 = numCh > 0 ? block.getChannelPointer(0) : nullptr;
             auto *ch1 = numCh > 1 ? block.getChannelPointer(1) : nullptr;
-
-            // push targets into block-rate linear ramp smoothers
-            // SIMD inner loops consume per-quad vectors via .quad(q).
-            lMix.setTarget(std::clamp(mix,       0.0f, 1.0f),  numSamples);
-            lFbL.setTarget(std::clamp(feedbackL, 0.0f, 0.99f), numSamples);
-            lFbR.setTarget(std::clamp(feedbackR, 0.0f, 0.99f), numSamples);
-            lCrossfeed.setTarget(std::clamp(crossfeed, 0.0f, 1.0f), numSamples);
-
-            // Recompute feedback-path filter coefficients only when cutoffs change.
-            if (lowCutHz != lastLowCutHz || highCutHz != lastHighCutHz)
+            const int historyStartL = writeIdxL;
+            const int historyStartR = writeIdxR;
+
+            const float fbScaleL = 1.0f + modFeedbackDepth * modLfoAfter(kModFbL, numSamples);
+            const float fbScaleR = 1.0f + modFeedbackDepth * modLfoAfter(kModFbR, numSamples);
+
+            // push targets into the smoother bank; one beginBlock ramps them all
+            // and the SIMD inner loops read per-quad vectors via Ramp::quad(vQ).
+            constexpr auto fbRange = paramRange(EngineParam::Feedback);
+            smoothers.setTarget(kSmMix,       mix);
+            smoothers.setTarget(kSmFbL,       fbRange.clamp(feedbackL * fbScaleL));
+            smoothers.setTarget(kSmFbR,       fbRange.clamp(feedbackR * fbScaleR));
+            smoothers.setTarget(kSmCrossfeed, crossfeed);
+            smoothers.setTarget(kSmDelayMs,   std::clamp(delayTime, minDelayTime, maxDelayTime));
+            smoothers.setTarget(kSmLowCut,    lowCutHz);
+            smoothers.setTarget(kSmHighCut,   highCutHz);
+            smoothers.beginBlock(numSamples);
+
+            // Recompute feedback-path filter coefficients only when cutoffs
+            // change. Linear lanes land on the knob value in one block; during
+            // a cross-ramp they glide, so this runs once per block until then.
+            const float lowCutEnd  = smoothers.getBlockEnd(kSmLowCut);
+            const float highCutEnd = smoothers.getBlockEnd(kSmHighCut);
+            if (lowCutEnd != lastLowCutHz || highCutEnd != lastHighCutHz)
             {
-                updateFilterCoeffs();
-                lastLowCutHz  = lowCutHz;
-                lastHighCutHz = highCutHz;
+                updateFilterCoeffs(lowCutEnd, highCutEnd);
+                lastLowCutHz  = lowCutEnd;
+                lastHighCutHz = highCutEnd;
             }
 
-            const float delayMsOld = lagDelayMs.getValue();
-            lagDelayMs.newValue(std::clamp(delayTime, minDelayTime, maxDelayTime));
-            lagDelayMs.processN(numSamples);
-            const float delayMsNew = lagDelayMs.getValue();
+            // LFO offset goes on after the lag: the 150 ms smoother is there to
+            // glide knob moves and would flatten anything faster than ~1 Hz.
+            const float lagMsOld = smoothers.getCurrent(kSmDelayMs);
+            const float lagMsNew = smoothers.getBlockEnd(kSmDelayMs);
+
+            const float modOffsetOld = modDelayOffsetMs;
+            modDelayOffsetMs = modDepthMs * modLfoAfter(kModDelay, numSamples);
+
+            // PASS 1 reads two heads, O and N, and blends them with alpha
+            // running from alphaStart to alphaEnd across the block. Glide puts
+            // O at the block-start time and N at the block-end time; jump
+            // mode moves the blend across blocks for the length of a fade.
+            float headMsOld  = lagMsOld + modOffsetOld;
+            float headMsNew  = lagMsNew + modDelayOffsetMs;
+            float alphaStart = 0.0f;
+            float alphaEnd   = 1.0f;
+            if (delayMode == DelayTimeMode::Jump)
+                advanceJump(numSamples, modOffsetOld, headMsOld, headMsNew, alphaStart, alphaEnd);
+
+            const float delayMsOld = std::clamp(headMsOld, minDelayTime, maxDelayTime);
+            const float delayMsNew = std::clamp(headMsNew, minDelayTime, maxDelayTime);
 
             const size_t numSamplesSize = static_cast<size_t>(numSamples);
-            assert(numSamplesSize <= N_BLOCK - 8);
+            assert(numSamplesSize <= static_cast<size_t>(maxBlockSize()));
 
-            auto msToPos = [&](float ms) {
-                const auto s = static_cast<SampleType>(sampleRate * (ms * 0.001));
-                return std::max(s, static_cast<SampleType>(numSamplesSize + 1));
-            };
-            const SampleType posOld = msToPos(delayMsOld);
-            const SampleType posNew = msToPos(delayMsNew);
+            const SampleType posOld = delayMsToPos(delayMsOld, numSamples);
+            const SampleType posNew = delayMsToPos(delayMsNew, numSamples);
 
             const int offsetOld = static_cast<int>(std::floor(static_cast<double>(posOld)));
             const int offsetNew = static_cast<int>(std::floor(static_cast<double>(posNew)));
             const SampleType fracOld = posOld - static_cast<SampleType>(offsetOld);
             const SampleType fracNew = posNew - static_cast<SampleType>(offsetNew);
 
+            // Both heads on the same spot blend to exactly N, so in steady
+            // state (settled time, no delay modulation, no fade) PASS 1 reads
+            // and interpolates one head instead of two.
+            const bool singleHead = offsetOld == offsetNew && fracOld == fracNew;
+
             // Dual scratch pre-read (memcpy with tail-mirror trick from earlier design).
+            CHRONOS_ENGINE_ZONE_BEGIN(zPreRead, "pre-read");
             const int total = static_cast<int>(numSamplesSize) + kTail;
             auto readScratch = [&](const std::vector<SampleType>& src,
                                    SampleType* dst, int rpos) {
@@ -145,14 +313,17 @@ namespace MarsDSP::DSP {
                     std::memcpy(dst + first, &src[kTail], (total - first) * sizeof(SampleType));
             };
 
-            readScratch(bufferL, tL,  (writeIdxL - offsetNew) & kBufMask);
-            readScratch(bufferL, tL2, (writeIdxL - offsetOld) & kBufMask);
+            readScratch(bufferL, tL, (writeIdxL - offsetNew) & kBufMask);
+            if (!singleHead)
+                readScratch(bufferL, tL2, (writeIdxL - offsetOld) & kBufMask);
 
             if (!isMono() && ch1 != nullptr)
             {
-                readScratch(bufferR, tR,  (writeIdxR - offsetNew) & kBufMask);
-                readScratch(bufferR, tR2, (writeIdxR - offsetOld) & kBufMask);
+                readScratch(bufferR, tR, (writeIdxR - offsetNew) & kBufMask);
+                if (!singleHead)
+                    readScratch(bufferR, tR2, (writeIdxR - offsetOld) & kBufMask);
             }
+            CHRONOS_ENGINE_ZONE_END(zPreRead);
 
             // Dual Lagrange coefficient set: N for new frac, O for old frac.
             auto computeCoeffs = [](SampleType frac, LagrangeCoeffs& c) {
@@ -175,77 +346,72 @@ namespace MarsDSP::DSP {
             computeCoeffs(fracOld, coeffsO);
 
             // SIMD broadcast of both coefficient sets (N = new, O = old).
-            const auto vC1N = SIMD_MM(set1_ps)(coeffsN.c[0]);
-            const auto vC2N = SIMD_MM(set1_ps)(coeffsN.c[1]);
-            const auto vC3N = SIMD_MM(set1_ps)(coeffsN.c[2]);
-            const auto vC4N = SIMD_MM(set1_ps)(coeffsN.c[3]);
-            const auto vC5N = SIMD_MM(set1_ps)(coeffsN.c[4]);
-            const auto vC6N = SIMD_MM(set1_ps)(coeffsN.c[5]);
-            const auto vFracN = SIMD_MM(set1_ps)(fracNew);
-
-            const auto vC1O = SIMD_MM(set1_ps)(coeffsO.c[0]);
-            const auto vC2O = SIMD_MM(set1_ps)(coeffsO.c[1]);
-            const auto vC3O = SIMD_MM(set1_ps)(coeffsO.c[2]);
-            const auto vC4O = SIMD_MM(set1_ps)(coeffsO.c[3]);
-            const auto vC5O = SIMD_MM(set1_ps)(coeffsO.c[4]);
-            const auto vC6O = SIMD_MM(set1_ps)(coeffsO.c[5]);
-            const auto vFracO = SIMD_MM(set1_ps)(fracOld);
-
-            // Alpha ramp: 0 at block start, 1 at block end. Applied per SIMD lane.
+            struct QuadCoeffs { SIMD_M128 c[6]; SIMD_M128 frac; };
+            auto broadcast = [](const LagrangeCoeffs& c) {
+                QuadCoeffs q;
+                for (int k = 0; k < 6; ++k)
+                    q.c[k] = SIMD_MM(set1_ps)(c.c[k]);
+                q.frac = SIMD_MM(set1_ps)(c.frac);
+                return q;
+            };
+            const QuadCoeffs quadN = broadcast(coeffsN);
+            const QuadCoeffs quadO = broadcast(coeffsO);
+
+            // Alpha ramp: alphaStart at block start, alphaEnd at block end
+            // (0 → 1 unless a jump fade spans blocks). Applied per SIMD lane.
             const float invN = (numSamplesSize > 0)
                                ? 1.0f / static_cast<float>(numSamplesSize) : 0.0f;
-            const auto vInvN    = SIMD_MM(set1_ps)(invN);
-            const auto vLaneIdx = SIMD_MM(setr_ps)(0.0f, 1.0f, 2.0f, 3.0f);
+            const float alphaDelta = (alphaEnd - alphaStart) * invN;
+            const auto vAlphaBase = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(alphaStart),
+                                                    SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(alphaDelta), SIMD_MM(setr_ps)(0.0f, 1.0f, 2.0f, 3.0f)));
+            const auto vAlphaStep = SIMD_MM(set1_ps)(4.0f * alphaDelta);
+
+            // one head through one coefficient set: samples [n, n + 3]
+            auto readQuad = [](const float* t, const size_t n, const QuadCoeffs& q) {
+                auto v0 = SIMD_MM(load_ps) (t + n);
+                auto v1 = SIMD_MM(loadu_ps)(t + n + 1);
+                auto v2 = SIMD_MM(loadu_ps)(t + n + 2);
+                auto v3 = SIMD_MM(loadu_ps)(t + n + 3);
+                auto v4 = SIMD_MM(loadu_ps)(t + n + 4);
+                auto v5 = SIMD_MM(loadu_ps)(t + n + 5);
+                auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, q.c[1]),
+                            SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, q.c[2]),
+                            SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, q.c[3]),
+                            SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, q.c[4]),
+                                            SIMD_MM(mul_ps)(v5, q.c[5])))));
+                return SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, q.c[0]),
+                                       SIMD_MM(mul_ps)(q.frac, vSum));
+            };
 
-            // duck gain update uses the end-of-block position as "current".
-            const SampleType modspeed = std::abs(posNew - prevPos);
-            prevPos = posNew;
-            updateDuckGain(modspeed);
+            const auto vOne = SIMD_MM(set1_ps)(1.0f);    // quad counter step, and 1 - mix in PASS 3
+
+            // set once per host block in beginHostBlock
             const auto vDuckGain = SIMD_MM(set1_ps)(duckGain);
+            CHRONOS_ENGINE_PLOT("Delay position (samples)", posNew);
 
             if (isMono()) // mono
             {
                 // ---------------- PASS 1: SIMD Lagrange blend → dsL[] ----------------
+                CHRONOS_ENGINE_ZONE_BEGIN(zPass1, "PASS 1");
+                if (singleHead)
                 {
                     size_t n = 0;
                     for (; n + 3 < numSamplesSize; n += 4)
+                        SIMD_MM(store_ps)(&dsL[n], readQuad(tL, n, quadN));
+                    for (; n < numSamplesSize; ++n)
+                        dsL[n] = static_cast<float>(readInterpolated(tL, static_cast<int>(n), coeffsN));
+                }
+                else
+                {
+                    size_t n = 0;
+                    auto vQ = SIMD_MM(setzero_ps)();    // quad counter: q in all lanes, samples [4q, 4q + 3]
+                    for (; n + 3 < numSamplesSize; n += 4, vQ = SIMD_MM(add_ps)(vQ, vOne))
                     {
-                        const auto vNf    = SIMD_MM(set1_ps)(static_cast<float>(n));
-                        const auto vAlpha = SIMD_MM(mul_ps)(vInvN, SIMD_MM(add_ps)(vNf, vLaneIdx));
+                        const auto vAlpha = SIMD_MM(add_ps)(vAlphaBase, SIMD_MM(mul_ps)(vAlphaStep, vQ));
 
-                        SIMD_M128 vYN;
-                        {
-                            auto v0 = SIMD_MM(load_ps) (tL + n);
-                            auto v1 = SIMD_MM(loadu_ps)(tL + n + 1);
-                            auto v2 = SIMD_MM(loadu_ps)(tL + n + 2);
-                            auto v3 = SIMD_MM(loadu_ps)(tL + n + 3);
-                            auto v4 = SIMD_MM(loadu_ps)(tL + n + 4);
-                            auto v5 = SIMD_MM(loadu_ps)(tL + n + 5);
-                            auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, vC2N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, vC3N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, vC4N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, vC5N),
-                                                        SIMD_MM(mul_ps)(v5, vC6N)))));
-                            vYN = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, vC1N),
-                                                  SIMD_MM(mul_ps)(vFracN, vSum));
-                        }
+                        const auto vYN = readQuad(tL, n, quadN);
 
-                        SIMD_M128 vYO;
-                        {
-                            auto v0 = SIMD_MM(load_ps) (tL2 + n);
-                            auto v1 = SIMD_MM(loadu_ps)(tL2 + n + 1);
-                            auto v2 = SIMD_MM(loadu_ps)(tL2 + n + 2);
-                            auto v3 = SIMD_MM(loadu_ps)(tL2 + n + 3);
-                            auto v4 = SIMD_MM(loadu_ps)(tL2 + n + 4);
-                            auto v5 = SIMD_MM(loadu_ps)(tL2 + n + 5);
-                            auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, vC2O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, vC3O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, vC4O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, vC5O),
-                                                        SIMD_MM(mul_ps)(v5, vC6O)))));
-                            vYO = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, vC1O),
-                                                  SIMD_MM(mul_ps)(vFracO, vSum));
-                        }
+                        const auto vYO = readQuad(tL2, n, quadO);
 
                         const auto vDelayedOut = SIMD_MM(add_ps)(vYO,
                                                     SIMD_MM(mul_ps)(vAlpha,
@@ -254,28 +420,35 @@ namespace MarsDSP::DSP {
                     }
                     for (; n < numSamplesSize; ++n)
                     {
-                        const SampleType alpha = static_cast<SampleType>(static_cast<float>(n) * invN);
+                        const SampleType alpha = static_cast<SampleType>(alphaStart + static_cast<float>(n) * alphaDelta);
                         const SampleType yN = readInterpolated(tL,  static_cast<int>(n), coeffsN);
                         const SampleType yO = readInterpolated(tL2, static_cast<int>(n), coeffsO);
                         dsL[n] = static_cast<float>(yO + alpha * (yN - yO));
                     }
                 }
+                CHRONOS_ENGINE_ZONE_END(zPass1);
 
                 // ---------------- PASS 2: scalar HP → LP on dsL[] -------------------
                 // Biquads are stateful so this pass is intrinsically scalar, but it's
                 // a tight sequential loop over ~4KB in L1 so it's cheap.
+                CHRONOS_ENGINE_ZONE_BEGIN(zPass2, "PASS 2");
                 for (size_t k = 0; k < numSamplesSize; ++k)
                     dsL[k] = fbLP_L.processSample(fbHP_L.processSample(dsL[k]));
+                CHRONOS_ENGINE_ZONE_END(zPass2);
 
                 // ---------------- PASS 3: SIMD feedback MAC + dry/wet mix -----------
+                CHRONOS_ENGINE_ZONE_BEGIN(zPass3, "PASS 3");
                 {
+                    const auto rMix = smoothers.ramp(kSmMix);
+                    const auto rFb  = smoothers.ramp(kSmFbL);
+
                     size_t n = 0;
-                    for (; n + 3 < numSamplesSize; n += 4)
+                    auto vQ = SIMD_MM(setzero_ps)();    // quad counter: q in all lanes, samples [4q, 4q + 3]
+                    for (; n + 3 < numSamplesSize; n += 4, vQ = SIMD_MM(add_ps)(vQ, vOne))
                     {
-                        const int q = static_cast<int>(n) >> 2;
-                        const auto vMix         = lMix.quad(q);
-                        const auto vOneMinusMix = SIMD_MM(sub_ps)(SIMD_MM(set1_ps)(1.0f), vMix);
-                        const auto vFb          = lFbL.quad(q);
+                        const auto vMix         = rMix.quad(vQ);
+                        const auto vOneMinusMix = SIMD_MM(sub_ps)(vOne, vMix);
+                        const auto vFb          = rFb.quad(vQ);
 
                         auto vMonoSum = SIMD_MM(setzero_ps)();
                         if (ch0 != nullptr && ch1 != nullptr)
@@ -288,11 +461,11 @@ namespace MarsDSP::DSP {
                         const auto vFiltered  = SIMD_MM(load_ps)(&dsL[n]);
                         const auto vDuckedOut = SIMD_MM(mul_ps)(vFiltered, vDuckGain);
 
-                        auto vWriteVal = fasterTanhBounded(
+                        auto vWriteVal = satWriteL.process(
                             SIMD_MM(add_ps)(vMonoSum, SIMD_MM(mul_ps)(vFb, vDuckedOut)));
                         SIMD_MM(storeu_ps)(&wL[n], vWriteVal);
 
-                        auto vOut = fasterTanhBounded(
+                        auto vOut = satOutL.process(
                             SIMD_MM(add_ps)(SIMD_MM(mul_ps)(vDuckedOut, vMix),
                                             SIMD_MM(mul_ps)(vMonoSum,   vOneMinusMix)));
 
@@ -301,9 +474,9 @@ namespace MarsDSP::DSP {
                     }
                     for (; n < numSamplesSize; ++n)
                     {
-                        const SampleType mixP       = static_cast<SampleType>(lMix.at(static_cast<int>(n)));
+                        const SampleType mixP       = static_cast<SampleType>(smoothers.at(kSmMix, static_cast<int>(n)));
                         const SampleType oneMinusMx = static_cast<SampleType>(1) - mixP;
-                        const SampleType fbP        = static_cast<SampleType>(lFbL.at(static_cast<int>(n)));
+                        const SampleType fbP        = static_cast<SampleType>(smoothers.at(kSmFbL, static_cast<int>(n)));
 
                         SampleType monoSum = ch0 != nullptr ? ch0[n] : static_cast<SampleType>(0);
                         if (ch1 != nullptr)
@@ -311,14 +484,16 @@ namespace MarsDSP::DSP {
 
                         const SampleType duckedOut = static_cast<SampleType>(dsL[n]) * duckGain;
 
-                        wL[n] = softClip(monoSum + fbP * duckedOut);
-                        const SampleType out = softClip(duckedOut * mixP + monoSum * oneMinusMx);
+                        wL[n] = satWriteL.process(monoSum + fbP * duckedOut);
+                        const SampleType out = satOutL.process(duckedOut * mixP + monoSum * oneMinusMx);
 
                         if (ch0 != nullptr) ch0[n] = out;
                         if (ch1 != nullptr) ch1[n] = out;
                     }
                 }
+                CHRONOS_ENGINE_ZONE_END(zPass3);
 
+                CHRONOS_ENGINE_ZONE_BEGIN(zWrite, "write/mirror");
                 // Block write & Mirror
                 const bool wrapped = (writeIdxL + static_cast<int>(numSamplesSize)) > kBufSize;
                 if (wrapped)
@@ -347,88 +522,45 @@ namespace MarsDSP::DSP {
                         bufferR[kBufSize + k] = bufferR[k];
                     }
                 }
+                CHRONOS_ENGINE_ZONE_END(zWrite);
             }
             else // stereo
             {
                 // ---------------- PASS 1: SIMD fill dsL[] and dsR[] ----------------
+                CHRONOS_ENGINE_ZONE_BEGIN(zPass1, "PASS 1");
+                if (singleHead)
                 {
                     size_t n = 0;
                     for (; n + 3 < numSamplesSize; n += 4)
                     {
-                        const auto vNf    = SIMD_MM(set1_ps)(static_cast<float>(n));
-                        const auto vAlpha = SIMD_MM(mul_ps)(vInvN, SIMD_MM(add_ps)(vNf, vLaneIdx));
+                        SIMD_MM(store_ps)(&dsL[n], readQuad(tL, n, quadN));
+                        SIMD_MM(store_ps)(&dsR[n], readQuad(tR, n, quadN));
+                    }
+                    for (; n < numSamplesSize; ++n)
+                    {
+                        dsL[n] = static_cast<float>(readInterpolated(tL, static_cast<int>(n), coeffsN));
+                        dsR[n] = static_cast<float>(readInterpolated(tR, static_cast<int>(n), coeffsN));
+                    }
+                }
+                else
+                {
+                    size_t n = 0;
+                    auto vQ = SIMD_MM(setzero_ps)();    // quad counter: q in all lanes, samples [4q, 4q + 3]
+                    for (; n + 3 < numSamplesSize; n += 4, vQ = SIMD_MM(add_ps)(vQ, vOne))
+                    {
+                        const auto vAlpha = SIMD_MM(add_ps)(vAlphaBase, SIMD_MM(mul_ps)(vAlphaStep, vQ));
 
                         // L: Lagrange N + O, blend → dsL[n..n+3]
-                        SIMD_M128 vYL_N;
-                        {
-                            auto v0 = SIMD_MM(load_ps) (tL + n);
-                            auto v1 = SIMD_MM(loadu_ps)(tL + n + 1);
-                            auto v2 = SIMD_MM(loadu_ps)(tL + n + 2);
-                            auto v3 = SIMD_MM(loadu_ps)(tL + n + 3);
-                            auto v4 = SIMD_MM(loadu_ps)(tL + n + 4);
-                            auto v5 = SIMD_MM(loadu_ps)(tL + n + 5);
-                            auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, vC2N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, vC3N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, vC4N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, vC5N),
-                                                        SIMD_MM(mul_ps)(v5, vC6N)))));
-                            vYL_N = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, vC1N),
-                                                    SIMD_MM(mul_ps)(vFracN, vSum));
-                        }
-                        SIMD_M128 vYL_O;
-                        {
-                            auto v0 = SIMD_MM(load_ps) (tL2 + n);
-                            auto v1 = SIMD_MM(loadu_ps)(tL2 + n + 1);
-                            auto v2 = SIMD_MM(loadu_ps)(tL2 + n + 2);
-                            auto v3 = SIMD_MM(loadu_ps)(tL2 + n + 3);
-                            auto v4 = SIMD_MM(loadu_ps)(tL2 + n + 4);
-                            auto v5 = SIMD_MM(loadu_ps)(tL2 + n + 5);
-                            auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, vC2O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, vC3O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, vC4O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, vC5O),
-                                                        SIMD_MM(mul_ps)(v5, vC6O)))));
-                            vYL_O = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, vC1O),
-                                                    SIMD_MM(mul_ps)(vFracO, vSum));
-                        }
+                        const auto vYL_N = readQuad(tL, n, quadN);
+                        const auto vYL_O = readQuad(tL2, n, quadO);
                         const auto vDelL = SIMD_MM(add_ps)(vYL_O,
                                               SIMD_MM(mul_ps)(vAlpha,
                                                               SIMD_MM(sub_ps)(vYL_N, vYL_O)));
                         SIMD_MM(store_ps)(&dsL[n], vDelL);
 
                         // R: Lagrange N + O, blend → dsR[n..n+3]
-                        SIMD_M128 vYR_N;
-                        {
-                            auto v0 = SIMD_MM(load_ps) (tR + n);
-                            auto v1 = SIMD_MM(loadu_ps)(tR + n + 1);
-                            auto v2 = SIMD_MM(loadu_ps)(tR + n + 2);
-                            auto v3 = SIMD_MM(loadu_ps)(tR + n + 3);
-                            auto v4 = SIMD_MM(loadu_ps)(tR + n + 4);
-                            auto v5 = SIMD_MM(loadu_ps)(tR + n + 5);
-                            auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, vC2N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, vC3N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, vC4N),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, vC5N),
-                                                        SIMD_MM(mul_ps)(v5, vC6N)))));
-                            vYR_N = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, vC1N),
-                                                    SIMD_MM(mul_ps)(vFracN, vSum));
-                        }
-                        SIMD_M128 vYR_O;
-                        {
-                            auto v0 = SIMD_MM(load_ps) (tR2 + n);
-                            auto v1 = SIMD_MM(loadu_ps)(tR2 + n + 1);
-                            auto v2 = SIMD_MM(loadu_ps)(tR2 + n + 2);
-                            auto v3 = SIMD_MM(loadu_ps)(tR2 + n + 3);
-                            auto v4 = SIMD_MM(loadu_ps)(tR2 + n + 4);
-                            auto v5 = SIMD_MM(loadu_ps)(tR2 + n + 5);
-                            auto vSum = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v1, vC2O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v2, vC3O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v3, vC4O),
-                                        SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v4, vC5O),
-                                                        SIMD_MM(mul_ps)(v5, vC6O)))));
-                            vYR_O = SIMD_MM(add_ps)(SIMD_MM(mul_ps)(v0, vC1O),
-                                                    SIMD_MM(mul_ps)(vFracO, vSum));
-                        }
+                        const auto vYR_N = readQuad(tR, n, quadN);
+                        const auto vYR_O = readQuad(tR2, n, quadO);
                         const auto vDelR = SIMD_MM(add_ps)(vYR_O,
                                               SIMD_MM(mul_ps)(vAlpha,
                                                               SIMD_MM(sub_ps)(vYR_N, vYR_O)));
@@ -436,7 +568,7 @@ namespace MarsDSP::DSP {
                     }
                     for (; n < numSamplesSize; ++n)
                     {
-                        const SampleType alpha = static_cast<SampleType>(static_cast<float>(n) * invN);
+                        const SampleType alpha = static_cast<SampleType>(alphaStart + static_cast<float>(n) * alphaDelta);
                         const SampleType yLN = readInterpolated(tL,  static_cast<int>(n), coeffsN);
                         const SampleType yLO = readInterpolated(tL2, static_cast<int>(n), coeffsO);
                         const SampleType yRN = readInterpolated(tR,  static_cast<int>(n), coeffsN);
@@ -445,41 +577,49 @@ namespace MarsDSP::DSP {
                         dsR[n] = static_cast<float>(yRO + alpha * (yRN - yRO));
                     }
                 }
+                CHRONOS_ENGINE_ZONE_END(zPass1);
 
                 // ---------------- PASS 2: scalar filter + crossfeed blend ----------
                 // Each sample: HP → LP per channel, then blend the two filtered
                 // signals with the smoothed crossfeed amount to form the feedback
                 // input. This is the ping-pong path.
+                CHRONOS_ENGINE_ZONE_BEGIN(zPass2, "PASS 2");
                 for (size_t k = 0; k < numSamplesSize; ++k)
                 {
                     const float filtL = fbLP_L.processSample(fbHP_L.processSample(dsL[k]));
                     const float filtR = fbLP_R.processSample(fbHP_R.processSample(dsR[k]));
-                    const float cf    = lCrossfeed.at(static_cast<int>(k));
+                    const float cf    = smoothers.at(kSmCrossfeed, static_cast<int>(k));
                     const float cfInv = 1.0f - cf;
                     dsL[k] = cfInv * filtL + cf * filtR;
                     dsR[k] = cfInv * filtR + cf * filtL;
                 }
+                CHRONOS_ENGINE_ZONE_END(zPass2);
 
                 // ---------------- PASS 3: SIMD feedback MAC + dry/wet mix ---------
+                CHRONOS_ENGINE_ZONE_BEGIN(zPass3, "PASS 3");
                 {
+                    const auto rMix = smoothers.ramp(kSmMix);
+                    const auto rFbL = smoothers.ramp(kSmFbL);
+                    const auto rFbR = smoothers.ramp(kSmFbR);
+
                     size_t n = 0;
-                    for (; n + 3 < numSamplesSize; n += 4)
+                    auto vQ = SIMD_MM(setzero_ps)();    // quad counter: q in all lanes, samples [4q, 4q + 3]
+                    for (; n + 3 < numSamplesSize; n += 4, vQ = SIMD_MM(add_ps)(vQ, vOne))
                     {
-                        const int q = static_cast<int>(n) >> 2;
-                        const auto vMix         = lMix.quad(q);
-                        const auto vOneMinusMix = SIMD_MM(sub_ps)(SIMD_MM(set1_ps)(1.0f), vMix);
+                        const auto vMix         = rMix.quad(vQ);
+                        const auto vOneMinusMix = SIMD_MM(sub_ps)(vOne, vMix);
 
                         if (ch0 != nullptr)
                         {
-                            const auto vFbL = lFbL.quad(q);
+                            const auto vFbL = rFbL.quad(vQ);
                             auto vXL = SIMD_MM(loadu_ps)(ch0 + n);
                             auto vYL_ducked = SIMD_MM(mul_ps)(SIMD_MM(load_ps)(&dsL[n]), vDuckGain);
 
-                            auto vWriteValL = fasterTanhBounded(
+                            auto vWriteValL = satWriteL.process(
                                 SIMD_MM(add_ps)(vXL, SIMD_MM(mul_ps)(vFbL, vYL_ducked)));
                             SIMD_MM(storeu_ps)(&wL[n], vWriteValL);
 
-                            auto vOutL = fasterTanhBounded(
+                            auto vOutL = satOutL.process(
                                 SIMD_MM(add_ps)(SIMD_MM(mul_ps)(vYL_ducked, vMix),
                                                 SIMD_MM(mul_ps)(vXL,        vOneMinusMix)));
                             SIMD_MM(storeu_ps)(ch0 + n, vOutL);
@@ -487,15 +627,15 @@ namespace MarsDSP::DSP {
 
                         if (ch1 != nullptr)
                         {
-                            const auto vFbR = lFbR.quad(q);
+                            const auto vFbR = rFbR.quad(vQ);
                             auto vXR = SIMD_MM(loadu_ps)(ch1 + n);
                             auto vYR_ducked = SIMD_MM(mul_ps)(SIMD_MM(load_ps)(&dsR[n]), vDuckGain);
 
-                            auto vWriteValR = fasterTanhBounded(
+                            auto vWriteValR = satWriteR.process(
                                 SIMD_MM(add_ps)(vXR, SIMD_MM(mul_ps)(vFbR, vYR_ducked)));
                             SIMD_MM(storeu_ps)(&wR[n], vWriteValR);
 
-                            auto vOutR = fasterTanhBounded(
+                            auto vOutR = satOutR.process(
                                 SIMD_MM(add_ps)(SIMD_MM(mul_ps)(vYR_ducked, vMix),
                                                 SIMD_MM(mul_ps)(vXR,        vOneMinusMix)));
                             SIMD_MM(storeu_ps)(ch1 + n, vOutR);
@@ -503,28 +643,30 @@ namespace MarsDSP::DSP {
                     }
                     for (; n < numSamplesSize; ++n)
                     {
-                        const SampleType mixP       = static_cast<SampleType>(lMix.at(static_cast<int>(n)));
+                        const SampleType mixP       = static_cast<SampleType>(smoothers.at(kSmMix, static_cast<int>(n)));
                         const SampleType oneMinusMx = static_cast<SampleType>(1) - mixP;
 
                         if (ch0 != nullptr)
                         {
-                            const SampleType fbLP = static_cast<SampleType>(lFbL.at(static_cast<int>(n)));
+                            const SampleType fbLP = static_cast<SampleType>(smoothers.at(kSmFbL, static_cast<int>(n)));
                             const SampleType xL   = ch0[n];
                             const SampleType yL_ducked = static_cast<SampleType>(dsL[n]) * duckGain;
-                            wL[n]  = softClip(xL + fbLP * yL_ducked);
-                            ch0[n] = softClip(yL_ducked * mixP + xL * oneMinusMx);
+                            wL[n]  = satWriteL.process(xL + fbLP * yL_ducked);
+                            ch0[n] = satOutL.process(yL_ducked * mixP + xL * oneMinusMx);
                         }
                         if (ch1 != nullptr)
                         {
-                            const SampleType fbRP = static_cast<SampleType>(lFbR.at(static_cast<int>(n)));
+                            const SampleType fbRP = static_cast<SampleType>(smoothers.at(kSmFbR, static_cast<int>(n)));
                             const SampleType xR   = ch1[n];
                             const SampleType yR_ducked = static_cast<SampleType>(dsR[n]) * duckGain;
-                            wR[n]  = softClip(xR + fbRP * yR_ducked);
-                            ch1[n] = softClip(yR_ducked * mixP + xR * oneMinusMx);
+                            wR[n]  = satWriteR.process(xR + fbRP * yR_ducked);
+                            ch1[n] = satOutR.process(yR_ducked * mixP + xR * oneMinusMx);
                         }
                     }
                 }
+                CHRONOS_ENGINE_ZONE_END(zPass3);
 
+                CHRONOS_ENGINE_ZONE_BEGIN(zWrite, "write/mirror");
                 // Block write & Mirror L
                 if (ch0 != nullptr) {
                     const int oldIdxL = writeIdxL;
@@ -558,13 +700,93 @@ namespace MarsDSP::DSP {
                             bufferR[kBufSize + k] = bufferR[k];
                     }
                 }
+                CHRONOS_ENGINE_ZONE_END(zWrite);
+            }
+
+            // whatever this block wrote, per channel (a channel without a
+            // pointer wrote nothing)
+            if (historyEnabled)
+            {
+                CHRONOS_ENGINE_ZONE("history");
+                history[0].update(bufferL.data(), historyStartL, (writeIdxL - historyStartL) & kBufMask);
+                history[1].update(bufferR.data(), historyStartR, (writeIdxR - historyStartR) & kBufMask);
+            }
+
+            // advance block-rate ramps so next block starts from this block's end
+            smoothers.endBlock();
+            hostBlockDone += numSamples;
+        }
+
+    public:
+
+        // ------------------------------------------------------------------
+        // Sample-accurate automation
+        // ------------------------------------------------------------------
+        // Renders the block in sub-blocks between event offsets, so every
+        // smoother ramps to the new value from the point the event asked
+        // for instead of from the block start. Split points are rounded down
+        // to a multiple of 4 so every sub-block but the last stays whole
+        // quads for the SIMD passes; events sharing a quad apply together,
+        // at most 3 samples early. Events must be sorted by sampleOffset;
+        // offsets past the block apply after it. The LFOs, the duck and the
+        // cross-ramp countdown still step once for the whole block.
+        void process(const dsp::AudioBlock<SampleType> &block, const int numSamples,
+                     const ParamEvent* events, const int numEvents) noexcept
+        {
+            int next = 0;
+            if (!bypassed)
+            {
+                CHRONOS_ENGINE_ZONE("DelayEngine::process");
+                CHRONOS_ENGINE_NS_PER_SAMPLE("Engine ns/sample", numSamples);
+
+                beginHostBlock(numSamples);
+                int start = 0;
+                while (start < numSamples)
+                {
+                    for (; next < numEvents && (events[next].sampleOffset & ~3) <= start; ++next)
+                        setParam(events[next].param, events[next].value);
+
+                    const int end = next < numEvents
+                                  ? std::min(events[next].sampleOffset & ~3, numSamples)
+                                  : numSamples;
+                    renderSubBlock(block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(end - start)), end - start);
+                    start = end;
+                }
+                endHostBlock(numSamples);
+            }
+            for (; next < numEvents; ++next)
+                setParam(events[next].param, events[next].value);
+        }
+
+        void setParam(const EngineParam param, const float value) noexcept
+        {
+            switch (param)
+            {
+                case EngineParam::DelayTime:   setDelayTimeParam(value);   break;
+                case EngineParam::Mix:         setMixParam(value);         break;
+                case EngineParam::Feedback:    setFeedbackParam(value);    break;
+                case EngineParam::LowCut:      setLowCutParam(value);      break;
+                case EngineParam::HighCut:     setHighCutParam(value);     break;
+                case EngineParam::Crossfeed:   setCrossfeedParam(value);   break;
+                case EngineParam::ModRate:     setModRateParam(value);     break;
+                case EngineParam::ModDepth:    setModDepthParam(value);    break;
+                case EngineParam::ModFeedback: setModFeedbackParam(value); break;
+                case EngineParam::Count:                                   break;
             }
+        }
 
-            // advance block-rate ramps so next block starts from this block's target
-            lMix.advanceBlock();
-            lFbL.advanceBlock();
-            lFbR.advanceBlock();
-            lCrossfeed.advanceBlock();
+        // Glide every smoothed parameter (mix, feedback, crossfeed, filter
+        // cutoffs, delay time) to whatever is set next over `milliseconds`
+        // instead of one block, with the buffers left running. Meant for
+        // preset switches: call it, then the setters. After the ramp the lanes
+        // return to their usual behaviour; the residual gap is e^-2π (~0.2%).
+        void startCrossRamp(const float milliseconds) noexcept
+        {
+            const double ms = std::max(static_cast<double>(milliseconds), 1.0);
+            for (const int p : kCrossRampLanes)
+                smoothers.setLagMs(p, ms, sampleRate);
+            smoothers.setLagMs(kSmDelayMs, ms, sampleRate);
+            crossRampSamplesLeft = static_cast<int>(ms * 0.001 * sampleRate) + 1;
         }
 
         void setDelayTimeParam(const float milliseconds) noexcept
@@ -572,19 +794,48 @@ namespace MarsDSP::DSP {
             delayTime = milliseconds;
         }
 
+        // Switching modes picks up from wherever the head is now; a jump
+        // fade still running when going back to glide is cut short.
+        void setDelayTimeMode(const DelayTimeMode mode) noexcept
+        {
+            if (mode == delayMode)
+                return;
+            if (mode == DelayTimeMode::Jump)
+            {
+                jumpHeadMs    = smoothers.getCurrent(kSmDelayMs);
+                jumpFadeTotal = 0;
+            }
+            else
+            {
+                smoothers.snap(kSmDelayMs, jumpHeadMs);
+            }
+            delayMode = mode;
+        }
+
+        [[nodiscard]] DelayTimeMode getDelayTimeMode() const noexcept
+        {
+            return delayMode;
+        }
+
+        // Length of the jump-mode fade between the old and the new head.
+        void setJumpFadeMs(const float milliseconds) noexcept
+        {
+            jumpFadeMs = kJumpFadeRange.clamp(milliseconds);
+        }
+
         void setMixParam(const float value) noexcept
         {
-            mix = std::clamp(value, 0.0f, 1.0f);
+            mix = paramRange(EngineParam::Mix).clamp(value);
         }
 
         void setMixPercentage(const float value) noexcept
         {
-            mix = std::clamp(value * 0.01f, 0.0f, 1.0f);
+            mix = paramRange(EngineParam::Mix).clamp(value * 0.01f);
         }
 
         void setFeedbackParam(const float value) noexcept
         {
-            const float fb = std::clamp(value, 0.0f, 0.99f);
+            const float fb = paramRange(EngineParam::Feedback).clamp(value);
             feedbackL = fb;
             feedbackR = fb;
         }
@@ -592,19 +843,61 @@ namespace MarsDSP::DSP {
         // Feedback-path low-cut (highpass) corner in Hz.
         void setLowCutParam(const float hz) noexcept
         {
-            lowCutHz = std::clamp(hz, 20.0f, 20000.0f);
+            lowCutHz = paramRange(EngineParam::LowCut).clamp(hz);
         }
 
         // Feedback-path high-cut (lowpass) corner in Hz.
         void setHighCutParam(const float hz) noexcept
         {
-            highCutHz = std::clamp(hz, 20.0f, 20000.0f);
+            highCutHz = paramRange(EngineParam::HighCut).clamp(hz);
         }
 
         // Stereo crossfeed / ping-pong amount (0..1). 0 = no crossfeed, 1 = full swap.
         void setCrossfeedParam(const float value) noexcept
         {
-            crossfeed = std::clamp(value, 0.0f, 1.0f);
+            crossfeed = paramRange(EngineParam::Crossfeed).clamp(value);
+        }
+
+        // ------------------------------------------------------------------
+        // Modulation
+        // ------------------------------------------------------------------
+        // One LFO bank drives the delay time (± depth ms around the knob)
+        // and scales feedback by (1 ± depth) per channel, R a quarter cycle
+        // ahead of L. Free-running at modRateHz, or locked to the host
+        // timeline when synced and the transport is playing.
+        void setModRateParam(const float hz) noexcept
+        {
+            modRateHz = paramRange(EngineParam::ModRate).clamp(hz);
+        }
+
+        void setModDepthParam(const float milliseconds) noexcept
+        {
+            modDepthMs = paramRange(EngineParam::ModDepth).clamp(milliseconds);
+        }
+
+        void setModFeedbackParam(const float value) noexcept
+        {
+            modFeedbackDepth = paramRange(EngineParam::ModFeedback).clamp(value);
+        }
+
+        void setModShape(const LfoShape shape) noexcept
+        {
+            for (int i = 0; i < 4; ++i)
+                modLfo.setShape(i, shape);
+        }
+
+        void setModSync(const bool shouldSync, const SyncDivision division) noexcept
+        {
+            modSync     = shouldSync;
+            modDivision = division;
+        }
+
+        // Host transport for the current block (play head position at its start).
+        void setHostTempo(const double bpm, const double ppqPosition, const bool isPlaying) noexcept
+        {
+            hostBpm     = bpm > 0.0 ? bpm : 120.0;
+            hostPpq     = ppqPosition;
+            hostPlaying = isPlaying;
         }
 
         void setBypassed(const bool shouldBypass) noexcept
@@ -636,7 +929,7 @@ namespace MarsDSP::DSP {
         // plugin after an input transition to silence.
         //
         // Calculation:
-        //   repeats until |fb|^n < 0.001, i.e. n = ceil(log(0.001) / log(fb))
+        //   repeats until |fb|^n < -60 dB, i.e. n = ceil(-60 / gainToDb(fb))
         // plus a safety margin for biquad ring-down + parameter smoothing.
         // Clamped to a sane maximum so pathological feedback values (~0.99)
         // don't yield absurd tail lengths.
@@ -649,21 +942,81 @@ namespace MarsDSP::DSP {
             const float fb           = std::clamp(std::max(feedbackL, feedbackR),
                                                   0.0f, 0.9999f);
 
-            constexpr float silenceDb  = 0.001f;  // -60 dB
+            constexpr float silenceDb  = -60.0f;
             constexpr int   kMargin    = 2048;    // biquad ring-down + smoothers
             constexpr int   kMaxTail   = 1 << 20; // clamp (~21.8 s @ 48 kHz)
 
             if (fb < 1.0e-4f)
                 return std::min(static_cast<int>(delaySamples) + kMargin, kMaxTail);
 
-            const int repeats = static_cast<int>(std::ceil(
-                std::log(silenceDb) / std::log(fb)));
+            const int repeats = static_cast<int>(std::ceil(silenceDb / gainToDb(fb)));
             const long long tail = static_cast<long long>(delaySamples)
                                  * static_cast<long long>(std::max(repeats, 1))
                                  + kMargin;
             return static_cast<int>(std::min<long long>(tail, kMaxTail));
         }
 
+        // ------------------------------------------------------------------
+        // Telemetry
+        // ------------------------------------------------------------------
+        // Meter data for the numSamples process() just rendered into block.
+        // Read-only: one pass over the output and one over what the block
+        // wrote into the delay line. That write energy, repeated at the
+        // feedback gain, sums to the tail estimate E / (1 - g²); the filters
+        // and saturator only ever make the real tail smaller.
+        void measure(const dsp::AudioBlock<SampleType>& block, const int numSamples,
+                     DelayTelemetry& telemetry) const noexcept
+        {
+            const size_t numCh = block.getNumChannels();
+            const auto n = static_cast<size_t>(std::max(numSamples, 0));
+            for (size_t ch = 0; ch < 2; ++ch)
+            {
+                const BlockLevels levels = numCh > 0 && n > 0
+                    ? measureLevels(block.getChannelPointer(std::min(ch, numCh - 1)), n)
+                    : BlockLevels { 0.0f, 0.0f };
+                telemetry.peak[ch] = levels.peak;
+                telemetry.rms[ch]  = n > 0 ? std::sqrt(levels.sumSquares / static_cast<float>(n)) : 0.0f;
+            }
+
+            telemetry.duckGain = duckGain;
+            telemetry.delayMs  = delayMode == DelayTimeMode::Jump ? jumpHeadMs : smoothers.getCurrent(kSmDelayMs);
+
+            // the block's writes end at writeIdx; they may wrap the ring
+            auto written = [&](const std::vector<SampleType>& buf, const int writeIdx) {
+                const int count = std::min(numSamples, kBufSize);
+                const int start = (writeIdx - count) & kBufMask;
+                const int first = std::min(count, kBufSize - start);
+                return measureLevels(&buf[static_cast<size_t>(start)], static_cast<size_t>(first)).sumSquares
+                     + measureLevels(buf.data(), static_cast<size_t>(count - first)).sumSquares;
+            };
+            float tail = 0.0f;
+            if (n > 0 && !bufferL.empty())
+            {
+                const float energy = isMono() ? written(bufferL, writeIdxL)
+                                              : 0.5f * (written(bufferL, writeIdxL) + written(bufferR, writeIdxR));
+                const float g = std::max(std::abs(smoothers.getCurrent(kSmFbL)), std::abs(smoothers.getCurrent(kSmFbR)));
+                tail = energy / static_cast<float>(n) / (1.0f - std::min(g * g, 0.999f));
+            }
+            telemetry.tailEnergy = tail;
+        }
+
+        // Min/max history of the delay line for drawing; see WaveformPyramid.
+        // Off by default. Turning it on starts from an empty (silent)
+        // history. Audio thread.
+        void setWaveformHistoryEnabled(const bool enabled) noexcept
+        {
+            if (enabled && !historyEnabled)
+                for (auto& h : history)
+                    h.clear();
+            historyEnabled = enabled;
+        }
+
+        // any thread; 0 = L, 1 = R (the same as L in mono)
+        [[nodiscard]] const auto& getWaveformHistory(const int channel) const noexcept
+        {
+            return history[static_cast<size_t>(channel & 1)];
+        }
+
         // ------------------------------------------------------------------
         // Streaming-version contract
         // ------------------------------------------------------------------
@@ -692,102 +1045,6 @@ namespace MarsDSP::DSP {
         }
 
     private:
-        struct LipolSIMD
-        {
-            float current = 0.0f;
-            float target  = 0.0f;
-            float delta   = 0.0f;
-
-            void setTarget(float t, int blockSize) noexcept
-            {
-                target = t;
-                delta  = (blockSize > 0) ? (t - current) / static_cast<float>(blockSize) : 0.0f;
-            }
-            void instantize(float v) noexcept { current = target = v; delta = 0.0f; }
-            void advanceBlock()       noexcept { current = target;    delta = 0.0f; }
-
-            // 4-lane vector for samples [4q, 4q+1, 4q+2, 4q+3] within the block
-            SIMD_M128 quad(int q) const noexcept
-            {
-                const float base = current + delta * static_cast<float>(4 * q);
-                return SIMD_MM(add_ps)(SIMD_MM(set1_ps)(base),
-                                       SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(delta),
-                                                       SIMD_MM(setr_ps)(0.0f, 1.0f, 2.0f, 3.0f)));
-            }
-            // scalar value at sample offset i within the block
-            float at(int i) const noexcept
-            {
-                return current + delta * static_cast<float>(i);
-            }
-        };
-
-        template <class T, bool first_run_checks = true>
-        struct OnePoleLag
-        {
-            OnePoleLag() { setRate(static_cast<T>(0.004)); }
-            explicit OnePoleLag(T rate) { setRate(rate); }
-
-            void setRate(T lp_)
-            {
-                lp    = lp_;
-                lpinv = static_cast<T>(1) - lp_;
-            }
-
-            void setRateInMilliseconds(double miliSeconds, double sampleRate, double blockSizeInv)
-            {
-                setRate(static_cast<T>(
-                    1.0 - std::exp(-2.0 * M_PI / (miliSeconds * 0.001 * sampleRate * blockSizeInv))));
-            }
-
-            void setTarget(T f)
-            {
-                target_v = f;
-                if (first_run_checks && first_run)
-                {
-                    v = target_v;
-                    first_run = false;
-                }
-            }
-            void snapTo(T f)
-            {
-                target_v = f;
-                v = f;
-                first_run = false;
-            }
-
-            void snapToTarget()      { snapTo(target_v); }
-            T    getTargetValue() const { return target_v; }
-            T    getValue()       const { return v; }
-
-            void process() { v = v * lpinv + target_v * lp; }
-
-            void processN(int n)
-            {
-                if (n <= 0) return;
-                const T decay = std::pow(lpinv, static_cast<T>(n));
-                v = target_v + (v - target_v) * decay;
-            }
-
-            T v{0};
-            T target_v{0};
-            bool first_run{true};
-          protected:
-            T lp{0}, lpinv{0};
-        };
-
-        // Ported from sst-basic-blocks dsp/Lag.h
-        // SurgeLag: legacy-named alias with newValue/instantize aliases.
-        template <typename T, bool first_run_checks = true>
-        struct SurgeLag : OnePoleLag<T, first_run_checks>
-        {
-            SurgeLag()                : OnePoleLag<T, first_run_checks>() {}
-            explicit SurgeLag(T lp_)  : OnePoleLag<T, first_run_checks>(lp_) {}
-
-            void newValue(T f)   { this->setTarget(f); }
-            void startValue(T f) { this->snapTo(f); }
-            void instantize()    { this->snapToTarget(); }
-        };
-
         // RBJ biquad (Direct Form II Transposed). Zero heap allocation.
         // Used on the feedback path to shape the delayed signal spectrum
         // before it's mixed back into the write buffer.
@@ -806,49 +1063,141 @@ namespace MarsDSP::DSP {
                 return y;
             }
 
+            // RBJ cookbook terms from one half-angle sincos, w = 2π·fc/fs:
+            //   1 - cos w = 2·sin²(w/2),  1 + cos w = 2·cos²(w/2),  sin w = 2·sin(w/2)·cos(w/2)
+            // keeps the 1 - cos w term exact at low cutoffs where cos(w) would
+            // round to 1. the design runs in double on the double fasterSinCos
+            // and rounds to float once per coefficient, no libm needed.
+            struct HalfAngle { double sh2, ch2, sw, cw; };
+
+            static HalfAngle halfAngle(double fs, double fc) noexcept
+            {
+                const double wh = M_PI * std::clamp(fc, 20.0, 0.49 * fs) / fs;
+                double sh, ch;
+                fasterSinCos(wh, sh, ch);
+                return { sh * sh, ch * ch, 2.0 * sh * ch, ch * ch - sh * sh };
+            }
+
             void setLowPass(double fs, double fc, double Q) noexcept
             {
-                const double fcc = std::clamp(fc, 20.0, 0.49 * fs);
-                const double w = 2.0 * M_PI * fcc / fs;
-                const double cw = std::cos(w), sw = std::sin(w);
+                const auto [sh2, ch2, sw, cw] = halfAngle(fs, fc);
                 const double alpha = sw / (2.0 * Q);
-                const double a0 = 1.0 + alpha;
-                b0 = static_cast<float>((1.0 - cw) * 0.5 / a0);
-                b1 = static_cast<float>((1.0 - cw)       / a0);
+                const double a0inv = 1.0 / (1.0 + alpha);
+                b0 = static_cast<float>(sh2 * a0inv);          // (1 - cos w) / 2
+                b1 = static_cast<float>(2.0 * sh2 * a0inv);    // (1 - cos w)
                 b2 = b0;
-                a1 = static_cast<float>(-2.0 * cw / a0);
-                a2 = static_cast<float>((1.0 - alpha) / a0);
+                a1 = static_cast<float>(-2.0 * cw * a0inv);
+                a2 = static_cast<float>((1.0 - alpha) * a0inv);
             }
 
             void setHighPass(double fs, double fc, double Q) noexcept
             {
-                const double fcc = std::clamp(fc, 20.0, 0.49 * fs);
-                const double w = 2.0 * M_PI * fcc / fs;
-                const double cw = std::cos(w), sw = std::sin(w);
+                const auto [sh2, ch2, sw, cw] = halfAngle(fs, fc);
                 const double alpha = sw / (2.0 * Q);
-                const double a0 = 1.0 + alpha;
-                b0 = static_cast<float>((1.0 + cw) * 0.5 / a0);
-                b1 = static_cast<float>(-(1.0 + cw)      / a0);
+                const double a0inv = 1.0 / (1.0 + alpha);
+                b0 = static_cast<float>(ch2 * a0inv);          // (1 + cos w) / 2
+                b1 = static_cast<float>(-2.0 * ch2 * a0inv);   // -(1 + cos w)
                 b2 = b0;
-                a1 = static_cast<float>(-2.0 * cw / a0);
-                a2 = static_cast<float>((1.0 - alpha) / a0);
+                a1 = static_cast<float>(-2.0 * cw * a0inv);
+                a2 = static_cast<float>((1.0 - alpha) * a0inv);
             }
         };
 
-        void updateFilterCoeffs() noexcept
+        void updateModulation(const int numSamples) noexcept
         {
-            constexpr double Q = 0.707;
-            fbLP_L.setLowPass (sampleRate, highCutHz, Q);
-            fbLP_R.setLowPass (sampleRate, highCutHz, Q);
-            fbHP_L.setHighPass(sampleRate, lowCutHz,  Q);
-            fbHP_R.setHighPass(sampleRate, lowCutHz,  Q);
+            const double rateHz = modSync ? syncedRateHz(hostBpm, modDivision)
+                                          : static_cast<double>(modRateHz);
+            for (int i = 0; i < 4; ++i)
+                modLfo.setRateHz(i, rateHz);
+
+            // Re-lock to the timeline every block so loops and relocations land
+            // on the same phase; free-running otherwise.
+            if (modSync && hostPlaying)
+            {
+                const std::uint32_t phase = phaseFromPpq(hostPpq, modDivision);
+                modLfo.setPhase(kModDelay, phase);
+                modLfo.setPhase(kModFbL,   phase);
+                modLfo.setPhase(kModFbR,   phase + kModStereoOffset);
+            }
+
+            modLfo.advance(numSamples);
         }
 
-        SampleType softClip(SampleType x) noexcept
+        void updateFilterCoeffs(const float lowHz, const float highHz) noexcept
         {
-            return fasterTanhBounded(x);
+            // 2nd-order butterworth, 1/√2
+            constexpr double Q = ConstexprGen::butterworthQ<2>()[0];
+            fbLP_L.setLowPass (sampleRate, highHz, Q);
+            fbLP_R.setLowPass (sampleRate, highHz, Q);
+            fbHP_L.setHighPass(sampleRate, lowHz,  Q);
+            fbHP_R.setHighPass(sampleRate, lowHz,  Q);
         }
 
+        // Jump mode, once per block: starts a fade when the time has moved
+        // and no fade is running (a change during a fade waits for it to
+        // finish, the time is re-read every block), and returns the heads
+        // and alpha range for this block. Within a fade both heads take the
+        // block-end LFO offset; outside one the single head moves between
+        // block-start and block-end offsets exactly as in glide.
+        void advanceJump(const int numSamples, const float modOffsetOld,
+                         float& headMsOld, float& headMsNew, float& alphaStart, float& alphaEnd) noexcept
+        {
+            const float target = std::clamp(delayTime, minDelayTime, maxDelayTime);
+            if (jumpFadeTotal == 0 && target != jumpHeadMs)
+            {
+                jumpFromMs    = jumpHeadMs;
+                jumpHeadMs    = target;
+                jumpFadeTotal = std::max(1, static_cast<int>(jumpFadeMs * 0.001 * sampleRate));
+                jumpFadeDone  = 0;
+            }
+
+            if (jumpFadeTotal == 0)
+            {
+                headMsOld = jumpHeadMs + modOffsetOld;
+                headMsNew = jumpHeadMs + modDelayOffsetMs;
+                return;
+            }
+
+            const float invTotal = 1.0f / static_cast<float>(jumpFadeTotal);
+            headMsOld    = jumpFromMs + modDelayOffsetMs;
+            headMsNew    = jumpHeadMs + modDelayOffsetMs;
+            alphaStart   = static_cast<float>(jumpFadeDone) * invTotal;
+            jumpFadeDone = std::min(jumpFadeDone + numSamples, jumpFadeTotal);
+            alphaEnd     = static_cast<float>(jumpFadeDone) * invTotal;
+            if (jumpFadeDone == jumpFadeTotal)
+                jumpFadeTotal = 0;      // old head retires, next block reads one
+        }
+
+        // back to per-block linear ramps, and the delay time's usual lag
+        void endCrossRamp() noexcept
+        {
+            for (const int p : kCrossRampLanes)
+                smoothers.setLinear(p);
+            smoothers.setLagMs(kSmDelayMs, kDelayLagMs, sampleRate);
+            crossRampSamplesLeft = 0;
+        }
+
+        // PASS 3 soft clipper. Memoryless mode is a plain tiered tanh; ADAA1 keeps
+        // per-path history, so each write / output path owns its own instance.
+        struct Saturator
+        {
+            TanhADAA1<SaturatorTier> adaa;
+
+            void reset() noexcept { adaa.reset(); }
+
+            SIMD_M128 process(SIMD_M128 x) noexcept
+            {
+                if constexpr (SatMode == SaturatorMode::ADAA1) return adaa.process(x);
+                else                                           return fasterTanhTiered<SaturatorTier>(x);
+            }
+
+            float process(float x) noexcept
+            {
+                if constexpr (SatMode == SaturatorMode::ADAA1) return adaa.process(x);
+                else                                           return fasterTanhTiered<SaturatorTier>(x);
+            }
+        };
+
         std::vector<SampleType> bufferL, bufferR;
         // scratch buffers are thread_local to avoid per-instance allocation while remaining thread-safe.
         // Assumes no re-entrant process() on the same thread (e.g. sidechain feedback loops).
@@ -868,28 +1217,76 @@ namespace MarsDSP::DSP {
         SampleType duckAtkCoeff = static_cast<SampleType>(1);
         SampleType duckRelCoeff = static_cast<SampleType>(1);
 
-        static constexpr float minDelayTime = 5.0f;
-        static constexpr float maxDelayTime = 5000.0f;
+        static constexpr float minDelayTime = paramRange(EngineParam::DelayTime).min;
+        static constexpr float maxDelayTime = paramRange(EngineParam::DelayTime).max;
 
         float mix = 1.0f;
         float feedbackL = 0.0f;
         float feedbackR = 0.0f;
         float delayTime = 50.0f;
 
-        LipolSIMD          lMix, lFbL, lFbR, lCrossfeed;
-        SurgeLag<float>    lagDelayMs;
+        // Block-rate smoothers: linear ramps for mix / feedback / crossfeed
+        // and the filter cutoffs, 150 ms one-pole lag on the delay time.
+        // Lane 7 is spare. startCrossRamp() turns every lane into a lag for
+        // the length of the ramp.
+        static constexpr int kSmMix       = 0;
+        static constexpr int kSmFbL       = 1;
+        static constexpr int kSmFbR       = 2;
+        static constexpr int kSmCrossfeed = 3;
+        static constexpr int kSmDelayMs   = 4;
+        static constexpr int kSmLowCut    = 5;
+        static constexpr int kSmHighCut   = 6;
+        static constexpr int kCrossRampLanes[] = { kSmMix, kSmFbL, kSmFbR, kSmCrossfeed, kSmLowCut, kSmHighCut };
+        static constexpr double kDelayLagMs = 150.0;
+        SmootherBank<8> smoothers;
+        int crossRampSamplesLeft = 0;
 
         // Feedback-path filters (per channel): highpass before lowpass.
         Biquad fbLP_L, fbLP_R, fbHP_L, fbHP_R;
 
-        // Filter + crossfeed parameter targets. lowCutHz / highCutHz trigger
-        // coefficient recomputation at the top of process() when they change.
+        // PASS 3 saturators: feedback write path and wet/dry output path per
+        // channel. Mono runs through the L pair.
+        Saturator satWriteL, satOutL, satWriteR, satOutR;
+
+        // Filter + crossfeed parameter targets. lowCutHz / highCutHz feed the
+        // cutoff smoother lanes; coefficients follow their block-end values.
         float lowCutHz       = 20.0f;
         float highCutHz      = 20000.0f;
         float lastLowCutHz   = -1.0f;
         float lastHighCutHz  = -1.0f;
         float crossfeed      = 0.0f;
 
+        // Modulation: LFO lanes, parameter targets and host transport.
+        static constexpr int kModDelay = 0;
+        static constexpr int kModFbL   = 1;
+        static constexpr int kModFbR   = 2;
+        static constexpr std::uint32_t kModStereoOffset = 0x40000000u;     // quarter cycle
+
+        LfoBank<4>   modLfo;
+        float        modRateHz        = 0.5f;
+        float        modDepthMs       = 0.0f;
+        float        modFeedbackDepth = 0.0f;
+        float        modDelayOffsetMs = 0.0f;
+        float        modLfoFrom[3] {};              // lane values at the host block's start / end
+        float        modLfoTo[3]   {};
+        int          hostBlockSamples = 0;
+        int          hostBlockDone    = 0;          // of it, rendered by earlier sub-blocks
+
+        // Delay-time mode. In jump mode the head sits at jumpHeadMs; during
+        // a fade the retiring head stays at jumpFromMs.
+        DelayTimeMode delayMode     = DelayTimeMode::Glide;
+        float         jumpFadeMs    = 30.0f;
+        float         jumpHeadMs    = 50.0f;
+        float         jumpFromMs    = 50.0f;
+        int           jumpFadeTotal = 0;        // samples, 0 = no fade running
+        int           jumpFadeDone  = 0;
+        bool         modSync          = false;
+        SyncDivision modDivision      = SyncDivision::Quarter;
+
+        double hostBpm     = 120.0;
+        double hostPpq     = 0.0;
+        bool   hostPlaying = false;
+
         // allocates a fixed 262,144-sample buffer, saves the clock cycles from '%' and '/'
         // 1 << 18 = 262,144 samples, which at 44.1 kHz gives ~5.9 seconds of delay
         // (1 << 18) - 1 = 0x3FFFF = 0b0011'1111'1111'1111'1111
@@ -902,6 +1299,10 @@ namespace MarsDSP::DSP {
         int writeIdxL = 0;
         int writeIdxR = 0;
 
+        // min/max pyramids over bufferL / bufferR, ~32 KB each
+        std::array<WaveformPyramid<kBufSize>, 2> history;
+        bool historyEnabled = false;
+
         bool mono = false;
         bool bypassed = false;
     };
@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef CHRONOS_DELAY_PARAMS_H
+#define CHRONOS_DELAY_PARAMS_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace MarsDSP::DSP {
+
+    // Continuous parameters that can change mid-block through a ParamEvent.
+    // Switches (mono, bypass, mod shape / sync) stay block-rate.
+    enum class EngineParam : std::uint8_t
+    {
+        DelayTime, Mix, Feedback, LowCut, HighCut, Crossfeed,
+        ModRate, ModDepth, ModFeedback,
+        Count
+    };
+
+    // Parameter change at a sample offset within the block being processed.
+    struct ParamEvent
+    {
+        int         sampleOffset;
+        EngineParam param;
+        float       value;
+    };
+
+    struct ParamRange
+    {
+        float min;
+        float max;
+
+        [[nodiscard]] constexpr float clamp(const float value) const noexcept { return std::clamp(value, min, max); }
+    };
+
+    // The engine clamps every setter to these ranges, and the plugin's
+    // parameter table (Chronos::kParamSpecs) builds its host ranges from the
+    // same entries, so the two cannot drift apart.
+    inline constexpr std::array<ParamRange, static_cast<std::size_t>(EngineParam::Count)> kEngineParamRanges
+    {{
+        { 5.0f,  5000.0f  },    // DelayTime    ms
+        { 0.0f,  1.0f     },    // Mix
+        { 0.0f,  0.99f    },    // Feedback
+        { 20.0f, 20000.0f },    // LowCut       Hz
+        { 20.0f, 20000.0f },    // HighCut      Hz
+        { 0.0f,  1.0f     },    // Crossfeed
+        { 0.01f, 20.0f    },    // ModRate      Hz
+        { 0.0f,  50.0f    },    // ModDepth     ms
+        { 0.0f,  1.0f     },    // ModFeedback
+    }};
+
+    constexpr ParamRange paramRange(const EngineParam param) noexcept
+    {
+        return kEngineParamRanges[static_cast<std::size_t>(param)];
+    }
+
+    // How a delay-time change reaches the read head. Glide lags the head
+    // to the new time (pitch bends on the way); Jump fades a second head in
+    // at the new time over the jump fade and then retires the old one.
+    enum class DelayTimeMode : int
+    {
+        Glide,
+        Jump
+    };
+
+    inline constexpr ParamRange kJumpFadeRange { 5.0f, 500.0f };    // ms
+
+    // One block of meter data, filled on the audio thread by
+    // DelayEngine::measure() and handed to the UI by value.
+    struct DelayTelemetry
+    {
+        float peak[2];              // output max |x|, L / R
+        float rms[2];               // output RMS, L / R
+        float duckGain;             // 1 = not ducking
+        float delayMs;              // read-head time after the lag / jump, LFO excluded
+        float tailEnergy;           // mean square still circulating, summed over repeats
+    };
+}
+#endif
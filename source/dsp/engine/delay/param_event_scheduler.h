@@ -0,0 +1,110 @@
+#pragma once
+
+#ifndef CHRONOS_PARAM_EVENT_SCHEDULER_H
+#define CHRONOS_PARAM_EVENT_SCHEDULER_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "dsp/engine/delay/delay_params.h"
+#include "utils/helpers/event_queue.h"
+
+namespace MarsDSP::DSP {
+
+    // Timestamped parameter events on a running sample timeline, turned
+    // into the per-block ParamEvent offsets DelayEngine::process renders.
+    //
+    //   queue (any thread) → pending (audio thread, a min-heap on time, may
+    //   hold events for later blocks) → this block's offsets
+    //
+    // At most MaxDrainPerBlock events leave the queue per block, each an
+    // O(log MaxPending) heap push, so a burst costs a bounded slice of the
+    // block; the rest stays queued. Fixed storage throughout: nothing
+    // allocates or locks after construction.
+    template<std::size_t QueueCapacity = 1024, int MaxPending = 512, int MaxDrainPerBlock = 256>
+    class ParamEventScheduler
+    {
+    public:
+        struct TimedEvent
+        {
+            int64_t     sampleTime;
+            EngineParam param;
+            float       value;
+        };
+
+        // Any thread. False when the queue is full and the event was dropped.
+        bool push(const EngineParam param, const float value, const int64_t sampleTime) noexcept
+        {
+            return queue.push({ sampleTime, param, value });
+        }
+
+        // Audio thread. Drains up to MaxDrainPerBlock events from the queue
+        // into the pending heap and moves everything due before blockStart +
+        // numSamples into events() as offsets, in time order (stable for
+        // equal stamps). Late events land at offset 0.
+        //
+        // With the heap full the drain goes on: an event already due this
+        // block is applied at offset 0 ahead of the rest, one for a later
+        // block is dropped (see droppedCount()) rather than left blocking the
+        // queue. Returns the number of events for this block.
+        int collect(const int64_t blockStart, const int numSamples) noexcept
+        {
+            const int64_t blockEnd = blockStart + numSamples;
+            int numDue = 0;
+
+            TimedEvent event {};
+            for (int drained = 0; drained < MaxDrainPerBlock && queue.pop(event); ++drained)
+            {
+                if (numPending < MaxPending)
+                {
+                    heap[static_cast<size_t>(numPending++)] = { event, sequence++ };
+                    std::push_heap(heap.begin(), heap.begin() + numPending, later);
+                }
+                else if (event.sampleTime < blockEnd)
+                    due[static_cast<size_t>(numDue++)] = { 0, event.param, event.value };
+                else
+                    ++dropped;
+            }
+
+            while (numPending > 0 && heap.front().event.sampleTime < blockEnd)
+            {
+                const auto& e = heap.front().event;
+                due[static_cast<size_t>(numDue++)] = { static_cast<int>(std::max<int64_t>(e.sampleTime - blockStart, 0)), e.param, e.value };
+                std::pop_heap(heap.begin(), heap.begin() + numPending--, later);
+            }
+            return numDue;
+        }
+
+        // this block's events, as left by the last collect()
+        [[nodiscard]] const ParamEvent* events() const noexcept { return due.data(); }
+
+        // events drained from the queue but not yet due
+        [[nodiscard]] int pendingCount() const noexcept { return numPending; }
+
+        // future events dropped because the pending heap was full
+        [[nodiscard]] uint64_t droppedCount() const noexcept { return dropped; }
+
+    private:
+        struct Pending
+        {
+            TimedEvent event;
+            uint64_t   sequence;        // arrival order, breaks ties between equal stamps
+        };
+
+        // heap order: the earliest (then first-arrived) event on top
+        static bool later(const Pending& a, const Pending& b) noexcept
+        {
+            return a.event.sampleTime != b.event.sampleTime ? a.event.sampleTime > b.event.sampleTime
+                                                            : a.sequence > b.sequence;
+        }
+
+        EventQueue<TimedEvent, QueueCapacity> queue;
+        std::array<Pending, MaxPending> heap {};
+        std::array<ParamEvent, MaxPending + MaxDrainPerBlock> due {};
+        int numPending = 0;
+        uint64_t sequence = 0;
+        uint64_t dropped = 0;
+    };
+}
+#endif
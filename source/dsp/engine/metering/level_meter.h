@@ -0,0 +1,61 @@
+#pragma once
+
+#ifndef CHRONOS_LEVEL_METER_H
+#define CHRONOS_LEVEL_METER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "dsp/math/fastermath.h"
+
+namespace MarsDSP::DSP
+{
+    struct BlockLevels
+    {
+        float peak;                 // max |x|
+        float sumSquares;           // Σ x², divide by n for the mean square
+    };
+
+    // Peak and energy of a span in one pass: two quads per iteration, each
+    // with its own max / sum accumulators so the adds don't serialise, then
+    // a scalar tail. Unaligned input is fine.
+    inline BlockLevels measureLevels(const float* x, const std::size_t n) noexcept
+    {
+        const auto vAbsMask = SIMD_MM(castsi128_ps)(SIMD_MM(set1_epi32)(0x7FFFFFFF));
+        auto vPeak0 = SIMD_MM(setzero_ps)();
+        auto vPeak1 = SIMD_MM(setzero_ps)();
+        auto vSum0  = SIMD_MM(setzero_ps)();
+        auto vSum1  = SIMD_MM(setzero_ps)();
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const auto v0 = SIMD_MM(loadu_ps)(x + i);
+            const auto v1 = SIMD_MM(loadu_ps)(x + i + 4);
+            vPeak0 = SIMD_MM(max_ps)(vPeak0, SIMD_MM(and_ps)(v0, vAbsMask));
+            vPeak1 = SIMD_MM(max_ps)(vPeak1, SIMD_MM(and_ps)(v1, vAbsMask));
+            vSum0  = SIMD_MM(add_ps)(vSum0, SIMD_MM(mul_ps)(v0, v0));
+            vSum1  = SIMD_MM(add_ps)(vSum1, SIMD_MM(mul_ps)(v1, v1));
+        }
+        if (i + 4 <= n)
+        {
+            const auto v0 = SIMD_MM(loadu_ps)(x + i);
+            vPeak0 = SIMD_MM(max_ps)(vPeak0, SIMD_MM(and_ps)(v0, vAbsMask));
+            vSum0  = SIMD_MM(add_ps)(vSum0, SIMD_MM(mul_ps)(v0, v0));
+            i += 4;
+        }
+
+        alignas(16) float peak[4], sum[4];
+        SIMD_MM(store_ps)(peak, SIMD_MM(max_ps)(vPeak0, vPeak1));
+        SIMD_MM(store_ps)(sum,  SIMD_MM(add_ps)(vSum0, vSum1));
+        BlockLevels levels { std::max(std::max(peak[0], peak[1]), std::max(peak[2], peak[3])),
+                             (sum[0] + sum[1]) + (sum[2] + sum[3]) };
+        for (; i < n; ++i)
+        {
+            levels.peak        = std::max(levels.peak, std::abs(x[i]));
+            levels.sumSquares += x[i] * x[i];
+        }
+        return levels;
+    }
+}
+#endif
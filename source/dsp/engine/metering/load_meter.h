@@ -0,0 +1,182 @@
+#pragma once
+
+#ifndef CHRONOS_LOAD_METER_H
+#define CHRONOS_LOAD_METER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "utils/helpers/cycle_counter.h"
+
+namespace MarsDSP::DSP
+{
+    // Loads are block time / block budget (numSamples / sampleRate):
+    // 1.0 is exactly on the deadline.
+    struct LoadStats
+    {
+        uint64_t blocks;
+        uint64_t overruns;          // blocks over budget
+        float    last;
+        float    max;
+        float    p50;               // percentiles are the upper edge of their
+        float    p99;               // histogram bucket, so they never read low
+        float    p999;
+    };
+
+    // Per-block DSP load, timed with the cycle counter on the audio thread
+    // and read from any other.
+    //
+    // The histogram is log-spaced, kBucketsPerOctave buckets per octave
+    // from kMinLoad to kMaxLoad: the bucket index is just the float's
+    // exponent and top mantissa bits, so a block costs two counter reads,
+    // a multiply, a divide and a few relaxed stores. Counts are only ever
+    // written by the audio thread, so a reader sees each one whole and at
+    // worst a block behind; a reset is requested and then done by the
+    // audio thread at the end of its next block.
+    class LoadMeter
+    {
+    public:
+        static constexpr int   kBucketsPerOctave = 16;
+        static constexpr int   kMinExponent      = -16;                 // 2^-16 of the budget
+        static constexpr int   kMaxExponent      = 4;                   // 16x the budget
+        static constexpr int   kNumBuckets       = (kMaxExponent - kMinExponent) * kBucketsPerOctave + 2;
+        static constexpr float kMinLoad          = 1.0f / 65536.0f;
+        static constexpr float kMaxLoad          = 16.0f;
+
+        // message thread, audio stopped. Clears everything
+        void prepare(const double sampleRate) noexcept
+        {
+            secondsPerCycleTimesRate = static_cast<float>(sampleRate / cyclesPerSecond());
+            clear();
+            resetRequested.store(false, std::memory_order_relaxed);
+        }
+
+        // ------------------------------------------------------------------
+        // Audio thread
+        // ------------------------------------------------------------------
+
+        class ScopedBlock
+        {
+        public:
+            ScopedBlock(LoadMeter& m, const int n) noexcept : meter(m), numSamples(n), start(readCycles()) {}
+            ~ScopedBlock() { meter.addBlock(readCycles() - start, numSamples); }
+
+            ScopedBlock(const ScopedBlock&) = delete;
+            ScopedBlock& operator=(const ScopedBlock&) = delete;
+
+        private:
+            LoadMeter& meter;
+            const int numSamples;
+            const uint64_t start;
+        };
+
+        void addBlock(const uint64_t cycles, const int numSamples) noexcept
+        {
+            if (numSamples <= 0)
+                return;
+            if (resetRequested.load(std::memory_order_relaxed) && resetRequested.exchange(false, std::memory_order_acquire))
+                clear();
+
+            const float load = static_cast<float>(cycles) * secondsPerCycleTimesRate / static_cast<float>(numSamples);
+            bump(histogram[static_cast<size_t>(bucketOf(load))]);
+            bump(blocks);
+            if (load > 1.0f)
+                bump(overruns);
+            lastLoad.store(load, std::memory_order_relaxed);
+            if (load > maxLoad.load(std::memory_order_relaxed))
+                maxLoad.store(load, std::memory_order_relaxed);
+        }
+
+        // ------------------------------------------------------------------
+        // Reader side, any thread
+        // ------------------------------------------------------------------
+
+        void requestReset() noexcept { resetRequested.store(true, std::memory_order_release); }
+
+        // O(kNumBuckets)
+        [[nodiscard]] LoadStats getStats() const noexcept
+        {
+            std::array<uint64_t, kNumBuckets> counts {};
+            uint64_t total = 0;
+            for (size_t i = 0; i < counts.size(); ++i)
+                total += counts[i] = histogram[i].load(std::memory_order_relaxed);
+
+            LoadStats s {};
+            s.blocks   = blocks.load(std::memory_order_relaxed);
+            s.overruns = overruns.load(std::memory_order_relaxed);
+            s.last     = lastLoad.load(std::memory_order_relaxed);
+            s.max      = maxLoad.load(std::memory_order_relaxed);
+
+            // smallest bucket whose running count reaches the rank
+            auto percentile = [&](const double q)
+            {
+                const auto rank = static_cast<uint64_t>(q * static_cast<double>(total) + 0.999999);
+                uint64_t seen = 0;
+                for (int i = 0; i < kNumBuckets; ++i)
+                    if ((seen += counts[static_cast<size_t>(i)]) >= std::max<uint64_t>(rank, 1))
+                        return std::min(upperEdge(i), s.max);
+                return s.max;
+            };
+            if (total > 0)
+            {
+                s.p50  = percentile(0.5);
+                s.p99  = percentile(0.99);
+                s.p999 = percentile(0.999);
+            }
+            return s;
+        }
+
+        // 0 below kMinLoad, kNumBuckets - 1 from kMaxLoad up
+        static int bucketOf(const float load) noexcept
+        {
+            if (!(load >= kMinLoad))                    // also catches NaN
+                return 0;
+            if (load >= kMaxLoad)
+                return kNumBuckets - 1;
+            constexpr int kShift = 23 - std::countr_zero(static_cast<unsigned>(kBucketsPerOctave));
+            return 1 + static_cast<int>((std::bit_cast<uint32_t>(load) - std::bit_cast<uint32_t>(kMinLoad)) >> kShift);
+        }
+
+        // largest load that lands in bucket i
+        static float upperEdge(const int bucket) noexcept
+        {
+            if (bucket <= 0)
+                return kMinLoad;
+            if (bucket >= kNumBuckets - 1)
+                return kMaxLoad;
+            constexpr int kShift = 23 - std::countr_zero(static_cast<unsigned>(kBucketsPerOctave));
+            return std::bit_cast<float>(std::bit_cast<uint32_t>(kMinLoad) + (static_cast<uint32_t>(bucket) << kShift));
+        }
+
+    private:
+        static_assert(std::has_single_bit(static_cast<unsigned>(kBucketsPerOctave)), "whole mantissa bits per bucket");
+
+        // single writer, so load + store instead of a locked RMW
+        static void bump(std::atomic<uint64_t>& counter) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        void clear() noexcept
+        {
+            for (auto& c : histogram)
+                c.store(0, std::memory_order_relaxed);
+            blocks.store(0, std::memory_order_relaxed);
+            overruns.store(0, std::memory_order_relaxed);
+            lastLoad.store(0.0f, std::memory_order_relaxed);
+            maxLoad.store(0.0f, std::memory_order_relaxed);
+        }
+
+        float secondsPerCycleTimesRate = 0.0f;           // sample rate / cycle rate
+        std::array<std::atomic<uint64_t>, kNumBuckets> histogram {};
+        std::atomic<uint64_t> blocks { 0 };
+        std::atomic<uint64_t> overruns { 0 };
+        std::atomic<float> lastLoad { 0.0f };
+        std::atomic<float> maxLoad { 0.0f };
+        std::atomic<bool> resetRequested { false };
+    };
+}
+#endif
@@ -0,0 +1,329 @@
+#pragma once
+
+#ifndef CHRONOS_SPECTRUM_ANALYZER_H
+#define CHRONOS_SPECTRUM_ANALYZER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <numbers>
+#include <thread>
+#include <vector>
+#include <kfr/dft.hpp>
+#include "dsp/math/fastermath.h"
+#include "utils/helpers/spsc_ring.h"
+#include "utils/helpers/triple_buffer.h"
+
+namespace MarsDSP::DSP
+{
+    // Output spectrum for the editor, analysed off the audio thread.
+    //
+    //   audio thread     push(): one memcpy per channel into an SPSC FIFO,
+    //                    the whole block dropped if the analyser has fallen
+    //                    kFifoSize samples behind. Nothing else.
+    //   analysis thread  wakes kFramesPerSecond times a second, drains the
+    //                    FIFOs into a kFftSize history of (L + R) / 2 and
+    //                    transforms only the newest kFftSize samples
+    //                    (Hann, kfr real FFT). Everything pushed in between
+    //                    is history, never transformed: the frame rate, not
+    //                    the sample rate, sets the cost.
+    //   reader (UI)      readSpectrum(): kNumBands log-spaced band levels in
+    //                    dB (loudest bin per band, instant attack, kReleaseMs
+    //                    release) from a triple buffer.
+    //
+    // getLoad() is the share of one core the analysis thread spent working
+    // over the last second.
+    class SpectrumAnalyzer
+    {
+    public:
+        static constexpr int    kFftOrder        = 12;
+        static constexpr int    kFftSize         = 1 << kFftOrder;
+        static constexpr int    kNumBins         = kFftSize / 2 + 1;
+        static constexpr int    kNumBands        = 96;
+        static constexpr float  kMinHz           = 20.0f;
+        static constexpr float  kMaxHz           = 20000.0f;
+        static constexpr int    kFramesPerSecond = 30;
+        static constexpr float  kReleaseMs       = 300.0f;
+        static constexpr float  kFloorDb         = -120.0f;
+        static constexpr size_t kFifoSize        = 1 << 15;
+
+        using Bands = std::array<float, kNumBands>;
+
+        SpectrumAnalyzer()
+            : plan(kFftSize),
+              history(kFftSize, 0.0f),
+              frame(kFftSize, 0.0f),
+              window(kFftSize),
+              power(kNumBins, 0.0f),
+              bins(kNumBins),
+              temp(plan.temp_size)
+        {
+            // periodic Hann: the sum is exactly kFftSize / 2
+            for (int i = 0; i < kFftSize; ++i)
+                window[static_cast<size_t>(i)] = 0.5f - 0.5f * std::cos(2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(kFftSize));
+            levels.fill(kFloorDb);
+            buildBands(sampleRate.load(std::memory_order_relaxed));
+        }
+
+        ~SpectrumAnalyzer() { stop(); }
+
+        SpectrumAnalyzer(const SpectrumAnalyzer&) = delete;
+        SpectrumAnalyzer& operator=(const SpectrumAnalyzer&) = delete;
+
+        // any thread; the band table follows on the next frame
+        void prepare(const double newSampleRate) noexcept
+        {
+            sampleRate.store(newSampleRate, std::memory_order_relaxed);
+        }
+
+        // ------------------------------------------------------------------
+        // Audio thread
+        // ------------------------------------------------------------------
+
+        // right may be null (mono). R goes in before L so that once the
+        // analyser sees a block of L, the matching R is already there.
+        void push(const float* left, const float* right, const int numSamples) noexcept
+        {
+            const auto n = static_cast<size_t>(numSamples);
+            if (n == 0 || fifoL.writeSpace() < n || fifoR.writeSpace() < n)
+                return;
+            (void) fifoR.pushN(right != nullptr ? right : left, n);
+            (void) fifoL.pushN(left, n);
+        }
+
+        // ------------------------------------------------------------------
+        // Analysis thread
+        // ------------------------------------------------------------------
+
+        // message / UI thread. Idempotent
+        void start()
+        {
+            if (worker.joinable())
+                return;
+            {
+                std::lock_guard lock(wakeMutex);
+                stopRequested = false;
+            }
+            worker = std::thread([this] { run(); });
+        }
+
+        void stop()
+        {
+            if (!worker.joinable())
+                return;
+            {
+                std::lock_guard lock(wakeMutex);
+                stopRequested = true;
+            }
+            wake.notify_one();
+            worker.join();
+            load.store(0.0f, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool isRunning() const noexcept { return worker.joinable(); }
+
+        // One frame: drain, transform, smooth, publish. The thread calls it
+        // on its timer; with the thread stopped a test can call it directly.
+        // Without new samples the levels just release towards the floor.
+        // Returns true when a transform ran.
+        bool analyse() noexcept
+        {
+            if (const double sr = sampleRate.load(std::memory_order_relaxed); sr != bandRate)
+                buildBands(sr);
+
+            const bool fresh = drain() > 0;
+            if (fresh)
+            {
+                // oldest sample first: [historyPos, end) then [0, historyPos)
+                const size_t split = static_cast<size_t>(kFftSize) - historyPos;
+                applyWindow(history.data() + historyPos, window.data(), frame.data(), split);
+                applyWindow(history.data(), window.data() + split, frame.data() + split, historyPos);
+                plan.execute(bins.data(), frame.data(), temp.data());
+
+                // |X|² · (4 / N)²: a full-scale sine inside one bin reads 0 dB
+                constexpr float norm = 16.0f / (static_cast<float>(kFftSize) * static_cast<float>(kFftSize));
+                for (size_t k = 0; k < static_cast<size_t>(kNumBins); ++k)
+                    power[k] = (bins[k].real() * bins[k].real() + bins[k].imag() * bins[k].imag()) * norm;
+            }
+
+            for (int b = 0; b < kNumBands; ++b)
+            {
+                float target = kFloorDb;
+                if (fresh)
+                {
+                    float p = 0.0f;
+                    for (int k = bandLo[static_cast<size_t>(b)]; k < bandHi[static_cast<size_t>(b)]; ++k)
+                        p = std::max(p, power[static_cast<size_t>(k)]);
+                    target = std::max(fasterLog2(std::max(p, kPowerFloor)) * kLog2ToPowerDb, kFloorDb);
+                }
+                float& level = levels[static_cast<size_t>(b)];
+                level = target >= level ? target : target + releaseCoeff * (level - target);
+            }
+
+            spectrum.back() = levels;
+            spectrum.publish();
+            return fresh;
+        }
+
+        // ------------------------------------------------------------------
+        // Reader side, one thread (the editor)
+        // ------------------------------------------------------------------
+
+        // copies the newest frame into out if there is one since the last
+        // call; otherwise leaves out alone and returns false
+        bool readSpectrum(Bands& out) noexcept
+        {
+            if (!spectrum.update())
+                return false;
+            out = spectrum.front();
+            return true;
+        }
+
+        // 0..1 of one core, averaged over the last second
+        [[nodiscard]] float getLoad() const noexcept { return load.load(std::memory_order_relaxed); }
+
+        // geometric centre of a band at the given sample rate
+        static float bandCentreHz(const int band, const double sr) noexcept
+        {
+            const float top = std::min(kMaxHz, 0.5f * static_cast<float>(sr));
+            return kMinHz * std::pow(top / kMinHz, (static_cast<float>(band) + 0.5f) / kNumBands);
+        }
+
+    private:
+        static constexpr size_t kChunk         = 1024;
+        static constexpr float  kPowerFloor    = 1.0e-12f;          // kFloorDb as power
+        static constexpr float  kLog2ToPowerDb = 3.0102999566f;     // 10 · log10(2)
+
+        // per frame, so kReleaseMs holds at kFramesPerSecond
+        const float releaseCoeff = static_cast<float>(std::exp(-1000.0 / (kReleaseMs * kFramesPerSecond)));
+
+        void run()
+        {
+            using Clock = std::chrono::steady_clock;
+            constexpr auto interval = std::chrono::microseconds(1000000 / kFramesPerSecond);
+
+            auto next = Clock::now();
+            auto windowStart = next;
+            Clock::duration busy {};
+
+            std::unique_lock lock(wakeMutex);
+            while (true)
+            {
+                next += interval;
+                if (wake.wait_until(lock, next, [this] { return stopRequested; }))
+                    break;
+
+                const auto t0 = Clock::now();
+                analyse();
+                const auto t1 = Clock::now();
+                busy += t1 - t0;
+
+                // a late frame doesn't cause a burst of catch-up frames
+                next = std::max(next, t1 - interval);
+
+                if (t1 - windowStart >= std::chrono::seconds(1))
+                {
+                    load.store(static_cast<float>(std::chrono::duration<double>(busy) / std::chrono::duration<double>(t1 - windowStart)),
+                               std::memory_order_relaxed);
+                    busy = {};
+                    windowStart = t1;
+                }
+            }
+        }
+
+        // FIFOs → mono history; returns how many samples were new
+        size_t drain() noexcept
+        {
+            size_t total = 0;
+            for (size_t got; (got = fifoL.popN(chunkL.data(), kChunk)) > 0; total += got)
+            {
+                (void) fifoR.popN(chunkR.data(), got);
+
+                size_t i = 0;
+                const auto half = SIMD_MM(set1_ps)(0.5f);
+                for (; i + 4 <= got; i += 4)
+                    SIMD_MM(storeu_ps)(chunkL.data() + i, SIMD_MM(mul_ps)(half, SIMD_MM(add_ps)(SIMD_MM(loadu_ps)(chunkL.data() + i),
+                                                                                                SIMD_MM(loadu_ps)(chunkR.data() + i))));
+                for (; i < got; ++i)
+                    chunkL[i] = 0.5f * (chunkL[i] + chunkR[i]);
+
+                const size_t keep  = std::min(got, static_cast<size_t>(kFftSize));
+                const float* src   = chunkL.data() + (got - keep);
+                historyPos         = (historyPos + (got - keep)) & kHistoryMask;
+                const size_t first = std::min(keep, static_cast<size_t>(kFftSize) - historyPos);
+                std::copy_n(src, first, history.data() + historyPos);
+                std::copy_n(src + first, keep - first, history.data());
+                historyPos = (historyPos + keep) & kHistoryMask;
+            }
+            return total;
+        }
+
+        static void applyWindow(const float* x, const float* w, float* out, const size_t n) noexcept
+        {
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                SIMD_MM(storeu_ps)(out + i, SIMD_MM(mul_ps)(SIMD_MM(loadu_ps)(x + i), SIMD_MM(loadu_ps)(w + i)));
+            for (; i < n; ++i)
+                out[i] = x[i] * w[i];
+        }
+
+        // log-spaced bands from kMinHz up to kMaxHz or Nyquist. A band
+        // narrower than a bin still gets the bin it falls in.
+        void buildBands(const double sr) noexcept
+        {
+            bandRate = sr;
+            const double binHz = sr / kFftSize;
+            const double top   = std::min(static_cast<double>(kMaxHz), 0.5 * sr);
+            const double ratio = std::pow(top / kMinHz, 1.0 / kNumBands);
+            double lo = kMinHz;
+            for (size_t b = 0; b < static_cast<size_t>(kNumBands); ++b)
+            {
+                const double hi = lo * ratio;
+                const int first = std::clamp(static_cast<int>(lo / binHz + 0.5), 1, kNumBins - 1);
+                const int last  = std::clamp(static_cast<int>(hi / binHz + 0.5), first + 1, kNumBins);
+                bandLo[b] = first;
+                bandHi[b] = last;
+                lo = hi;
+            }
+        }
+
+        static constexpr size_t kHistoryMask = static_cast<size_t>(kFftSize) - 1;
+
+        // audio thread → analysis thread
+        SpscRing<float, kFifoSize> fifoL;
+        SpscRing<float, kFifoSize> fifoR;
+        std::atomic<double> sampleRate { 48000.0 };
+
+        // analysis thread only
+        kfr::dft_plan_real<float> plan;
+        std::vector<float> history;
+        std::vector<float> frame;
+        std::vector<float> window;
+        std::vector<float> power;
+        std::vector<kfr::complex<float>> bins;
+        std::vector<kfr::u8> temp;
+        std::array<float, kChunk> chunkL {};
+        std::array<float, kChunk> chunkR {};
+        std::array<int, kNumBands> bandLo {};
+        std::array<int, kNumBands> bandHi {};
+        Bands  levels {};
+        size_t historyPos = 0;
+        double bandRate   = 0.0;
+
+        // analysis thread → editor
+        TripleBuffer<Bands> spectrum;
+        std::atomic<float> load { 0.0f };
+
+        std::thread worker;
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+        bool stopRequested = false;
+    };
+}
+#endif
@@ -0,0 +1,239 @@
+#pragma once
+
+#ifndef CHRONOS_WAVEFORM_PYRAMID_H
+#define CHRONOS_WAVEFORM_PYRAMID_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "dsp/math/fastermath.h"
+
+namespace MarsDSP::DSP
+{
+    struct WaveformColumn
+    {
+        float min;
+        float max;
+    };
+
+    // Min/max mipmap over a ring buffer, for drawing its history at any zoom.
+    //
+    // Level 0 holds one min/max pair per BaseBucket samples of the ring;
+    // every level above halves the count, up to one pair for the whole ring:
+    //
+    //   level 0   RingSize / BaseBucket pairs    (64 samples each)
+    //   level 1   half as many                   (128 samples each)
+    //   ...
+    //   level L   1 pair                         (RingSize samples)
+    //
+    // update() runs on the writer after every block: it reduces the samples
+    // the block wrote into their level-0 buckets (SIMD min / max) and then
+    // refreshes only the parents of those, so a block costs one pass over
+    // its own samples plus a couple of pairs per level.
+    //
+    // Pairs are int16 min / max packed into one relaxed 32-bit atomic, so a
+    // reader on another thread always sees a whole pair and never tears or
+    // locks. A pair read mid-update is either this block's or the last one's
+    // – both are history that really happened, which is all a display needs.
+    // The newest write position is published with release after the pairs.
+    template<int RingSize, int BaseBucket = 64>
+    class WaveformPyramid
+    {
+    public:
+        static_assert(RingSize > 0 && (RingSize & (RingSize - 1)) == 0, "RingSize must be a power of two");
+        static_assert(BaseBucket >= 4 && (BaseBucket & (BaseBucket - 1)) == 0, "BaseBucket must be a power of two");
+        static_assert(RingSize >= BaseBucket, "ring smaller than one bucket");
+
+        static constexpr int kBaseBuckets = RingSize / BaseBucket;
+        static constexpr int kLevels      = [] { int n = 1; for (int b = kBaseBuckets; b > 1; b >>= 1) ++n; return n; }();
+        static constexpr int kTotalPairs  = 2 * kBaseBuckets - 1;
+        static constexpr float kRange     = 2.0f;     // ±kRange maps onto int16, anything past it clips
+
+        using MinMax = WaveformColumn;
+
+        // writer thread (or before it starts). Everything reads as silence.
+        void clear() noexcept
+        {
+            for (auto& p : pairs)
+                p.store(0u, std::memory_order_relaxed);
+            openBucket = -1;
+            head.store(0, std::memory_order_release);
+        }
+
+        // writer thread. ring[start, start + count) (mod RingSize) was just
+        // written; ring must hold RingSize samples.
+        void update(const float* ring, int start, int count) noexcept
+        {
+            if (count <= 0)
+                return;
+            if (count > RingSize)
+            {
+                start += count - RingSize;
+                count  = RingSize;
+            }
+            start &= kMask;
+            const int end = start + count;                      // unwrapped, may pass RingSize
+
+            // level 0: every bucket the block touched, reducing only the new
+            // samples. A bucket the last block left half-written carries on
+            // from the min / max it got to; the bucket holding the write head
+            // only covers what has been written of it so far.
+            const int last  = (end - 1) / BaseBucket;
+            const int first = std::max(start / BaseBucket, last - kBaseBuckets + 1);
+            for (int u = first; u <= last; ++u)
+            {
+                const int b    = u & (kBaseBuckets - 1);
+                const int from = std::max(start, u * BaseBucket);
+                const int to   = std::min(end, (u + 1) * BaseBucket);
+                MinMax r = reduce(ring + (from & kMask), to - from);
+                if (from != u * BaseBucket)
+                {
+                    const MinMax before = b == openBucket ? open : reduce(ring + b * BaseBucket, from - u * BaseBucket);
+                    r = { std::min(r.min, before.min), std::max(r.max, before.max) };
+                }
+                openBucket = to != (u + 1) * BaseBucket ? b : -1;
+                open       = r;
+                pairs[static_cast<size_t>(b)].store(pack(r), std::memory_order_relaxed);
+            }
+
+            // parents of what changed, level by level
+            int lo = first, hi = last;
+            for (int level = 1; level < kLevels; ++level)
+            {
+                const int childOffset = offset(level - 1);
+                const int childMask   = (kBaseBuckets >> (level - 1)) - 1;
+                const int mask        = (kBaseBuckets >> level) - 1;
+                lo >>= 1;
+                hi >>= 1;
+                for (int u = lo; u <= std::min(hi, lo + mask); ++u)
+                {
+                    const int p = u & mask;
+                    const uint32_t a = pairs[static_cast<size_t>(childOffset + ((2 * p) & childMask))].load(std::memory_order_relaxed);
+                    const uint32_t c = pairs[static_cast<size_t>(childOffset + ((2 * p + 1) & childMask))].load(std::memory_order_relaxed);
+                    pairs[static_cast<size_t>(offset(level) + p)].store(combine(a, c), std::memory_order_relaxed);
+                }
+            }
+
+            head.store(end & kMask, std::memory_order_release);
+        }
+
+        // ------------------------------------------------------------------
+        // Reader side, any thread
+        // ------------------------------------------------------------------
+
+        // one past the newest sample written
+        [[nodiscard]] int newest() const noexcept { return head.load(std::memory_order_acquire); }
+
+        [[nodiscard]] MinMax bucket(const int level, const int index) const noexcept
+        {
+            const int mask = (kBaseBuckets >> level) - 1;
+            return unpack(pairs[static_cast<size_t>(offset(level) + (index & mask))].load(std::memory_order_relaxed));
+        }
+
+        // The newest numSamples of history (oldest first) across numColumns
+        // columns. Reads the coarsest level whose buckets still fit inside
+        // one column, so each column combines at most a couple of pairs:
+        // O(numColumns) whatever the zoom. Columns finer than BaseBucket
+        // repeat their level-0 bucket.
+        void render(int numSamples, MinMax* columns, const int numColumns) const noexcept
+        {
+            if (numColumns <= 0)
+                return;
+            numSamples = std::clamp(numSamples, 1, RingSize);
+            const int now = newest();
+            const double perColumn = static_cast<double>(numSamples) / numColumns;
+
+            int level = 0;
+            while (level + 1 < kLevels && static_cast<double>(BaseBucket << (level + 1)) <= perColumn)
+                ++level;
+            const int size = BaseBucket << level;
+            const int base = offset(level);
+            const int mask = (kBaseBuckets >> level) - 1;
+
+            // positions are unwrapped (now + RingSize - numSamples ...) and
+            // masked per bucket, so the ring seam needs no special case
+            const double origin = static_cast<double>(now + RingSize - numSamples);
+            for (int c = 0; c < numColumns; ++c)
+            {
+                const int s0 = static_cast<int>(origin + c * perColumn);
+                const int s1 = std::max(s0 + 1, static_cast<int>(origin + (c + 1) * perColumn));
+                uint32_t acc = pairs[static_cast<size_t>(base + ((s0 / size) & mask))].load(std::memory_order_relaxed);
+                for (int u = s0 / size + 1; u <= (s1 - 1) / size; ++u)
+                    acc = combine(acc, pairs[static_cast<size_t>(base + (u & mask))].load(std::memory_order_relaxed));
+                columns[c] = unpack(acc);
+            }
+        }
+
+    private:
+        static constexpr int kMask = RingSize - 1;
+        static constexpr float kScale = 32767.0f / kRange;
+
+        // level l starts after all the finer levels: 2·B - 2·B / 2^l
+        static constexpr int offset(const int level) noexcept
+        {
+            return 2 * kBaseBuckets - 2 * (kBaseBuckets >> level);
+        }
+
+        static MinMax reduce(const float* x, const int n) noexcept
+        {
+            auto vMin = SIMD_MM(set1_ps)(x[0]);
+            auto vMax = vMin;
+            int i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                const auto v = SIMD_MM(loadu_ps)(x + i);
+                vMin = SIMD_MM(min_ps)(vMin, v);
+                vMax = SIMD_MM(max_ps)(vMax, v);
+            }
+            alignas(16) float lo[4], hi[4];
+            SIMD_MM(store_ps)(lo, vMin);
+            SIMD_MM(store_ps)(hi, vMax);
+            MinMax r { std::min(std::min(lo[0], lo[1]), std::min(lo[2], lo[3])),
+                       std::max(std::max(hi[0], hi[1]), std::max(hi[2], hi[3])) };
+            for (; i < n; ++i)
+            {
+                r.min = std::min(r.min, x[i]);
+                r.max = std::max(r.max, x[i]);
+            }
+            return r;
+        }
+
+        // min rounds down and max rounds up, so a pair always contains the
+        // samples (truncate, then step away from zero; no libm floor / ceil)
+        static uint32_t pack(const MinMax m) noexcept
+        {
+            const float lo = std::clamp(m.min, -kRange, kRange) * kScale;
+            const float hi = std::clamp(m.max, -kRange, kRange) * kScale;
+            int qLo = static_cast<int>(lo);
+            int qHi = static_cast<int>(hi);
+            qLo -= static_cast<float>(qLo) > lo ? 1 : 0;
+            qHi += static_cast<float>(qHi) < hi ? 1 : 0;
+            return static_cast<uint16_t>(static_cast<int16_t>(std::max(qLo, -32767)))
+                 | (static_cast<uint32_t>(static_cast<uint16_t>(static_cast<int16_t>(std::min(qHi, 32767)))) << 16);
+        }
+
+        static MinMax unpack(const uint32_t p) noexcept
+        {
+            return { static_cast<float>(static_cast<int16_t>(p & 0xFFFFu)) / kScale,
+                     static_cast<float>(static_cast<int16_t>(p >> 16)) / kScale };
+        }
+
+        static uint32_t combine(const uint32_t a, const uint32_t b) noexcept
+        {
+            const auto lo = std::min(static_cast<int16_t>(a & 0xFFFFu), static_cast<int16_t>(b & 0xFFFFu));
+            const auto hi = std::max(static_cast<int16_t>(a >> 16),     static_cast<int16_t>(b >> 16));
+            return static_cast<uint16_t>(lo) | (static_cast<uint32_t>(static_cast<uint16_t>(hi)) << 16);
+        }
+
+        std::array<std::atomic<uint32_t>, kTotalPairs> pairs {};
+        std::atomic<int> head { 0 };
+
+        // writer only: the unquantised min / max of the half-written bucket
+        MinMax open {};
+        int    openBucket = -1;
+    };
+}
+#endif
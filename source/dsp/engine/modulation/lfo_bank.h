@@ -0,0 +1,221 @@
+#pragma once
+
+#ifndef CHRONOS_LFO_BANK_H
+#define CHRONOS_LFO_BANK_H
+
+#include <algorithm>
+#include <cstdint>
+#include "dsp/math/fastermath.h"
+
+namespace MarsDSP::DSP
+{
+    enum class LfoShape : int
+    {
+        Sine,
+        Triangle,
+        SmoothRandom    // new random target every cycle, sin² eased between them
+    };
+
+    // Bank of NumLfos LFOs, four per SIMD register.
+    //
+    // Phase is a uint32 accumulator where 2^32 is one cycle, so it wraps for
+    // free and never needs range reduction: reinterpreted as int32 and scaled
+    // by π/2^31 it is already in [-π, π), the domain of the pade fasterSin.
+    // Rates are quantised to fs/2^32 (~1e-5 Hz at 48 kHz); the phase itself
+    // never accumulates rounding error.
+    //
+    //   sine      sin(int32(φ) · π/2^31)
+    //   triangle  1 - |int32(φ - 2^30)| · 2^-30          (0 at φ = 0, rising)
+    //   random    a + (b - a) · sin²(φ · π/2^33)         (a → b once per cycle)
+    //
+    // All shapes start at 0 phase going up, so switching shape on a running
+    // bank does not jump by more than the shapes differ. Each group of four
+    // only evaluates the shapes its lanes use.
+    //
+    // process() steps one sample, advance(n) steps a whole block at once for
+    // block-rate consumers (the engine's delay time and feedback ramps).
+    // SSE2 has no 32-bit multiply, so advance() updates the phases in scalar
+    // 64-bit math and only the shape evaluation is vectorised.
+    template<int NumLfos = 4>
+    class LfoBank
+    {
+    public:
+        static_assert(NumLfos > 0 && NumLfos % 4 == 0, "LfoBank runs four LFOs per register");
+        static constexpr int kGroups = NumLfos / 4;
+
+        // every lane starts as a 0 Hz sine
+        LfoBank()
+        {
+            for (int i = 0; i < NumLfos; ++i)
+                setShape(i, LfoShape::Sine);
+            reset();
+        }
+
+        void prepare(const double newSampleRate) noexcept
+        {
+            sampleRate = newSampleRate;
+            for (int i = 0; i < NumLfos; ++i)
+                setRateHz(i, ratesHz[i]);
+            reset();
+        }
+
+        // phases back to 0, random generators reseeded, outputs to 0
+        void reset() noexcept
+        {
+            for (int i = 0; i < NumLfos; ++i)
+            {
+                phase[i]    = 0;
+                rng[i]      = 0x9E3779B9u * static_cast<std::uint32_t>(i + 1);
+                randPrev[i] = 0.0f;
+                randNext[i] = nextRandom(rng[i]);
+                out[i]      = 0.0f;
+            }
+        }
+
+        void setRateHz(const int lfo, const double hz) noexcept
+        {
+            ratesHz[lfo] = hz;
+            const double cycles = std::clamp(hz / sampleRate, 0.0, 0.5);
+            inc[lfo] = static_cast<std::uint32_t>(std::min(cycles * 4294967296.0, 2147483647.0) + 0.5);
+        }
+
+        void setShape(const int lfo, const LfoShape shape) noexcept
+        {
+            shapes[lfo] = shape;
+            mask[0][lfo] = shape == LfoShape::Sine         ? 0xFFFFFFFFu : 0u;
+            mask[1][lfo] = shape == LfoShape::Triangle     ? 0xFFFFFFFFu : 0u;
+            mask[2][lfo] = shape == LfoShape::SmoothRandom ? 0xFFFFFFFFu : 0u;
+
+            const int g = lfo / 4;
+            shapesUsed[g] = 0;
+            for (int i = 4 * g; i < 4 * g + 4; ++i)
+                shapesUsed[g] |= 1 << static_cast<int>(shapes[i]);
+        }
+
+        // full-scale phase, 2^32 = one cycle (see Utils::phaseFromPpq)
+        void setPhase(const int lfo, const std::uint32_t newPhase) noexcept { phase[lfo] = newPhase; }
+
+        [[nodiscard]] std::uint32_t getPhase(const int lfo) const noexcept { return phase[lfo]; }
+        [[nodiscard]] LfoShape getShape(const int lfo) const noexcept { return shapes[lfo]; }
+
+        // output at the current phase, [-1, 1]
+        [[nodiscard]] float value(const int lfo) const noexcept { return out[lfo]; }
+        [[nodiscard]] const float* values() const noexcept { return out; }
+
+        // step every LFO by one sample
+        void process() noexcept
+        {
+            const auto signBit = SIMD_MM(set1_epi32)(static_cast<int>(0x80000000u));
+
+            for (int g = 0; g < kGroups; ++g)
+            {
+                const auto oldPhase = SIMD_MM(load_si128)(reinterpret_cast<const SIMD_M128I*>(phase + 4 * g));
+                const auto newPhase = SIMD_MM(add_epi32)(oldPhase, SIMD_MM(load_si128)(reinterpret_cast<const SIMD_M128I*>(inc + 4 * g)));
+                SIMD_MM(store_si128)(reinterpret_cast<SIMD_M128I*>(phase + 4 * g), newPhase);
+
+                // unsigned old > new ⇔ the lane wrapped (inc < 2^31, so at most once)
+                const auto wrapped = SIMD_MM(cmpgt_epi32)(SIMD_MM(xor_si128)(oldPhase, signBit),
+                                                          SIMD_MM(xor_si128)(newPhase, signBit));
+                evaluate(g, newPhase, wrapped);
+            }
+        }
+
+        // step every LFO by numSamples, outputs land at the block end
+        void advance(const int numSamples) noexcept
+        {
+            if (numSamples <= 0) return;
+
+            alignas(16) std::uint32_t wrappedMask[NumLfos];
+            for (int i = 0; i < NumLfos; ++i)
+            {
+                const std::uint64_t total = phase[i] + static_cast<std::uint64_t>(inc[i]) * static_cast<std::uint64_t>(numSamples);
+                phase[i]       = static_cast<std::uint32_t>(total);
+                wrappedMask[i] = (total >> 32) != 0 ? 0xFFFFFFFFu : 0u;
+            }
+
+            for (int g = 0; g < kGroups; ++g)
+                evaluate(g, SIMD_MM(load_si128)(reinterpret_cast<const SIMD_M128I*>(phase + 4 * g)),
+                            SIMD_MM(load_si128)(reinterpret_cast<const SIMD_M128I*>(wrappedMask + 4 * g)));
+        }
+
+    private:
+        static float nextRandom(std::uint32_t& state) noexcept
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return static_cast<float>(static_cast<std::int32_t>(state)) * 4.656612873e-10f;    // 2^-31
+        }
+
+        void evaluate(const int g, const SIMD_M128I ph, const SIMD_M128I wrapped) noexcept
+        {
+            constexpr float kPhaseToRad = 1.462918079e-9f;      // π / 2^31
+            const int used = shapesUsed[g];
+            auto result = SIMD_MM(setzero_ps)();
+
+            if (used & (1 << static_cast<int>(LfoShape::Sine)))
+            {
+                const auto x = SIMD_MM(mul_ps)(SIMD_MM(cvtepi32_ps)(ph), SIMD_MM(set1_ps)(kPhaseToRad));
+                result = SIMD_MM(or_ps)(result, SIMD_MM(and_ps)(maskOf(0, g), fasterSin(x)));
+            }
+
+            if (used & (1 << static_cast<int>(LfoShape::Triangle)))
+            {
+                const auto s   = SIMD_MM(cvtepi32_ps)(SIMD_MM(sub_epi32)(ph, SIMD_MM(set1_epi32)(0x40000000)));
+                const auto abs = SIMD_MM(andnot_ps)(SIMD_MM(set1_ps)(-0.0f), s);
+                const auto tri = SIMD_MM(sub_ps)(SIMD_MM(set1_ps)(1.0f), SIMD_MM(mul_ps)(abs, SIMD_MM(set1_ps)(9.313225746e-10f)));    // 2^-30
+                result = SIMD_MM(or_ps)(result, SIMD_MM(and_ps)(maskOf(1, g), tri));
+            }
+
+            if (used & (1 << static_cast<int>(LfoShape::SmoothRandom)))
+            {
+                auto* prev = randPrev + 4 * g;
+                auto* next = randNext + 4 * g;
+
+                // xorshift32 per lane; lanes that wrapped move on to a new target
+                auto state = SIMD_MM(load_si128)(reinterpret_cast<const SIMD_M128I*>(rng + 4 * g));
+                auto fresh = SIMD_MM(xor_si128)(state, SIMD_MM(slli_epi32)(state, 13));
+                fresh      = SIMD_MM(xor_si128)(fresh, SIMD_MM(srli_epi32)(fresh, 17));
+                fresh      = SIMD_MM(xor_si128)(fresh, SIMD_MM(slli_epi32)(fresh, 5));
+                state      = SIMD_MM(or_si128)(SIMD_MM(and_si128)(wrapped, fresh), SIMD_MM(andnot_si128)(wrapped, state));
+                SIMD_MM(store_si128)(reinterpret_cast<SIMD_M128I*>(rng + 4 * g), state);
+
+                const auto w  = SIMD_MM(castsi128_ps)(wrapped);
+                const auto a0 = SIMD_MM(load_ps)(prev);
+                const auto b0 = SIMD_MM(load_ps)(next);
+                const auto a  = SIMD_MM(or_ps)(SIMD_MM(and_ps)(w, b0), SIMD_MM(andnot_ps)(w, a0));
+                const auto b  = SIMD_MM(or_ps)(SIMD_MM(and_ps)(w, SIMD_MM(mul_ps)(SIMD_MM(cvtepi32_ps)(state), SIMD_MM(set1_ps)(4.656612873e-10f))),
+                                               SIMD_MM(andnot_ps)(w, b0));
+                SIMD_MM(store_ps)(prev, a);
+                SIMD_MM(store_ps)(next, b);
+
+                // φ/2 ∈ [0, 2^31) → [0, π/2), eased weight sin² rises 0 → 1 over the cycle
+                const auto half = SIMD_MM(cvtepi32_ps)(SIMD_MM(srli_epi32)(ph, 1));
+                const auto s    = fasterSin(SIMD_MM(mul_ps)(half, SIMD_MM(set1_ps)(0.5f * kPhaseToRad)));
+                const auto rnd  = SIMD_MM(add_ps)(a, SIMD_MM(mul_ps)(SIMD_MM(mul_ps)(s, s), SIMD_MM(sub_ps)(b, a)));
+                result = SIMD_MM(or_ps)(result, SIMD_MM(and_ps)(maskOf(2, g), rnd));
+            }
+
+            SIMD_MM(store_ps)(out + 4 * g, result);
+        }
+
+        SIMD_M128 maskOf(const int shape, const int g) const noexcept
+        {
+            return SIMD_MM(load_ps)(reinterpret_cast<const float*>(mask[shape] + 4 * g));
+        }
+
+        alignas(16) std::uint32_t phase[NumLfos] {};
+        alignas(16) std::uint32_t inc[NumLfos] {};
+        alignas(16) std::uint32_t rng[NumLfos] {};
+        alignas(16) std::uint32_t mask[3][NumLfos] {};      // per-lane shape select
+        alignas(16) float randPrev[NumLfos] {};
+        alignas(16) float randNext[NumLfos] {};
+        alignas(16) float out[NumLfos] {};
+
+        double   ratesHz[NumLfos] {};
+        LfoShape shapes[NumLfos] {};
+        int      shapesUsed[kGroups] {};
+        double   sampleRate = 44100.0;
+    };
+}
+#endif
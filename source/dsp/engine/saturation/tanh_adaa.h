@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef CHRONOS_TANH_ADAA_H
+#define CHRONOS_TANH_ADAA_H
+
+#include "dsp/math/fastermath.h"
+
+namespace MarsDSP::DSP
+{
+    // First-order antiderivative anti-aliased tanh (Parker / Zavalishin / Le Bivic).
+    //
+    // Instead of sampling tanh(x[n]) it outputs the mean of tanh over the line
+    // segment between consecutive inputs:
+    //
+    //            F1(x[n]) - F1(x[n-1])
+    //   y[n] =  ───────────────────────,    F1(x) = log(cosh(x))
+    //              x[n] - x[n-1]
+    //
+    // which acts like a sinc²-shaped kernel on the nonlinearity. Aliases that
+    // fold into the lower half of the band drop by 20+ dB under heavy drive
+    // (simd_tanh_adaa_test), for one log-cosh and two divides per vector
+    // (plus a tanh when a lane takes the fallback below). Folds landing near
+    // Nyquist are attenuated far less. It also adds half a sample of group
+    // delay.
+    //
+    // When |x[n] - x[n-1]| < kEps the quotient is ill-conditioned (float
+    // rounding of F1 gets amplified by 1/Δ), so those lanes fall back to
+    // tanh((x[n] + x[n-1]) / 2). The fallback error is ≈ tanh''·Δ²/24 < 4e-6.
+    //
+    // Operates on 4 consecutive samples of ONE channel per SIMD call; the
+    // previous-sample vector is built by shifting in the last lane of the
+    // prior call, so the whole block vectorizes even though the filter has
+    // one sample of memory. Scalar process() handles block tails and shares
+    // the same state.
+    template<TanhTier FallbackTier = TanhTier::Pade76>
+    struct TanhADAA1
+    {
+        // below this spacing the quotient is replaced by the midpoint fallback
+        static constexpr float kEps = 1.0e-2f;
+
+        // inputs are clamped so inf / huge values cannot turn F1 differences
+        // into inf - inf; tanh is already 1 to float precision well before this
+        static constexpr float kClamp = 32.0f;
+
+        float x1  = 0.0f;   // previous input
+        float f1  = 0.0f;   // F1(previous input)
+
+        void reset() noexcept
+        {
+            x1 = 0.0f;
+            f1 = 0.0f;
+        }
+
+        float process(const float xIn) noexcept
+        {
+            const float x  = std::clamp(xIn, -kClamp, kClamp);
+            const float fx = fasterLogCosh(x);
+            const float dx = x - x1;
+
+            const float y = std::abs(dx) < kEps
+                          ? fasterTanhTiered<FallbackTier>(0.5f * (x + x1))
+                          : (fx - f1) / dx;
+
+            x1 = x;
+            f1 = fx;
+            return y;
+        }
+
+        SIMD_M128 process(const SIMD_M128 xIn) noexcept
+        {
+            const auto x  = SIMD_MM(max_ps)(SIMD_MM(min_ps)(xIn, SIMD_MM(set1_ps)(kClamp)),
+                                            SIMD_MM(set1_ps)(-kClamp));
+            const auto fx = fasterLogCosh(x);
+
+            // [carry, x0, x1, x2] ← shift the carried sample into lane 0
+            const auto xPrev = shiftIn(x, x1);
+            const auto fPrev = shiftIn(fx, f1);
+
+            const auto dx   = SIMD_MM(sub_ps)(x, xPrev);
+            const auto absD = SIMD_MM(andnot_ps)(SIMD_MM(set1_ps)(-0.0f), dx);
+            const auto near = SIMD_MM(cmplt_ps)(absD, SIMD_MM(set1_ps)(kEps));
+
+            // keep the divide finite on fallback lanes, they get masked out anyway
+            const auto one     = SIMD_MM(set1_ps)(1.0f);
+            const auto safeDx  = SIMD_MM(or_ps)(SIMD_MM(and_ps)(near, one), SIMD_MM(andnot_ps)(near, dx));
+            const auto yAdaa   = SIMD_MM(div_ps)(SIMD_MM(sub_ps)(fx, fPrev), safeDx);
+
+            // carry lane 3 into the next call
+            x1 = SIMD_MM(cvtss_f32)(SIMD_MM(shuffle_ps)(x,  x,  SIMD_MM_SHUFFLE(3, 3, 3, 3)));
+            f1 = SIMD_MM(cvtss_f32)(SIMD_MM(shuffle_ps)(fx, fx, SIMD_MM_SHUFFLE(3, 3, 3, 3)));
+
+            // driven program material rarely has 4 near-equal neighbours in a
+            // row, so only pay for the fallback tanh when some lane needs it
+            if (SIMD_MM(movemask_ps)(near) == 0)
+                return yAdaa;
+
+            const auto mid     = SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(0.5f), SIMD_MM(add_ps)(x, xPrev));
+            const auto yMid    = fasterTanhTiered<FallbackTier>(mid);
+
+            return SIMD_MM(or_ps)(SIMD_MM(and_ps)(near, yMid), SIMD_MM(andnot_ps)(near, yAdaa));
+        }
+
+    private:
+        // [carry, v0, v1, v2]
+        static SIMD_M128 shiftIn(const SIMD_M128 v, const float carry) noexcept
+        {
+            // [carry, carry, v0, v0]
+            const auto t = SIMD_MM(shuffle_ps)(SIMD_MM(set1_ps)(carry), v, SIMD_MM_SHUFFLE(0, 0, 0, 0));
+            // [t0, t2, v1, v2]
+            return SIMD_MM(shuffle_ps)(t, v, SIMD_MM_SHUFFLE(2, 1, 2, 0));
+        }
+    };
+}
+#endif
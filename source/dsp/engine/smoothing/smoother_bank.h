@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef CHRONOS_SMOOTHER_BANK_H
+#define CHRONOS_SMOOTHER_BANK_H
+
+#include <cmath>
+#include <cstdint>
+#include "dsp/math/fastermath.h"
+
+namespace MarsDSP::DSP
+{
+    // Block-rate parameter smoothers, four per SIMD register in
+    // structure-of-arrays layout (all currents together, all targets
+    // together, ...), so one pass over the registers updates every parameter.
+    //
+    // Every lane ramps linearly from its current value to its block-end value
+    // over the block. Linear lanes reach their target at the block end; lag
+    // lanes (one-pole, see setLagMs) only close part of the gap:
+    //
+    //   end = target + (current - target) · (1 - lp)^n
+    //
+    // beginBlock() computes every end value and per-sample delta at once,
+    // then broadcasts each lane into a Ramp whose quad(vQ) is one mul + add:
+    //
+    //   samples [4q, 4q + 3] = base + step · q,  base = cur + delta · {0,1,2,3}, step = 4 · delta
+    //
+    // so the inner loops carry a single quad counter instead of rebuilding
+    // every parameter vector from set1/setr on each iteration.
+    template<int NumParams = 4>
+    class SmootherBank
+    {
+    public:
+        static_assert(NumParams > 0 && NumParams % 4 == 0, "SmootherBank runs four parameters per register");
+        static constexpr int kGroups = NumParams / 4;
+
+        // per-parameter ramp, ready to be held in registers for a whole pass
+        struct Ramp
+        {
+            SIMD_M128 base, step;
+
+            // samples [4q, 4q + 3], vQ = q in every lane
+            SIMD_M128 quad(const SIMD_M128 vQ) const noexcept
+            {
+                return SIMD_MM(add_ps)(base, SIMD_MM(mul_ps)(step, vQ));
+            }
+        };
+
+        // every lane starts linear at 0
+        SmootherBank() = default;
+
+        // one-pole lag, time constant in ms: lp = 1 - e^(-2π / (ms · fs))
+        void setLagMs(const int p, const double milliseconds, const double sampleRate) noexcept
+        {
+            const float samples = static_cast<float>(milliseconds * 0.001 * sampleRate);
+            const float lp      = 1.0f - fasterExp(-2.0f * static_cast<float>(M_PI) / samples);
+            // beginBlock raises 1 - lp to the block length; keep its log so
+            // that costs one fasterExp2 per register instead of a libm pow
+            lagLog2[p] = fasterLog2(1.0f - lp);
+            isLag[p]   = 0xFFFFFFFFu;
+        }
+
+        void setLinear(const int p) noexcept
+        {
+            lagLog2[p] = 0.0f;
+            isLag[p]   = 0u;
+        }
+
+        void setTarget(const int p, const float value) noexcept { target[p] = value; }
+
+        // jump straight to value, the next block does not ramp
+        void snap(const int p, const float value) noexcept
+        {
+            current[p] = target[p] = blockEnd[p] = value;
+            delta[p] = 0.0f;
+        }
+
+        // end values, deltas and quad ramps for the next numSamples
+        void beginBlock(const int numSamples) noexcept
+        {
+            const float invN = numSamples > 0 ? 1.0f / static_cast<float>(numSamples) : 0.0f;
+            const auto vN    = SIMD_MM(set1_ps)(static_cast<float>(numSamples));
+            const auto vInvN = SIMD_MM(set1_ps)(invN);
+
+            for (int g = 0; g < kGroups; ++g)
+            {
+                const auto cur = SIMD_MM(load_ps)(current + 4 * g);
+                const auto tgt = SIMD_MM(load_ps)(target + 4 * g);
+
+                // linear lanes mask the decay to 0 and land on the target
+                const auto lagMask = SIMD_MM(load_ps)(reinterpret_cast<const float*>(isLag + 4 * g));
+                const auto decay   = SIMD_MM(and_ps)(lagMask, fasterExp2(SIMD_MM(mul_ps)(SIMD_MM(load_ps)(lagLog2 + 4 * g), vN)));
+                const auto end     = SIMD_MM(add_ps)(tgt, SIMD_MM(mul_ps)(SIMD_MM(sub_ps)(cur, tgt), decay));
+                const auto d       = SIMD_MM(mul_ps)(SIMD_MM(sub_ps)(end, cur), vInvN);
+
+                SIMD_MM(store_ps)(blockEnd + 4 * g, end);
+                SIMD_MM(store_ps)(delta + 4 * g, d);
+
+                splat<0>(g, cur, d);
+                splat<1>(g, cur, d);
+                splat<2>(g, cur, d);
+                splat<3>(g, cur, d);
+            }
+        }
+
+        // where lane p would end a numSamples block heading for toward,
+        // without touching the bank; same arithmetic as beginBlock
+        [[nodiscard]] float projectEnd(const int p, const float toward, const int numSamples) const noexcept
+        {
+            if (isLag[p] == 0u)
+                return toward;
+            const float decay = SIMD_MM(cvtss_f32)(fasterExp2(SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(lagLog2[p]),
+                                                                              SIMD_MM(set1_ps)(static_cast<float>(numSamples)))));
+            return toward + (current[p] - toward) * decay;
+        }
+
+        // this block's end becomes the next block's start
+        void endBlock() noexcept
+        {
+            const auto zero = SIMD_MM(setzero_ps)();
+            for (int g = 0; g < kGroups; ++g)
+            {
+                SIMD_MM(store_ps)(current + 4 * g, SIMD_MM(load_ps)(blockEnd + 4 * g));
+                SIMD_MM(store_ps)(delta + 4 * g, zero);
+            }
+        }
+
+        [[nodiscard]] Ramp ramp(const int p) const noexcept
+        {
+            return { SIMD_MM(load_ps)(base[p]), SIMD_MM(load_ps)(step[p]) };
+        }
+
+        // scalar value at sample offset i within the block
+        [[nodiscard]] float at(const int p, const int i) const noexcept
+        {
+            return current[p] + delta[p] * static_cast<float>(i);
+        }
+
+        [[nodiscard]] float getCurrent(const int p)  const noexcept { return current[p]; }
+        [[nodiscard]] float getBlockEnd(const int p) const noexcept { return blockEnd[p]; }
+        [[nodiscard]] float getTarget(const int p)   const noexcept { return target[p]; }
+
+    private:
+        template<int Lane>
+        void splat(const int g, const SIMD_M128 cur, const SIMD_M128 d) noexcept
+        {
+            const auto c = SIMD_MM(shuffle_ps)(cur, cur, SIMD_MM_SHUFFLE(Lane, Lane, Lane, Lane));
+            const auto s = SIMD_MM(shuffle_ps)(d,   d,   SIMD_MM_SHUFFLE(Lane, Lane, Lane, Lane));
+            SIMD_MM(store_ps)(base[4 * g + Lane], SIMD_MM(add_ps)(c, SIMD_MM(mul_ps)(s, SIMD_MM(setr_ps)(0.0f, 1.0f, 2.0f, 3.0f))));
+            SIMD_MM(store_ps)(step[4 * g + Lane], SIMD_MM(mul_ps)(s, SIMD_MM(set1_ps)(4.0f)));
+        }
+
+        alignas(16) float current[NumParams] {};
+        alignas(16) float target[NumParams] {};
+        alignas(16) float blockEnd[NumParams] {};
+        alignas(16) float delta[NumParams] {};
+        alignas(16) float lagLog2[NumParams] {};
+        alignas(16) std::uint32_t isLag[NumParams] {};     // per-lane one-pole select
+        alignas(16) float base[NumParams][4] {};
+        alignas(16) float step[NumParams][4] {};
+    };
+}
+#endif
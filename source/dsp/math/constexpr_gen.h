@@ -0,0 +1,212 @@
+#pragma once
+
+#ifndef CHRONOS_CONSTEXPR_GEN_H
+#define CHRONOS_CONSTEXPR_GEN_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <gcem.hpp>
+
+namespace MarsDSP::ConstexprGen
+{
+    // compile-time generators for approximant coefficients, lookup tables and
+    // filter prototypes. everything here is evaluated in double (gcem where a
+    // transcendental is needed) and rounded to float once, so a table built
+    // here is as good as one filled at startup with the double libm function,
+    // without the startup cost or the static-init-order hazard.
+    //
+    //   inline constexpr auto table = makeTable<1026>(0.0, 1.0 / 128.0, [](double x) { return gcem::tanh(x); });
+
+    // ---- rational approximants ----
+    //
+    // r(x) = (num[0] + num[1]·x + …) / (den[0] + den[1]·x + …)
+    template<std::size_t M, std::size_t N>
+    struct Rational
+    {
+        std::array<double, M + 1> num {};
+        std::array<double, N + 1> den {};
+
+        constexpr double operator()(const double x) const noexcept
+        {
+            double n = 0.0, d = 0.0;
+            for (std::size_t i = M + 1; i-- > 0;) n = n * x + num[i];
+            for (std::size_t i = N + 1; i-- > 0;) d = d * x + den[i];
+            return n / d;
+        }
+    };
+
+    // taylor coefficients about 0, c[k] multiplies x^k
+    template<std::size_t K>
+    constexpr std::array<double, K> sinTaylor() noexcept
+    {
+        std::array<double, K> c {};
+        double term = 1.0;                          // 1 / k!
+        for (std::size_t k = 1; k < K; ++k)
+        {
+            term /= static_cast<double>(k);
+            if (k % 2 == 1) c[k] = (k % 4 == 1) ? term : -term;
+        }
+        return c;
+    }
+
+    template<std::size_t K>
+    constexpr std::array<double, K> cosTaylor() noexcept
+    {
+        std::array<double, K> c {};
+        double term = 1.0;
+        c[0] = 1.0;
+        for (std::size_t k = 1; k < K; ++k)
+        {
+            term /= static_cast<double>(k);
+            if (k % 2 == 0) c[k] = (k % 4 == 0) ? term : -term;
+        }
+        return c;
+    }
+
+    // [M/N] pade approximant from taylor coefficients, normalised to den[0] = 1.
+    // the denominator comes from the N×N linear system
+    //
+    //   Σ_{j=1..N} den[j]·c[M+k-j] = -c[M+k]      k = 1..N
+    //
+    // solved by gaussian elimination with partial pivoting; the numerator is
+    // then the taylor product truncated at x^M.
+    template<std::size_t M, std::size_t N, std::size_t K>
+    constexpr Rational<M, N> padeFromTaylor(const std::array<double, K>& c) noexcept
+    {
+        static_assert(K > M + N, "pade [M/N] needs M + N + 1 taylor terms");
+
+        auto coeff = [&c](const std::ptrdiff_t i) { return i < 0 ? 0.0 : c[static_cast<std::size_t>(i)]; };
+
+        std::array<std::array<double, N + 1>, N> a {};   // augmented [A | b]
+        for (std::size_t k = 0; k < N; ++k)
+        {
+            for (std::size_t j = 0; j < N; ++j)
+                a[k][j] = coeff(static_cast<std::ptrdiff_t>(M + k) - static_cast<std::ptrdiff_t>(j));
+            a[k][N] = -c[M + k + 1];
+        }
+
+        for (std::size_t col = 0; col < N; ++col)
+        {
+            std::size_t pivot = col;
+            for (std::size_t r = col + 1; r < N; ++r)
+                if (gcem::abs(a[r][col]) > gcem::abs(a[pivot][col])) pivot = r;
+            std::swap(a[col], a[pivot]);
+
+            for (std::size_t r = 0; r < N; ++r)
+            {
+                if (r == col) continue;
+                const double f = a[r][col] / a[col][col];
+                for (std::size_t j = col; j <= N; ++j) a[r][j] -= f * a[col][j];
+            }
+        }
+
+        Rational<M, N> r {};
+        r.den[0] = 1.0;
+        for (std::size_t j = 0; j < N; ++j) r.den[j + 1] = a[j][N] / a[j][j];
+
+        for (std::size_t i = 0; i <= M; ++i)
+            for (std::size_t j = 0; j <= N && j <= i; ++j)
+                r.num[i] += r.den[j] * c[i - j];
+
+        return r;
+    }
+
+    // lambert's continued fraction, truncated after `Depth` levels
+    //
+    //   tanh(x) = x / (1 + x²/(3 + x²/(5 + …)))
+    //   tan(x)  = x / (1 - x²/(3 - x²/(5 - …)))
+    //
+    // the convergents are the diagonal-ish pade approximants of tanh / tan, and
+    // the recurrence keeps them in integers:
+    //
+    //   den_k = (2k+1)·den_{k-1} + t·den_{k-2}      t = ±x²
+    //   num_k = (2k+1)·num_{k-1} + t·num_{k-2}
+    //
+    // returned in powers of x² with the outer x left off the numerator, which
+    // is the layout the pade kernels in fastermath.h evaluate:
+    //
+    //   tanh(x) ≈ x · num(x²) / den(x²)
+    //
+    // even Depth gives the (Depth+1, Depth) approximant: 4 → (5,4), 6 → (7,6).
+    template<std::size_t Depth>
+    constexpr Rational<Depth / 2, Depth / 2> lambertFraction(const double sign) noexcept
+    {
+        static_assert(Depth % 2 == 0, "odd depths have unequal num / den degree in x²");
+        constexpr std::size_t D = Depth / 2;
+
+        // index 0 = convergent k-2, 1 = k-1
+        std::array<std::array<double, D + 2>, 2> num {}, den {};
+        num[0][0] = 0.0;  den[0][0] = 1.0;          // k = -1
+        num[1][0] = 1.0;  den[1][0] = 1.0;          // k = 0
+
+        for (std::size_t k = 1; k <= Depth; ++k)
+        {
+            const double b = static_cast<double>(2 * k + 1);
+            std::array<double, D + 2> n {}, d {};
+            for (std::size_t i = 0; i < D + 2; ++i)
+            {
+                n[i] = b * num[1][i] + (i > 0 ? sign * num[0][i - 1] : 0.0);
+                d[i] = b * den[1][i] + (i > 0 ? sign * den[0][i - 1] : 0.0);
+            }
+            num[0] = num[1];  num[1] = n;
+            den[0] = den[1];  den[1] = d;
+        }
+
+        Rational<D, D> r {};
+        for (std::size_t i = 0; i <= D; ++i)
+        {
+            r.num[i] = num[1][i];
+            r.den[i] = den[1][i];
+        }
+        return r;
+    }
+
+    template<std::size_t Depth>
+    constexpr auto tanhLambert() noexcept { return lambertFraction<Depth>(1.0); }
+
+    template<std::size_t Depth>
+    constexpr auto tanLambert() noexcept { return lambertFraction<Depth>(-1.0); }
+
+    // ---- lookup tables ----
+    template<std::size_t N>
+    struct Table
+    {
+        alignas(16) float v[N];
+    };
+
+    // v[i] = fn(x0 + i·step), evaluated in double and rounded once to float
+    template<std::size_t N, typename Fn>
+    constexpr Table<N> makeTable(const double x0, const double step, Fn&& fn) noexcept
+    {
+        Table<N> t {};
+        for (std::size_t i = 0; i < N; ++i)
+            t.v[i] = static_cast<float>(fn(x0 + static_cast<double>(i) * step));
+        return t;
+    }
+
+    // ---- filter prototypes ----
+    //
+    // butterworth of order N as a cascade of biquads: pole pair k sits at
+    // angle ψ_k from the negative real axis, giving
+    //
+    //   ψ_k = (2k + 1 + N mod 2) · π / (2N)      Q_k = 1 / (2·cos(ψ_k))
+    //
+    // sorted low Q → high Q. odd orders need one extra first-order section at
+    // the cutoff, which is not part of the array.
+    template<std::size_t Order>
+    constexpr std::array<double, Order / 2> butterworthQ() noexcept
+    {
+        static_assert(Order >= 2, "a biquad cascade needs at least order 2");
+
+        std::array<double, Order / 2> q {};
+        for (std::size_t k = 0; k < Order / 2; ++k)
+        {
+            const double psi = static_cast<double>(2 * k + 1 + Order % 2)
+                             * 3.14159265358979323846 / static_cast<double>(2 * Order);
+            q[k] = 1.0 / (2.0 * gcem::cos(psi));
+        }
+        return q;
+    }
+}
+#endif
@@ -3,9 +3,12 @@
 #ifndef CHRONOS_FASTERMATH_H
 #define CHRONOS_FASTERMATH_H
 
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <algorithm>
 #include "simd/simd_config.h"
+#include "dsp/math/constexpr_gen.h"
 
 namespace MarsDSP::inline FasterMath
 {
@@ -23,15 +26,24 @@ namespace MarsDSP::inline FasterMath
 
     namespace PadeSinCoeffs
     {
-        constexpr float N0 = -11511339840.0f;   // num x⁰ (before outer -x)
-        constexpr float N1 =  1640635920.0f;    // num x²
-        constexpr float N2 = -52785432.0f;      // num x⁴
-        constexpr float N3 =  479249.0f;        // num x⁶
-
-        constexpr float D0 =  11511339840.0f;   // den x⁰
-        constexpr float D1 =  277920720.0f;     // den x²
-        constexpr float D2 =  3177720.0f;       // den x⁴
-        constexpr float D3 =  18361.0f;         // den x⁶
+        // solved from the taylor series at compile time, den[0] = 1; kScale
+        // is the common denominator that makes every coefficient an integer
+        constexpr auto   kPade  = ConstexprGen::padeFromTaylor<7, 6>(ConstexprGen::sinTaylor<14>());
+        constexpr double kScale = 11511339840.0;
+
+        // snap to the exact integer before narrowing: D1 = 277920720 is a float
+        // tie, so any double residue from the solve would round it the wrong way
+        constexpr float scaled(const double c) { return static_cast<float>(gcem::round(c * kScale)); }
+
+        constexpr float N0 = scaled(-kPade.num[1]);   // num x⁰ (before outer -x)
+        constexpr float N1 = scaled(-kPade.num[3]);   // num x²
+        constexpr float N2 = scaled(-kPade.num[5]);   // num x⁴
+        constexpr float N3 = scaled(-kPade.num[7]);   // num x⁶
+
+        constexpr float D0 = scaled(kPade.den[0]);    // den x⁰
+        constexpr float D1 = scaled(kPade.den[2]);    // den x²
+        constexpr float D2 = scaled(kPade.den[4]);    // den x⁴
+        constexpr float D3 = scaled(kPade.den[6]);    // den x⁶
     }
 
     inline float padeSinApprox(const float x) noexcept
@@ -87,15 +99,20 @@ namespace MarsDSP::inline FasterMath
     namespace PadeCosCoeffs
     {
         // cos(x) is an even function so signs are flipped relative to sin(x)
-        constexpr float N0 =  39251520.0f;    // num x⁰
-        constexpr float N1 = -18471600.0f;    // num x²
-        constexpr float N2 =  1075032.0f;     // num x⁴
-        constexpr float N3 = -14615.0f;       // num x⁶
+        constexpr auto   kPade  = ConstexprGen::padeFromTaylor<6, 6>(ConstexprGen::cosTaylor<13>());
+        constexpr double kScale = 39251520.0;
+
+        constexpr float scaled(const double c) { return static_cast<float>(gcem::round(c * kScale)); }
 
-        constexpr float D0 =  39251520.0f;    // den x⁰
-        constexpr float D1 =  1154160.0f;     // den x²
-        constexpr float D2 =  16632.0f;       // den x⁴
-        constexpr float D3 =  127.0f;         // den x⁶
+        constexpr float N0 = scaled(kPade.num[0]);    // num x⁰
+        constexpr float N1 = scaled(kPade.num[2]);    // num x²
+        constexpr float N2 = scaled(kPade.num[4]);    // num x⁴
+        constexpr float N3 = scaled(kPade.num[6]);    // num x⁶
+
+        constexpr float D0 = scaled(kPade.den[0]);    // den x⁰
+        constexpr float D1 = scaled(kPade.den[2]);    // den x²
+        constexpr float D2 = scaled(kPade.den[4]);    // den x⁴
+        constexpr float D3 = scaled(kPade.den[6]);    // den x⁶
     }
 
     inline float padeCosApprox(const float x) noexcept
@@ -146,18 +163,147 @@ namespace MarsDSP::inline FasterMath
         return SIMD_MM(div_ps)(num, den);
     }
 //==============================================================================//
-    namespace PadeTanCoeffs
+    // full-range fused sin + cos
+    //
+    //   k = round(x · 2/π),   r = x - k·π/2   ∈ [-π/4, π/4]
+    //
+    // π/2 is split cody-waite style into three floats. P1 has only 8
+    // significant bits so k·P1 is exact and the first subtraction loses
+    // nothing; P2 and P3 pick up the remaining bits.
+    //
+    // on the reduced range both functions are short minimax polynomials in
+    // r², so sin and cos share the reduction, r² and r⁴ and need no divide.
+    // the quadrant (k mod 4) then swaps and negates:
+    //
+    //   q | sin x | cos x
+    //   --+-------+------
+    //   0 |  s(r) |  c(r)
+    //   1 |  c(r) | -s(r)
+    //   2 | -s(r) | -c(r)
+    //   3 | -c(r) |  s(r)
+    //
+    // max abs error vs double-precision sin/cos: ~1e-7 for |x| ≤ 8192,
+    // ~1e-6 up to 1e5. past that k·P2 starts rounding and the error grows
+    // with |x|. beyond kMaxRange the float spacing of x is ≥ 0.5 rad and the
+    // phase carries no information, so r is forced to 0 and only the quadrant
+    // survives: every finite input returns a finite value in [-1, 1]. ±inf
+    // is treated like a huge finite input, NaN propagates.
+    //
+    // both polynomials are evaluated estrin-style (r⁴ in parallel with the
+    // inner pair) – the kernel is latency-bound, not divide-bound.
+    namespace SinCosCoeffs
+    {
+        constexpr float kTwoOverPi = 0.636619772367581343f;
+        constexpr float kMaxRange  = 4194304.0f;          // 2^22
+
+        constexpr float P1 = 1.5703125f;                     // π/2 hi, 8 bits
+        constexpr float P2 = 4.837512969970703125e-4f;       // π/2 mid
+        constexpr float P3 = 7.54978995489188216e-8f;        // π/2 lo
+
+        // sin(r) ≈ r + r³·(S1 + r²·S2 + r⁴·S3)
+        constexpr float S1 = -1.6666654611e-1f;
+        constexpr float S2 =  8.3321608736e-3f;
+        constexpr float S3 = -1.9515295891e-4f;
+
+        // cos(r) ≈ 1 - r²/2 + r⁴·(C1 + r²·C2 + r⁴·C3)
+        constexpr float C1 =  4.166664568298827e-2f;
+        constexpr float C2 = -1.388731625493765e-3f;
+        constexpr float C3 =  2.443315711809948e-5f;
+    }
+
+    inline void fasterSinCos(const float x, float& sinOut, float& cosOut) noexcept
     {
-        // (7,6) pade approximant of tan(x)
-        constexpr float N0 = -135135.0f;
-        constexpr float N1 = 17325.0f;
-        constexpr float N2 = -378.0f;
-        constexpr float N3 = 1.0f;
+        using namespace SinCosCoeffs;
 
-        constexpr float D0 = -135135.0f;
-        constexpr float D1 = 62370.0f;
-        constexpr float D2 = -3150.0f;
-        constexpr float D3 = 28.0f;
+        const float k = std::nearbyint(x * kTwoOverPi);
+        float r = ((x - k * P1) - k * P2) - k * P3;
+        if (std::abs(x) > kMaxRange)
+            r = 0.0f;
+
+        // NaN, ±inf and |k| ≥ 2^31 take quadrant 0, as cvtps saturating to
+        // 0x80000000 does in the SIMD path; the test is false for NaN, so k
+        // never reaches the int conversion and r still carries the NaN
+        const float kq = std::abs(k) < 2147483648.0f ? k : 0.0f;
+
+        // k mod 4 without an int conversion that could overflow
+        const int q = static_cast<int>(kq - 4.0f * std::floor(kq * 0.25f));
+
+        const float r2 = r * r;
+        const float r4 = r2 * r2;
+        const float s  = r + r * r2 * ((S1 + r2 * S2) + r4 * S3);
+        const float c  = (1.0f - 0.5f * r2) + r4 * ((C1 + r2 * C2) + r4 * C3);
+
+        const float sq = (q & 1) ? c : s;
+        const float cq = (q & 1) ? s : c;
+
+        sinOut = (q & 2)       ? -sq : sq;
+        cosOut = ((q + 1) & 2) ? -cq : cq;
+    }
+
+    inline void fasterSinCos(const SIMD_M128 x, SIMD_M128& sinOut, SIMD_M128& cosOut) noexcept
+    {
+        using namespace SinCosCoeffs;
+
+        const auto signMask = SIMD_MM(set1_ps)(-0.0f);
+
+        // cvtps rounds to nearest. lanes past 2^31 saturate to 0x80000000,
+        // which is ≡ 0 mod 4 – the right quadrant, since such floats are
+        // multiples of 256. their k is wrong, but r is discarded below.
+        const auto ki = SIMD_MM(cvtps_epi32)(SIMD_MM(mul_ps)(x, SIMD_MM(set1_ps)(kTwoOverPi)));
+        const auto k  = SIMD_MM(cvtepi32_ps)(ki);
+
+        // off the critical path; false for NaN so it propagates through r
+        const auto huge = SIMD_MM(cmpgt_ps)(SIMD_MM(andnot_ps)(signMask, x), SIMD_MM(set1_ps)(kMaxRange));
+
+        // r = ((x - k·P1) - k·P2) - k·P3
+        auto r = SIMD_MM(sub_ps)(x, SIMD_MM(mul_ps)(k, SIMD_MM(set1_ps)(P1)));
+        r      = SIMD_MM(sub_ps)(r, SIMD_MM(mul_ps)(k, SIMD_MM(set1_ps)(P2)));
+        r      = SIMD_MM(sub_ps)(r, SIMD_MM(mul_ps)(k, SIMD_MM(set1_ps)(P3)));
+        r      = SIMD_MM(andnot_ps)(huge, r);
+
+        const auto r2 = SIMD_MM(mul_ps)(r, r);
+        const auto r3 = SIMD_MM(mul_ps)(r, r2);
+        const auto r4 = SIMD_MM(mul_ps)(r2, r2);
+
+        // sin(r) = r + r³·((S1 + r²·S2) + r⁴·S3)
+        auto sp = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S1), SIMD_MM(mul_ps)(r2, SIMD_MM(set1_ps)(S2)));
+        sp      = SIMD_MM(add_ps)(sp, SIMD_MM(mul_ps)(r4, SIMD_MM(set1_ps)(S3)));
+        const auto s = SIMD_MM(add_ps)(r, SIMD_MM(mul_ps)(r3, sp));
+
+        // cos(r) = (1 - r²/2) + r⁴·((C1 + r²·C2) + r⁴·C3)
+        auto cp = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(C1), SIMD_MM(mul_ps)(r2, SIMD_MM(set1_ps)(C2)));
+        cp      = SIMD_MM(add_ps)(cp, SIMD_MM(mul_ps)(r4, SIMD_MM(set1_ps)(C3)));
+        const auto c = SIMD_MM(add_ps)(SIMD_MM(sub_ps)(SIMD_MM(set1_ps)(1.0f), SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(0.5f), r2)),
+                                       SIMD_MM(mul_ps)(r4, cp));
+
+        // quadrant bits → lane masks, all computed from ki off the critical path
+        const auto one  = SIMD_MM(set1_epi32)(1);
+        const auto swap = SIMD_MM(castsi128_ps)(SIMD_MM(cmpeq_epi32)(SIMD_MM(and_si128)(ki, one), one));
+        const auto sNeg = SIMD_MM(and_ps)(signMask, SIMD_MM(castsi128_ps)(SIMD_MM(slli_epi32)(ki, 30)));                            // bit 1 of q
+        const auto cNeg = SIMD_MM(and_ps)(signMask, SIMD_MM(castsi128_ps)(SIMD_MM(slli_epi32)(SIMD_MM(add_epi32)(ki, one), 30)));  // bit 1 of q+1
+
+        // xor swap: d is s ^ c on odd quadrants, 0 otherwise
+        const auto d = SIMD_MM(and_ps)(swap, SIMD_MM(xor_ps)(s, c));
+
+        sinOut = SIMD_MM(xor_ps)(s, SIMD_MM(xor_ps)(d, sNeg));
+        cosOut = SIMD_MM(xor_ps)(c, SIMD_MM(xor_ps)(d, cNeg));
+    }
+//==============================================================================//
+    namespace PadeTanCoeffs
+    {
+        // (7,6) pade approximant of tan(x), lambert's continued fraction at
+        // depth 6. num and den are both negated; the ratio is unchanged
+        constexpr auto kPade = ConstexprGen::tanLambert<6>();
+
+        constexpr float N0 = static_cast<float>(-kPade.num[0]);   // -135135
+        constexpr float N1 = static_cast<float>(-kPade.num[1]);   //  17325
+        constexpr float N2 = static_cast<float>(-kPade.num[2]);   // -378
+        constexpr float N3 = static_cast<float>(-kPade.num[3]);   //  1
+
+        constexpr float D0 = static_cast<float>(-kPade.den[0]);   // -135135
+        constexpr float D1 = static_cast<float>(-kPade.den[1]);   //  62370
+        constexpr float D2 = static_cast<float>(-kPade.den[2]);   // -3150
+        constexpr float D3 = static_cast<float>(-kPade.den[3]);   //  28
     }
 
     inline float padeTanApprox(const float x) noexcept
@@ -207,15 +353,18 @@ namespace MarsDSP::inline FasterMath
 //==============================================================================//
     namespace PadeTanhCoeffs
     {
-        constexpr float N0 = 135135.0f;
-        constexpr float N1 = 17325.0f;
-        constexpr float N2 = 378.0f;
-        constexpr float N3 = 1.0f;
-
-        constexpr float D0 = 135135.0f;
-        constexpr float D1 = 62370.0f;
-        constexpr float D2 = 3150.0f;
-        constexpr float D3 = 28.0f;
+        // (7,6) pade approximant of tanh(x), lambert's continued fraction at depth 6
+        constexpr auto kPade = ConstexprGen::tanhLambert<6>();
+
+        constexpr float N0 = static_cast<float>(kPade.num[0]);    // 135135
+        constexpr float N1 = static_cast<float>(kPade.num[1]);    // 17325
+        constexpr float N2 = static_cast<float>(kPade.num[2]);    // 378
+        constexpr float N3 = static_cast<float>(kPade.num[3]);    // 1
+
+        constexpr float D0 = static_cast<float>(kPade.den[0]);    // 135135
+        constexpr float D1 = static_cast<float>(kPade.den[1]);    // 62370
+        constexpr float D2 = static_cast<float>(kPade.den[2]);    // 3150
+        constexpr float D3 = static_cast<float>(kPade.den[3]);    // 28
     }
 
     inline float padeTanhApprox(const float x) noexcept
@@ -278,6 +427,531 @@ namespace MarsDSP::inline FasterMath
 
         return fasterTanh(xbounded);
     }
+//==============================================================================//
+    // reciprocal estimate refined by one newton-raphson step
+    //
+    //   r₀ = rcp_ps(d)              ~12-bit estimate
+    //   r₁ = r₀ · (2 - d·r₀)        ~23-bit, error squares per step
+    //
+    // rcp_ps + 2 mul + 1 sub keeps the divider port free. that pays off on
+    // cores with a slow div_ps (older / low-power x86, most NEON via SIMDe);
+    // on recent desktop cores div_ps is pipelined well enough that this is a
+    // wash, so check perf_tanh_test on the target before picking Pade76Rcp.
+    // relative error ~2 ulp instead of 0.5 ulp.
+    inline SIMD_M128 fasterRcp(const SIMD_M128 d) noexcept
+    {
+        const auto vTwo = SIMD_MM(set1_ps)(2.0f);
+        const auto r0   = SIMD_MM(rcp_ps)(d);
+
+        return SIMD_MM(mul_ps)(r0, SIMD_MM(sub_ps)(vTwo, SIMD_MM(mul_ps)(d, r0)));
+    }
+
+    // [7/6] pade tanh with the final div_ps swapped for fasterRcp.
+    // same clamp as fasterTanhBounded: [-5, 5]
+    //
+    // max abs error vs std::tanh over all finite x: ~1.0e-4 (set by the clamp,
+    // the reciprocal itself adds < 5e-7)
+    inline SIMD_M128 fasterTanhRcpBounded(const SIMD_M128 x) noexcept
+    {
+        using namespace PadeTanhCoeffs;
+
+        const auto v5  = SIMD_MM(set1_ps)(5.0f);
+        const auto vn5 = SIMD_MM(set1_ps)(-5.0f);
+        const auto xb  = SIMD_MM(min_ps)(v5, SIMD_MM(max_ps)(vn5, x));
+
+        const auto x2   = SIMD_MM(mul_ps)(xb, xb);
+
+        auto numInner   = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(N2), SIMD_MM(mul_ps)(x2, SIMD_MM(set1_ps)(N3)));
+        numInner        = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(N1), SIMD_MM(mul_ps)(x2, numInner));
+        const auto poly = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(N0), SIMD_MM(mul_ps)(x2, numInner));
+        const auto num  = SIMD_MM(mul_ps)(xb, poly);
+
+        auto denInner   = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(D2), SIMD_MM(mul_ps)(x2, SIMD_MM(set1_ps)(D3)));
+        denInner        = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(D1), SIMD_MM(mul_ps)(x2, denInner));
+        const auto den  = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(D0), SIMD_MM(mul_ps)(x2, denInner));
+
+        // den >= 135135 on the clamped range, so the estimate never sees 0/denormals
+        return SIMD_MM(mul_ps)(num, fasterRcp(den));
+    }
+//==============================================================================//
+    namespace PadeTanh54Coeffs
+    {
+        // (5,4) pade approximant of tanh(x)
+        //
+        //           x · (945 + 105x² + x⁴)
+        // tanh(x) ≈ ───────────────────────
+        //            945 + 420x² + 15x⁴
+        //
+        // lambert's continued fraction at depth 4
+        constexpr auto kPade = ConstexprGen::tanhLambert<4>();
+
+        constexpr float N0 = static_cast<float>(kPade.num[0]);
+        constexpr float N1 = static_cast<float>(kPade.num[1]);
+        constexpr float N2 = static_cast<float>(kPade.num[2]);
+
+        constexpr float D0 = static_cast<float>(kPade.den[0]);
+        constexpr float D1 = static_cast<float>(kPade.den[1]);
+        constexpr float D2 = static_cast<float>(kPade.den[2]);
+
+        // approximant reaches exactly 1 here; clamping at this point keeps the
+        // output monotone and inside [-1, 1]
+        constexpr float kClamp = 3.6467386f;
+    }
+
+    inline float padeTanh54Approx(const float x) noexcept
+    {
+        using namespace PadeTanh54Coeffs;
+
+        const auto x2 = x * x;
+
+        const auto num = x * (N0 + x2 * (N1 + x2 * N2));
+        const auto den =      D0 + x2 * (D1 + x2 * D2);
+
+        return num / den;
+    }
+
+    // max abs error vs std::tanh over all finite x: ~1.4e-3
+    template<typename T>
+    T fasterTanh54Bounded(T x) noexcept
+    {
+        using namespace PadeTanh54Coeffs;
+        return static_cast<T>(padeTanh54Approx(std::clamp(static_cast<float>(x), -kClamp, kClamp)));
+    }
+
+    inline SIMD_M128 fasterTanh54Bounded(const SIMD_M128 x) noexcept
+    {
+        using namespace PadeTanh54Coeffs;
+
+        const auto vc  = SIMD_MM(set1_ps)(kClamp);
+        const auto vnc = SIMD_MM(set1_ps)(-kClamp);
+        const auto xb  = SIMD_MM(min_ps)(vc, SIMD_MM(max_ps)(vnc, x));
+
+        const auto x2   = SIMD_MM(mul_ps)(xb, xb);
+
+        const auto numInner = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(N1), SIMD_MM(mul_ps)(x2, SIMD_MM(set1_ps)(N2)));
+        const auto num      = SIMD_MM(mul_ps)(xb, SIMD_MM(add_ps)(SIMD_MM(set1_ps)(N0), SIMD_MM(mul_ps)(x2, numInner)));
+
+        const auto denInner = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(D1), SIMD_MM(mul_ps)(x2, SIMD_MM(set1_ps)(D2)));
+        const auto den      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(D0), SIMD_MM(mul_ps)(x2, denInner));
+
+        return SIMD_MM(div_ps)(num, den);
+    }
+//==============================================================================//
+    namespace RationalTanh32Coeffs
+    {
+        // (3,2) rational tanh, retuned from the pade form so it hits exactly 1 at x = 3
+        //
+        //           x · (27 + x²)
+        // tanh(x) ≈ ─────────────
+        //            27 + 9x²
+        constexpr float N0 = 27.0f;
+        constexpr float D0 = 27.0f;
+        constexpr float D1 = 9.0f;
+
+        constexpr float kClamp = 3.0f;
+    }
+
+    inline float rationalTanh32Approx(const float x) noexcept
+    {
+        using namespace RationalTanh32Coeffs;
+
+        const auto x2 = x * x;
+        return x * (N0 + x2) / (D0 + D1 * x2);
+    }
+
+    // max abs error vs std::tanh over all finite x: ~2.4e-2.
+    // audibly still a smooth saturator, not a tanh substitute for control math.
+    template<typename T>
+    T fasterTanh32Bounded(T x) noexcept
+    {
+        using namespace RationalTanh32Coeffs;
+        return static_cast<T>(rationalTanh32Approx(std::clamp(static_cast<float>(x), -kClamp, kClamp)));
+    }
+
+    inline SIMD_M128 fasterTanh32Bounded(const SIMD_M128 x) noexcept
+    {
+        using namespace RationalTanh32Coeffs;
+
+        const auto vc  = SIMD_MM(set1_ps)(kClamp);
+        const auto vnc = SIMD_MM(set1_ps)(-kClamp);
+        const auto xb  = SIMD_MM(min_ps)(vc, SIMD_MM(max_ps)(vnc, x));
+
+        const auto x2  = SIMD_MM(mul_ps)(xb, xb);
+        const auto num = SIMD_MM(mul_ps)(xb, SIMD_MM(add_ps)(SIMD_MM(set1_ps)(N0), x2));
+        const auto den = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(D0), SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(D1), x2));
+
+        return SIMD_MM(div_ps)(num, den);
+    }
+//==============================================================================//
+    // tanh lookup table, linear interpolation, odd symmetry
+    //
+    // kSize segments over [0, kRange]; the table stores kSize + 2 points so
+    // the clamped index kSize still has a right-hand neighbour.
+    //
+    // interpolation error ≤ h²/8 · max|tanh''| = (8/1024)²/8 · 0.77 ≈ 5.9e-6,
+    // tail error past kRange is 1 - tanh(8) ≈ 2.3e-7.
+    // max abs error vs std::tanh over all finite x: ~6e-6
+    namespace TanhLut
+    {
+        constexpr int   kSize  = 1024;
+        constexpr float kRange = 8.0f;
+        constexpr float kScale = static_cast<float>(kSize) / kRange;
+
+        // built at compile time in double, rounded once to float
+        inline constexpr auto table = ConstexprGen::makeTable<kSize + 2>(0.0, 1.0 / kScale,
+                                                                        [](const double x) { return gcem::tanh(x); });
+    }
+
+    inline float fasterTanhLut(const float x) noexcept
+    {
+        using namespace TanhLut;
+
+        // NaN fails the compare and lands on kRange, so the index stays in range
+        const float ax  = std::abs(x);
+        const float pos = (ax < kRange ? ax : kRange) * kScale;
+        const int   idx = static_cast<int>(pos);
+        const float frac = pos - static_cast<float>(idx);
+
+        const float y = table.v[idx] + frac * (table.v[idx + 1] - table.v[idx]);
+        return std::copysign(y, x);
+    }
+
+    inline SIMD_M128 fasterTanhLut(const SIMD_M128 x) noexcept
+    {
+        using namespace TanhLut;
+
+        const auto vSignMask = SIMD_MM(set1_ps)(-0.0f);
+        const auto sign      = SIMD_MM(and_ps)(x, vSignMask);
+        const auto ax        = SIMD_MM(andnot_ps)(vSignMask, x);
+
+        // min_ps returns the second operand for NaN lanes → kRange
+        const auto pos  = SIMD_MM(mul_ps)(SIMD_MM(min_ps)(ax, SIMD_MM(set1_ps)(kRange)),
+                                          SIMD_MM(set1_ps)(kScale));
+        const auto vIdx = SIMD_MM(cvttps_epi32)(pos);
+        const auto frac = SIMD_MM(sub_ps)(pos, SIMD_MM(cvtepi32_ps)(vIdx));
+
+        // SSE has no gather; spill the indices and pick per lane
+        alignas(16) int   idx[4];
+        alignas(16) float y0[4];
+        alignas(16) float y1[4];
+        SIMD_MM(store_si128)(reinterpret_cast<SIMD_M128I*>(idx), vIdx);
+        for (int j = 0; j < 4; ++j)
+        {
+            y0[j] = table.v[idx[j]];
+            y1[j] = table.v[idx[j] + 1];
+        }
+
+        const auto vY0 = SIMD_MM(load_ps)(y0);
+        const auto vY1 = SIMD_MM(load_ps)(y1);
+        const auto y   = SIMD_MM(add_ps)(vY0, SIMD_MM(mul_ps)(frac, SIMD_MM(sub_ps)(vY1, vY0)));
+
+        return SIMD_MM(or_ps)(y, sign);
+    }
+//==============================================================================//
+    // compile-time selectable saturator precision
+    //
+    //   tier        | kernel                         | max abs err | div
+    //   ------------+--------------------------------+-------------+-----------
+    //   Pade76      | [7/6] pade, clamp ±5           | ~1.0e-4     | div_ps
+    //   Pade76Rcp   | [7/6] pade, clamp ±5           | ~1.0e-4     | rcp + NR
+    //   Pade54      | [5/4] pade, clamp ±3.647       | ~1.4e-3     | div_ps
+    //   Rational32  | [3/2] rational, clamp ±3       | ~2.4e-2     | div_ps
+    //   Lut         | 1024-seg table, lerp, ±8       | ~6.0e-6     | none
+    //
+    // the lut tier trades arithmetic for 8 scalar loads per vector (no SSE
+    // gather), so it is the most accurate tier but not the cheapest.
+    //
+    // errors are vs std::tanh over all finite inputs. scalar overloads always
+    // use a true divide, so Pade76Rcp scalar tails can differ from the SIMD
+    // body by the reciprocal error (< 5e-7).
+    enum class TanhTier
+    {
+        Pade76,
+        Pade76Rcp,
+        Pade54,
+        Rational32,
+        Lut
+    };
+
+    template<TanhTier Tier>
+    inline SIMD_M128 fasterTanhTiered(const SIMD_M128 x) noexcept
+    {
+        if constexpr (Tier == TanhTier::Pade76)     return fasterTanhBounded(x);
+        if constexpr (Tier == TanhTier::Pade76Rcp)  return fasterTanhRcpBounded(x);
+        if constexpr (Tier == TanhTier::Pade54)     return fasterTanh54Bounded(x);
+        if constexpr (Tier == TanhTier::Rational32) return fasterTanh32Bounded(x);
+        if constexpr (Tier == TanhTier::Lut)        return fasterTanhLut(x);
+    }
+
+    template<TanhTier Tier>
+    inline float fasterTanhTiered(const float x) noexcept
+    {
+        if constexpr (Tier == TanhTier::Pade76 || Tier == TanhTier::Pade76Rcp)
+            return fasterTanhBounded(x);
+        if constexpr (Tier == TanhTier::Pade54)     return fasterTanh54Bounded(x);
+        if constexpr (Tier == TanhTier::Rational32) return fasterTanh32Bounded(x);
+        if constexpr (Tier == TanhTier::Lut)        return fasterTanhLut(x);
+    }
+//==============================================================================//
+    // 2^x by exponent-bit construction
+    //
+    //   x = n + f,  n = floor(x),  f ∈ [0, 1)
+    //   2^x = 2^n · P(f)
+    //
+    // 2^n is built directly in the exponent field ((n + 127) << 23), P(f) is a
+    // degree-5 chebyshev fit of 2^f on [0, 1).
+    //
+    // max rel error: ~1.5e-7 (≈ 2 ulp) for x ∈ [-126, 126].
+    // inputs are clamped to that range, so no denormals / inf come out; NaN
+    // lanes land on the upper clamp.
+    namespace Exp2Coeffs
+    {
+        constexpr float P0 = 9.999998984e-01f;
+        constexpr float P1 = 6.931544897e-01f;
+        constexpr float P2 = 2.401418182e-01f;
+        constexpr float P3 = 5.586033708e-02f;
+        constexpr float P4 = 8.949590424e-03f;
+        constexpr float P5 = 1.893754058e-03f;
+
+        constexpr float kMin = -126.0f;
+        constexpr float kMax =  126.0f;
+    }
+
+    inline float fasterExp2(const float x) noexcept
+    {
+        using namespace Exp2Coeffs;
+
+        // ordered compares so NaN falls through to kMax, same as min_ps below
+        const float hi = x < kMax ? x : kMax;
+        const float xc = hi > kMin ? hi : kMin;
+
+        // floor via truncation + fixup, matches the SIMD path bit for bit
+        int n = static_cast<int>(xc);
+        if (xc < static_cast<float>(n)) --n;
+        const float f = xc - static_cast<float>(n);
+
+        const float p = P0 + f * (P1 + f * (P2 + f * (P3 + f * (P4 + f * P5))));
+        const float scale = std::bit_cast<float>(static_cast<uint32_t>(n + 127) << 23);
+
+        return p * scale;
+    }
+
+    inline SIMD_M128 fasterExp2(const SIMD_M128 x) noexcept
+    {
+        using namespace Exp2Coeffs;
+
+        const auto xc   = SIMD_MM(max_ps)(SIMD_MM(min_ps)(x, SIMD_MM(set1_ps)(kMax)), SIMD_MM(set1_ps)(kMin));
+
+        // floor: truncate, then step down one on lanes where truncation rounded up
+        auto       vn   = SIMD_MM(cvttps_epi32)(xc);
+        auto       vnf  = SIMD_MM(cvtepi32_ps)(vn);
+        const auto up   = SIMD_MM(cmplt_ps)(xc, vnf);
+        vn              = SIMD_MM(add_epi32)(vn, SIMD_MM(castps_si128)(up));               // mask is -1 → n - 1
+        vnf             = SIMD_MM(sub_ps)(vnf, SIMD_MM(and_ps)(up, SIMD_MM(set1_ps)(1.0f)));
+        const auto f    = SIMD_MM(sub_ps)(xc, vnf);
+
+        auto p = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(P4), SIMD_MM(mul_ps)(f, SIMD_MM(set1_ps)(P5)));
+        p      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(P3), SIMD_MM(mul_ps)(f, p));
+        p      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(P2), SIMD_MM(mul_ps)(f, p));
+        p      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(P1), SIMD_MM(mul_ps)(f, p));
+        p      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(P0), SIMD_MM(mul_ps)(f, p));
+
+        const auto scale = SIMD_MM(castsi128_ps)(
+            SIMD_MM(slli_epi32)(SIMD_MM(add_epi32)(vn, SIMD_MM(set1_epi32)(127)), 23));
+
+        return SIMD_MM(mul_ps)(p, scale);
+    }
+
+    // e^x = 2^(x·log2(e)). the scaling rounds x·log2(e), so rel error grows
+    // to ~1.1e-7 + |x|·6e-8; for control-rate coefficients that is plenty.
+    inline float fasterExp(const float x) noexcept
+    {
+        return fasterExp2(x * 1.442695041f);
+    }
+
+    inline SIMD_M128 fasterExp(const SIMD_M128 x) noexcept
+    {
+        return fasterExp2(SIMD_MM(mul_ps)(x, SIMD_MM(set1_ps)(1.442695041f)));
+    }
+//==============================================================================//
+    // log2(x) by exponent-bit extraction
+    //
+    //   x = 2^e · m,  m ∈ [√½, √2)
+    //   log2(x) = e + 2·log2(e)·atanh(s),   s = (m - 1) / (m + 1) ∈ [-0.172, 0.172]
+    //
+    // subtracting the bits of √½ before splitting exponent and mantissa
+    // centres m on 1, so the atanh series converges fast and is accurate
+    // right where control math needs it (log2 of values near 1, e.g. one-pole
+    // decay factors). truncated after s⁹ (next term < 3e-10).
+    //
+    // max abs error: ~1e-7 for x ∈ [√½, √2), otherwise within 1 ulp of the
+    // result (e.g. ~5e-7 at x = 1e-3, ~4e-6 at x = 1e30).
+    // x ≤ 0, denormals and NaN are clamped to FLT_MIN and return -126.
+    namespace Log2Coeffs
+    {
+        constexpr float    kTwoLog2e  = 2.885390082f;          // 2 / ln(2)
+        constexpr float    kMinNormal = 1.17549435e-38f;
+        constexpr uint32_t kSqrtHalf  = 0x3f3504f3u;            // bits of √½
+        constexpr uint32_t kMantMask  = 0x007fffffu;
+
+        constexpr float S3 = 1.0f / 3.0f;
+        constexpr float S5 = 1.0f / 5.0f;
+        constexpr float S7 = 1.0f / 7.0f;
+        constexpr float S9 = 1.0f / 9.0f;
+    }
+
+    inline float fasterLog2(const float x) noexcept
+    {
+        using namespace Log2Coeffs;
+
+        // ordered compare so NaN falls through to the clamp, same as max_ps below
+        const float xc = x > kMinNormal ? x : kMinNormal;
+
+        const uint32_t t = std::bit_cast<uint32_t>(xc) - kSqrtHalf;
+        const int      e = static_cast<int32_t>(t) >> 23;             // arithmetic shift, floors
+        const float    m = std::bit_cast<float>((t & kMantMask) + kSqrtHalf);
+
+        const float s  = (m - 1.0f) / (m + 1.0f);
+        const float s2 = s * s;
+
+        const float series = 1.0f + s2 * (S3 + s2 * (S5 + s2 * (S7 + s2 * S9)));
+
+        return static_cast<float>(e) + kTwoLog2e * s * series;
+    }
+
+    inline SIMD_M128 fasterLog2(const SIMD_M128 x) noexcept
+    {
+        using namespace Log2Coeffs;
+
+        // constant second: max_ps returns it for NaN lanes
+        const auto xc = SIMD_MM(max_ps)(x, SIMD_MM(set1_ps)(kMinNormal));
+
+        const auto t  = SIMD_MM(sub_epi32)(SIMD_MM(castps_si128)(xc), SIMD_MM(set1_epi32)(static_cast<int>(kSqrtHalf)));
+        const auto e  = SIMD_MM(cvtepi32_ps)(SIMD_MM(srai_epi32)(t, 23));
+        const auto m  = SIMD_MM(castsi128_ps)(SIMD_MM(add_epi32)(SIMD_MM(and_si128)(t, SIMD_MM(set1_epi32)(static_cast<int>(kMantMask))),
+                                                                 SIMD_MM(set1_epi32)(static_cast<int>(kSqrtHalf))));
+
+        const auto one = SIMD_MM(set1_ps)(1.0f);
+        const auto s   = SIMD_MM(div_ps)(SIMD_MM(sub_ps)(m, one), SIMD_MM(add_ps)(m, one));
+        const auto s2  = SIMD_MM(mul_ps)(s, s);
+
+        auto series = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S7), SIMD_MM(mul_ps)(s2, SIMD_MM(set1_ps)(S9)));
+        series      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S5), SIMD_MM(mul_ps)(s2, series));
+        series      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S3), SIMD_MM(mul_ps)(s2, series));
+        series      = SIMD_MM(add_ps)(one, SIMD_MM(mul_ps)(s2, series));
+
+        return SIMD_MM(add_ps)(e, SIMD_MM(mul_ps)(SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(kTwoLog2e), s), series));
+    }
+
+    // x^y = 2^(y·log2(x)) for x > 0 (x ≤ 0 behaves as x = FLT_MIN).
+    // rel error ≈ 1.1e-7 + |y·log2(x)|·8e-8, i.e. ~1e-6 for results within
+    // ±2^10 of 1 and growing towards the float range limits.
+    inline float fasterPow(const float x, const float y) noexcept
+    {
+        return fasterExp2(y * fasterLog2(x));
+    }
+
+    inline SIMD_M128 fasterPow(const SIMD_M128 x, const SIMD_M128 y) noexcept
+    {
+        return fasterExp2(SIMD_MM(mul_ps)(y, fasterLog2(x)));
+    }
+//==============================================================================//
+    // decibel <-> linear gain, same conventions as juce::Decibels:
+    // anything at or below minusInfinityDb maps to a gain of 0, and a gain of
+    // 0 (or less) maps back to minusInfinityDb.
+    //
+    //   gain = 2^(dB · log2(10)/20),   dB = 20/log2(10) · log2(gain)
+    //
+    // over ±120 dB: max rel error of dbToGain ~1e-6, max abs error of
+    // gainToDb ~1e-5 dB.
+    namespace DecibelCoeffs
+    {
+        constexpr float kDbToLog2        = 0.166096404744368f;   // log2(10) / 20
+        constexpr float kLog2ToDb        = 6.020599913279624f;   // 20 / log2(10)
+        constexpr float kMinusInfinityDb = -100.0f;
+    }
+
+    inline float dbToGain(const float db, const float minusInfinityDb = DecibelCoeffs::kMinusInfinityDb) noexcept
+    {
+        return db > minusInfinityDb ? fasterExp2(db * DecibelCoeffs::kDbToLog2) : 0.0f;
+    }
+
+    inline SIMD_M128 dbToGain(const SIMD_M128 db, const float minusInfinityDb = DecibelCoeffs::kMinusInfinityDb) noexcept
+    {
+        const auto audible = SIMD_MM(cmpgt_ps)(db, SIMD_MM(set1_ps)(minusInfinityDb));
+        return SIMD_MM(and_ps)(audible, fasterExp2(SIMD_MM(mul_ps)(db, SIMD_MM(set1_ps)(DecibelCoeffs::kDbToLog2))));
+    }
+
+    inline float gainToDb(const float gain, const float minusInfinityDb = DecibelCoeffs::kMinusInfinityDb) noexcept
+    {
+        // fasterLog2 maps gain ≤ 0 to -126, i.e. about -758 dB, so the floor covers it
+        return std::max(fasterLog2(gain) * DecibelCoeffs::kLog2ToDb, minusInfinityDb);
+    }
+
+    inline SIMD_M128 gainToDb(const SIMD_M128 gain, const float minusInfinityDb = DecibelCoeffs::kMinusInfinityDb) noexcept
+    {
+        return SIMD_MM(max_ps)(SIMD_MM(mul_ps)(fasterLog2(gain), SIMD_MM(set1_ps)(DecibelCoeffs::kLog2ToDb)),
+                               SIMD_MM(set1_ps)(minusInfinityDb));
+    }
+//==============================================================================//
+    // log(cosh(x)), the antiderivative of tanh(x), for ADAA saturators
+    //
+    //   log(cosh(x)) = |x| - ln2 + log1p(e^(-2|x|))
+    //
+    // written this way it never overflows and never cancels: u = e^(-2|x|) is
+    // in (0, 1], and log1p(u) uses the atanh series
+    //
+    //   log1p(u) = 2·s·(1 + s²/3 + s⁴/5 + … + s¹⁰/11),   s = u / (2 + u) ∈ [0, 1/3]
+    //
+    // truncated after s¹⁰ (≤ 1e-7 at u = 1).
+    //
+    // max abs error vs std::log(std::cosh(x)): ~2e-7 + float rounding of |x|
+    namespace LogCoshCoeffs
+    {
+        constexpr float kLn2   = 0.693147181f;
+        constexpr float kLog2e = 1.442695041f;
+
+        constexpr float S1  = 1.0f;
+        constexpr float S3  = 1.0f / 3.0f;
+        constexpr float S5  = 1.0f / 5.0f;
+        constexpr float S7  = 1.0f / 7.0f;
+        constexpr float S9  = 1.0f / 9.0f;
+        constexpr float S11 = 1.0f / 11.0f;
+    }
+
+    inline float fasterLogCosh(const float x) noexcept
+    {
+        using namespace LogCoshCoeffs;
+
+        const float a  = std::abs(x);
+        const float u  = fasterExp2(-2.0f * kLog2e * a);
+        const float s  = u / (2.0f + u);
+        const float s2 = s * s;
+
+        const float series = S1 + s2 * (S3 + s2 * (S5 + s2 * (S7 + s2 * (S9 + s2 * S11))));
+
+        return (a - kLn2) + 2.0f * s * series;
+    }
+
+    inline SIMD_M128 fasterLogCosh(const SIMD_M128 x) noexcept
+    {
+        using namespace LogCoshCoeffs;
+
+        const auto a  = SIMD_MM(andnot_ps)(SIMD_MM(set1_ps)(-0.0f), x);
+        const auto u  = fasterExp2(SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(-2.0f * kLog2e), a));
+        const auto s  = SIMD_MM(div_ps)(u, SIMD_MM(add_ps)(SIMD_MM(set1_ps)(2.0f), u));
+        const auto s2 = SIMD_MM(mul_ps)(s, s);
+
+        auto series = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S9), SIMD_MM(mul_ps)(s2, SIMD_MM(set1_ps)(S11)));
+        series      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S7), SIMD_MM(mul_ps)(s2, series));
+        series      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S5), SIMD_MM(mul_ps)(s2, series));
+        series      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S3), SIMD_MM(mul_ps)(s2, series));
+        series      = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(S1), SIMD_MM(mul_ps)(s2, series));
+
+        const auto log1pU = SIMD_MM(mul_ps)(SIMD_MM(add_ps)(s, s), series);
+
+        return SIMD_MM(add_ps)(SIMD_MM(sub_ps)(a, SIMD_MM(set1_ps)(kLn2)), log1pU);
+    }
 //==============================================================================//
     inline float boundToPi(const float angle)
     {
@@ -0,0 +1,233 @@
+#pragma once
+
+#ifndef CHRONOS_FASTERMATH_BATCH_H
+#define CHRONOS_FASTERMATH_BATCH_H
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include "dsp/math/fastermath.h"
+
+namespace MarsDSP::inline FasterMath
+{
+    // span-in / span-out entry points for every fastermath approximant
+    //
+    //   fasterTanh(in, out);            // out[i] = fasterTanh(in[i])
+    //
+    // one loop shape for all of them:
+    //
+    //   head  partial vector up to the first 16-byte aligned out element
+    //   body  4 independent vectors per iteration (16 floats) so the long
+    //         div / polynomial dependency chains of neighbouring vectors overlap
+    //   quad  remaining whole vectors
+    //   tail  partial vector
+    //
+    // head and tail go through the SIMD kernel too (zero-padded through a
+    // stack quad), so every element gets bit-identical results regardless of
+    // buffer alignment or length – there is no scalar fallback that could
+    // disagree with the vector path.
+    //
+    // out must hold at least in.size() elements. in and out may be the same
+    // buffer (in-place); partially overlapping spans are not supported.
+    namespace BatchDetail
+    {
+        constexpr std::size_t kUnroll = 4;
+        constexpr std::size_t kStride = 4 * kUnroll;
+
+        inline std::size_t headCount(const float* out, const std::size_t n) noexcept
+        {
+            const auto mis = (reinterpret_cast<std::uintptr_t>(out) >> 2) & 3u;
+            return mis == 0 ? 0 : std::min<std::size_t>(4 - mis, n);
+        }
+
+        template<typename Kernel>
+        inline void partial(const float* in, float* out, const std::size_t count, Kernel&& kernel) noexcept
+        {
+            alignas(16) float buf[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            std::copy_n(in, count, buf);
+            SIMD_MM(store_ps)(buf, kernel(SIMD_MM(load_ps)(buf)));
+            std::copy_n(buf, count, out);
+        }
+
+        template<typename Kernel>
+        inline void apply(std::span<const float> in, std::span<float> out, Kernel&& kernel) noexcept
+        {
+            assert(out.size() >= in.size());
+
+            const float* src = in.data();
+            float*       dst = out.data();
+            const std::size_t n = in.size();
+
+            std::size_t i = headCount(dst, n);
+            if (i > 0) partial(src, dst, i, kernel);
+
+            for (; i + kStride <= n; i += kStride)
+            {
+                const auto r0 = kernel(SIMD_MM(loadu_ps)(src + i));
+                const auto r1 = kernel(SIMD_MM(loadu_ps)(src + i + 4));
+                const auto r2 = kernel(SIMD_MM(loadu_ps)(src + i + 8));
+                const auto r3 = kernel(SIMD_MM(loadu_ps)(src + i + 12));
+                SIMD_MM(store_ps)(dst + i,      r0);
+                SIMD_MM(store_ps)(dst + i + 4,  r1);
+                SIMD_MM(store_ps)(dst + i + 8,  r2);
+                SIMD_MM(store_ps)(dst + i + 12, r3);
+            }
+
+            for (; i + 4 <= n; i += 4)
+                SIMD_MM(store_ps)(dst + i, kernel(SIMD_MM(loadu_ps)(src + i)));
+
+            if (i < n) partial(src + i, dst + i, n - i, kernel);
+        }
+    }
+
+    // ---- trig ----
+    inline void fasterSin(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterSin(x); });
+    }
+
+    inline void fasterCos(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterCos(x); });
+    }
+
+    inline void fasterTan(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTan(x); });
+    }
+
+    inline void boundToPi(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return boundToPiSIMD(x); });
+    }
+
+    // two outputs: peels against sinOut, cosOut is stored unaligned
+    inline void fasterSinCos(std::span<const float> in, std::span<float> sinOut, std::span<float> cosOut) noexcept
+    {
+        assert(sinOut.size() >= in.size() && cosOut.size() >= in.size());
+
+        const float* src = in.data();
+        float*       ds  = sinOut.data();
+        float*       dc  = cosOut.data();
+        const std::size_t n = in.size();
+
+        auto partial = [&](const std::size_t at, const std::size_t count)
+        {
+            alignas(16) float bs[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            alignas(16) float bc[4];
+            std::copy_n(src + at, count, bs);
+            SIMD_M128 s, c;
+            fasterSinCos(SIMD_MM(load_ps)(bs), s, c);
+            SIMD_MM(store_ps)(bs, s);
+            SIMD_MM(store_ps)(bc, c);
+            std::copy_n(bs, count, ds + at);
+            std::copy_n(bc, count, dc + at);
+        };
+
+        std::size_t i = BatchDetail::headCount(ds, n);
+        if (i > 0) partial(0, i);
+
+        for (; i + BatchDetail::kStride <= n; i += BatchDetail::kStride)
+        {
+            SIMD_M128 s0, c0, s1, c1, s2, c2, s3, c3;
+            fasterSinCos(SIMD_MM(loadu_ps)(src + i),      s0, c0);
+            fasterSinCos(SIMD_MM(loadu_ps)(src + i + 4),  s1, c1);
+            fasterSinCos(SIMD_MM(loadu_ps)(src + i + 8),  s2, c2);
+            fasterSinCos(SIMD_MM(loadu_ps)(src + i + 12), s3, c3);
+            SIMD_MM(store_ps)(ds + i,      s0);  SIMD_MM(storeu_ps)(dc + i,      c0);
+            SIMD_MM(store_ps)(ds + i + 4,  s1);  SIMD_MM(storeu_ps)(dc + i + 4,  c1);
+            SIMD_MM(store_ps)(ds + i + 8,  s2);  SIMD_MM(storeu_ps)(dc + i + 8,  c2);
+            SIMD_MM(store_ps)(ds + i + 12, s3);  SIMD_MM(storeu_ps)(dc + i + 12, c3);
+        }
+
+        for (; i + 4 <= n; i += 4)
+        {
+            SIMD_M128 s, c;
+            fasterSinCos(SIMD_MM(loadu_ps)(src + i), s, c);
+            SIMD_MM(store_ps)(ds + i, s);
+            SIMD_MM(storeu_ps)(dc + i, c);
+        }
+
+        if (i < n) partial(i, n - i);
+    }
+
+    // ---- tanh family ----
+    inline void fasterTanh(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanh(x); });
+    }
+
+    inline void fasterTanhBounded(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanhBounded(x); });
+    }
+
+    inline void fasterTanhRcpBounded(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanhRcpBounded(x); });
+    }
+
+    inline void fasterTanh54Bounded(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanh54Bounded(x); });
+    }
+
+    inline void fasterTanh32Bounded(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanh32Bounded(x); });
+    }
+
+    inline void fasterTanhLut(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanhLut(x); });
+    }
+
+    template<TanhTier Tier>
+    inline void fasterTanhTiered(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterTanhTiered<Tier>(x); });
+    }
+
+    inline void fasterLogCosh(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterLogCosh(x); });
+    }
+
+    // ---- exp / log ----
+    inline void fasterExp2(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterExp2(x); });
+    }
+
+    inline void fasterExp(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterExp(x); });
+    }
+
+    inline void fasterLog2(std::span<const float> in, std::span<float> out) noexcept
+    {
+        BatchDetail::apply(in, out, [](const SIMD_M128 x) { return fasterLog2(x); });
+    }
+
+    // out[i] = in[i]^y
+    inline void fasterPow(std::span<const float> in, const float y, std::span<float> out) noexcept
+    {
+        const auto vy = SIMD_MM(set1_ps)(y);
+        BatchDetail::apply(in, out, [vy](const SIMD_M128 x) { return fasterPow(x, vy); });
+    }
+
+    inline void dbToGain(std::span<const float> in, std::span<float> out,
+                         const float minusInfinityDb = DecibelCoeffs::kMinusInfinityDb) noexcept
+    {
+        BatchDetail::apply(in, out, [minusInfinityDb](const SIMD_M128 x) { return dbToGain(x, minusInfinityDb); });
+    }
+
+    inline void gainToDb(std::span<const float> in, std::span<float> out,
+                         const float minusInfinityDb = DecibelCoeffs::kMinusInfinityDb) noexcept
+    {
+        BatchDetail::apply(in, out, [minusInfinityDb](const SIMD_M128 x) { return gainToDb(x, minusInfinityDb); });
+    }
+}
+#endif
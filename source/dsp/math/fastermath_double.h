@@ -0,0 +1,537 @@
+#pragma once
+
+#ifndef CHRONOS_FASTERMATH_DOUBLE_H
+#define CHRONOS_FASTERMATH_DOUBLE_H
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include "dsp/math/simd/simd_config.h"
+
+namespace MarsDSP::inline FasterMath
+{
+    // double-precision sin / cos / tan / tanh / boundToPi
+    //
+    //   double            scalar
+    //   SIMD_M128D        2 lanes, SSE2 only (like the float kernels)
+    //   SIMD_M256D        4 lanes, when built with AVX (MARSCORE_SIMD_AVX)
+    //
+    // the float pade kernels cover [-π, π] with one rational, which would need
+    // far higher orders to reach 53 bits. here every trig function reduces to
+    // [-π/4, π/4] first and uses the fdlibm-order minimax polynomials there,
+    // so the orders stay at 6 terms per function.
+    //
+    // rounding to an integer uses the 1.5·2^52 magic constant instead of
+    // round_pd: it is plain SSE2, and k lands in the low mantissa bits where
+    // the quadrant and the exponent of 2^k can be read off directly. all three
+    // widths run the same operation sequence, so scalar, SSE2 and AVX agree
+    // bit for bit unless the compiler contracts the scalar path into FMAs.
+    namespace DoubleDetail
+    {
+        constexpr double kRoundMagic = 6755399441055744.0;      // 1.5 · 2^52
+
+        inline std::int64_t bitsOf(const double x) noexcept { return std::bit_cast<std::int64_t>(x); }
+    }
+//==============================================================================//
+    // sin + cos, shared reduction
+    //
+    //   k = round(x · 2/π),   r = x - k·π/2   ∈ [-π/4, π/4]
+    //
+    // π/2 split cody-waite style into three doubles; P1 and P2 have 33
+    // significant bits, so k·P1 and k·P2 are exact for |k| < 2^20.
+    //
+    //   q | sin x | cos x
+    //   --+-------+------
+    //   0 |  s(r) |  c(r)
+    //   1 |  c(r) | -s(r)
+    //   2 | -s(r) | -c(r)
+    //   3 | -c(r) |  s(r)
+    //
+    // max abs error vs long double sinl/cosl: ~2e-16 for |x| ≤ 2^20, growing
+    // like |x|·2^-60 past that. beyond kMaxRange (where the spacing of x is
+    // ≥ 0.5 rad) lanes return sin = 0, cos = 1; ±inf is treated the same,
+    // NaN propagates.
+    namespace SinCosDCoeffs
+    {
+        constexpr double kTwoOverPi = 0.63661977236758134308;
+        constexpr double kMaxRange  = 2251799813685248.0;       // 2^51
+
+        constexpr double P1 = 1.57079632673412561417e+00;       // π/2 hi, 33 bits
+        constexpr double P2 = 6.07710050630396597660e-11;       // π/2 mid, 33 bits
+        constexpr double P3 = 2.02226624879595063154e-21;       // π/2 lo
+
+        // sin(r) ≈ r + r³·(S1 + r²·(S2 + … + r²·S6))
+        constexpr double S1 = -1.66666666666666324348e-01;
+        constexpr double S2 =  8.33333333332248946124e-03;
+        constexpr double S3 = -1.98412698298579493134e-04;
+        constexpr double S4 =  2.75573137070700676789e-06;
+        constexpr double S5 = -2.50507602534068634195e-08;
+        constexpr double S6 =  1.58969099521155010221e-10;
+
+        // cos(r) ≈ 1 - r²/2 + r⁴·(C1 + r²·(C2 + … + r²·C6))
+        constexpr double C1 =  4.16666666666666019037e-02;
+        constexpr double C2 = -1.38888888888741095749e-03;
+        constexpr double C3 =  2.48015872894767294178e-05;
+        constexpr double C4 = -2.75573143513906633035e-07;
+        constexpr double C5 =  2.08757232129817482790e-09;
+        constexpr double C6 = -1.13596475577881948265e-11;
+    }
+
+    inline void fasterSinCos(const double x, double& sinOut, double& cosOut) noexcept
+    {
+        using namespace SinCosDCoeffs;
+        using DoubleDetail::kRoundMagic;
+
+        const double xr = std::abs(x) > kMaxRange ? 0.0 : x;
+
+        const double t = xr * kTwoOverPi + kRoundMagic;
+        const double k = t - kRoundMagic;
+        const auto   q = DoubleDetail::bitsOf(t);           // k mod 4 in the low bits
+
+        const double r  = ((xr - k * P1) - k * P2) - k * P3;
+        const double r2 = r * r;
+
+        const double s = r + r * r2 * (S1 + r2 * (S2 + r2 * (S3 + r2 * (S4 + r2 * (S5 + r2 * S6)))));
+        const double c = (1.0 - 0.5 * r2) + r2 * r2 * (C1 + r2 * (C2 + r2 * (C3 + r2 * (C4 + r2 * (C5 + r2 * C6)))));
+
+        const double sq = (q & 1) ? c : s;
+        const double cq = (q & 1) ? s : c;
+
+        sinOut = (q & 2)       ? -sq : sq;
+        cosOut = ((q + 1) & 2) ? -cq : cq;
+    }
+
+    inline void fasterSinCos(const SIMD_M128D x, SIMD_M128D& sinOut, SIMD_M128D& cosOut) noexcept
+    {
+        using namespace SinCosDCoeffs;
+
+        const auto signMask = SIMD_MM(set1_pd)(-0.0);
+        const auto magic    = SIMD_MM(set1_pd)(DoubleDetail::kRoundMagic);
+        const auto one      = SIMD_MM(set1_epi64x)(1);
+
+        // false for NaN so it propagates
+        const auto huge = SIMD_MM(cmpgt_pd)(SIMD_MM(andnot_pd)(signMask, x), SIMD_MM(set1_pd)(kMaxRange));
+        const auto xr   = SIMD_MM(andnot_pd)(huge, x);
+
+        const auto t  = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(xr, SIMD_MM(set1_pd)(kTwoOverPi)), magic);
+        const auto k  = SIMD_MM(sub_pd)(t, magic);
+        const auto kb = SIMD_MM(castpd_si128)(t);
+
+        // r = ((x - k·P1) - k·P2) - k·P3
+        auto r = SIMD_MM(sub_pd)(xr, SIMD_MM(mul_pd)(k, SIMD_MM(set1_pd)(P1)));
+        r      = SIMD_MM(sub_pd)(r,  SIMD_MM(mul_pd)(k, SIMD_MM(set1_pd)(P2)));
+        r      = SIMD_MM(sub_pd)(r,  SIMD_MM(mul_pd)(k, SIMD_MM(set1_pd)(P3)));
+
+        const auto r2 = SIMD_MM(mul_pd)(r, r);
+
+        auto sp = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(S5), SIMD_MM(mul_pd)(r2, SIMD_MM(set1_pd)(S6)));
+        sp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(S4), SIMD_MM(mul_pd)(r2, sp));
+        sp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(S3), SIMD_MM(mul_pd)(r2, sp));
+        sp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(S2), SIMD_MM(mul_pd)(r2, sp));
+        sp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(S1), SIMD_MM(mul_pd)(r2, sp));
+        const auto s = SIMD_MM(add_pd)(r, SIMD_MM(mul_pd)(SIMD_MM(mul_pd)(r, r2), sp));
+
+        auto cp = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(C5), SIMD_MM(mul_pd)(r2, SIMD_MM(set1_pd)(C6)));
+        cp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(C4), SIMD_MM(mul_pd)(r2, cp));
+        cp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(C3), SIMD_MM(mul_pd)(r2, cp));
+        cp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(C2), SIMD_MM(mul_pd)(r2, cp));
+        cp      = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(C1), SIMD_MM(mul_pd)(r2, cp));
+        const auto c = SIMD_MM(add_pd)(SIMD_MM(sub_pd)(SIMD_MM(set1_pd)(1.0), SIMD_MM(mul_pd)(SIMD_MM(set1_pd)(0.5), r2)),
+                                       SIMD_MM(mul_pd)(SIMD_MM(mul_pd)(r2, r2), cp));
+
+        // odd quadrant → swap. SSE2 has no 64-bit compare, so compare the
+        // 32-bit halves and AND each half with its neighbour.
+        const auto odd  = SIMD_MM(cmpeq_epi32)(SIMD_MM(and_si128)(kb, one), one);
+        const auto swap = SIMD_MM(castsi128_pd)(SIMD_MM(and_si128)(odd, SIMD_MM(shuffle_epi32)(odd, SIMD_MM_SHUFFLE(2, 3, 0, 1))));
+        const auto d    = SIMD_MM(and_pd)(swap, SIMD_MM(xor_pd)(s, c));
+
+        // bit 1 of k (of k + 1 for cos) shifted into the sign bit
+        const auto sinSign = SIMD_MM(and_pd)(SIMD_MM(castsi128_pd)(SIMD_MM(slli_epi64)(kb, 62)), signMask);
+        const auto cosSign = SIMD_MM(and_pd)(SIMD_MM(castsi128_pd)(SIMD_MM(slli_epi64)(SIMD_MM(add_epi64)(kb, one), 62)), signMask);
+
+        sinOut = SIMD_MM(xor_pd)(SIMD_MM(xor_pd)(s, d), sinSign);
+        cosOut = SIMD_MM(xor_pd)(SIMD_MM(xor_pd)(c, d), cosSign);
+    }
+
+#ifdef MARSCORE_SIMD_AVX
+    inline void fasterSinCos(const SIMD_M256D x, SIMD_M256D& sinOut, SIMD_M256D& cosOut) noexcept
+    {
+        using namespace SinCosDCoeffs;
+
+        const auto signMask = SIMD_MM256(set1_pd)(-0.0);
+        const auto magic    = SIMD_MM256(set1_pd)(DoubleDetail::kRoundMagic);
+
+        const auto huge = SIMD_MM256(cmp_pd)(SIMD_MM256(andnot_pd)(signMask, x), SIMD_MM256(set1_pd)(kMaxRange), SIMD_CMP(GT_OQ));
+        const auto xr   = SIMD_MM256(andnot_pd)(huge, x);
+
+        const auto t = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(xr, SIMD_MM256(set1_pd)(kTwoOverPi)), magic);
+        const auto k = SIMD_MM256(sub_pd)(t, magic);
+
+        auto r = SIMD_MM256(sub_pd)(xr, SIMD_MM256(mul_pd)(k, SIMD_MM256(set1_pd)(P1)));
+        r      = SIMD_MM256(sub_pd)(r,  SIMD_MM256(mul_pd)(k, SIMD_MM256(set1_pd)(P2)));
+        r      = SIMD_MM256(sub_pd)(r,  SIMD_MM256(mul_pd)(k, SIMD_MM256(set1_pd)(P3)));
+
+        const auto r2 = SIMD_MM256(mul_pd)(r, r);
+
+        auto sp = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(S5), SIMD_MM256(mul_pd)(r2, SIMD_MM256(set1_pd)(S6)));
+        sp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(S4), SIMD_MM256(mul_pd)(r2, sp));
+        sp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(S3), SIMD_MM256(mul_pd)(r2, sp));
+        sp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(S2), SIMD_MM256(mul_pd)(r2, sp));
+        sp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(S1), SIMD_MM256(mul_pd)(r2, sp));
+        const auto s = SIMD_MM256(add_pd)(r, SIMD_MM256(mul_pd)(SIMD_MM256(mul_pd)(r, r2), sp));
+
+        auto cp = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(C5), SIMD_MM256(mul_pd)(r2, SIMD_MM256(set1_pd)(C6)));
+        cp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(C4), SIMD_MM256(mul_pd)(r2, cp));
+        cp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(C3), SIMD_MM256(mul_pd)(r2, cp));
+        cp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(C2), SIMD_MM256(mul_pd)(r2, cp));
+        cp      = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(C1), SIMD_MM256(mul_pd)(r2, cp));
+        const auto c = SIMD_MM256(add_pd)(SIMD_MM256(sub_pd)(SIMD_MM256(set1_pd)(1.0), SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(0.5), r2)),
+                                          SIMD_MM256(mul_pd)(SIMD_MM256(mul_pd)(r2, r2), cp));
+
+        // AVX1 has no 256-bit integer ops, so the quadrant is taken in
+        // floating point: q = k - 4·floor(k/4), exact for any integer k
+        const auto q   = SIMD_MM256(sub_pd)(k, SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(4.0),
+                                            SIMD_MM256(floor_pd)(SIMD_MM256(mul_pd)(k, SIMD_MM256(set1_pd)(0.25)))));
+        const auto odd = SIMD_MM256(sub_pd)(q, SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(2.0),
+                                            SIMD_MM256(floor_pd)(SIMD_MM256(mul_pd)(q, SIMD_MM256(set1_pd)(0.5)))));
+
+        const auto swap = SIMD_MM256(cmp_pd)(odd, SIMD_MM256(set1_pd)(1.0), SIMD_CMP(EQ_OQ));
+        const auto d    = SIMD_MM256(and_pd)(swap, SIMD_MM256(xor_pd)(s, c));
+
+        // sin negative for q ∈ {2, 3}, cos for q ∈ {1, 2} ⇔ |q - 1.5| < 1
+        const auto sinNeg = SIMD_MM256(cmp_pd)(q, SIMD_MM256(set1_pd)(2.0), SIMD_CMP(GE_OQ));
+        const auto cosNeg = SIMD_MM256(cmp_pd)(SIMD_MM256(andnot_pd)(signMask, SIMD_MM256(sub_pd)(q, SIMD_MM256(set1_pd)(1.5))),
+                                               SIMD_MM256(set1_pd)(1.0), SIMD_CMP(LT_OQ));
+
+        sinOut = SIMD_MM256(xor_pd)(SIMD_MM256(xor_pd)(s, d), SIMD_MM256(and_pd)(sinNeg, signMask));
+        cosOut = SIMD_MM256(xor_pd)(SIMD_MM256(xor_pd)(c, d), SIMD_MM256(and_pd)(cosNeg, signMask));
+    }
+#endif
+
+    inline double fasterSin(const double x) noexcept
+    {
+        double s, c;
+        fasterSinCos(x, s, c);
+        return s;
+    }
+
+    inline double fasterCos(const double x) noexcept
+    {
+        double s, c;
+        fasterSinCos(x, s, c);
+        return c;
+    }
+
+    // SIMD lanes sit in different quadrants, so both polynomials are needed
+    // anyway; sin / cos alone cost the same as the fused call
+    inline SIMD_M128D fasterSin(const SIMD_M128D x) noexcept
+    {
+        SIMD_M128D s, c;
+        fasterSinCos(x, s, c);
+        return s;
+    }
+
+    inline SIMD_M128D fasterCos(const SIMD_M128D x) noexcept
+    {
+        SIMD_M128D s, c;
+        fasterSinCos(x, s, c);
+        return c;
+    }
+
+#ifdef MARSCORE_SIMD_AVX
+    inline SIMD_M256D fasterSin(const SIMD_M256D x) noexcept
+    {
+        SIMD_M256D s, c;
+        fasterSinCos(x, s, c);
+        return s;
+    }
+
+    inline SIMD_M256D fasterCos(const SIMD_M256D x) noexcept
+    {
+        SIMD_M256D s, c;
+        fasterSinCos(x, s, c);
+        return c;
+    }
+#endif
+//==============================================================================//
+    // tan(x) = sin(x) / cos(x) from one reduction
+    //
+    // both come out of the same r, so the quotient carries ~2 ulp relative
+    // error plus the reduction error – the same budget as a dedicated tan
+    // rational on [-π/4, π/4] followed by the -1/tan(r) fix-up on odd
+    // quadrants, for one divide either way.
+    inline double fasterTan(const double x) noexcept
+    {
+        double s, c;
+        fasterSinCos(x, s, c);
+        return s / c;
+    }
+
+    inline SIMD_M128D fasterTan(const SIMD_M128D x) noexcept
+    {
+        SIMD_M128D s, c;
+        fasterSinCos(x, s, c);
+        return SIMD_MM(div_pd)(s, c);
+    }
+
+#ifdef MARSCORE_SIMD_AVX
+    inline SIMD_M256D fasterTan(const SIMD_M256D x) noexcept
+    {
+        SIMD_M256D s, c;
+        fasterSinCos(x, s, c);
+        return SIMD_MM256(div_pd)(s, c);
+    }
+#endif
+//==============================================================================//
+    // e^x for the tanh tail, x ∈ [kMin, 0]
+    //
+    //   k = round(x · log2 e),   r = x - k·ln2   ∈ [-ln2/2, ln2/2]
+    //   e^r = 1 + 2r·P(r²) / (Q(r²) - r·P(r²))          (cephes exp)
+    //
+    // 2^k is built straight from k's bits: (k + 1023) << 52. kMin keeps k
+    // above the denormal range. max rel error ~2e-16.
+    namespace ExpDCoeffs
+    {
+        constexpr double kLog2e = 1.4426950408889634074;
+        constexpr double kMin   = -708.0;
+
+        constexpr double C1 = 6.93145751953125e-1;            // ln2 hi
+        constexpr double C2 = 1.42860682030941723212e-6;      // ln2 lo
+
+        constexpr double P0 = 1.26177193074810590878e-4;
+        constexpr double P1 = 3.02994407707441961300e-2;
+        constexpr double P2 = 9.99999999999999999910e-1;
+
+        constexpr double Q0 = 3.00198505138664455042e-6;
+        constexpr double Q1 = 2.52448340349684104192e-3;
+        constexpr double Q2 = 2.27265548208155028766e-1;
+        constexpr double Q3 = 2.00000000000000000009e0;
+    }
+
+    namespace DoubleDetail
+    {
+        inline double expNonPositive(const double x) noexcept
+        {
+            using namespace ExpDCoeffs;
+
+            const double t = x * kLog2e + kRoundMagic;
+            const double k = t - kRoundMagic;
+            const double r = (x - k * C1) - k * C2;
+
+            const double r2 = r * r;
+            const double px = r * ((P0 * r2 + P1) * r2 + P2);
+            const double qx = ((Q0 * r2 + Q1) * r2 + Q2) * r2 + Q3;
+            const double e  = 1.0 + 2.0 * (px / (qx - px));
+
+            return e * std::bit_cast<double>(static_cast<std::uint64_t>(bitsOf(t) + 1023) << 52);
+        }
+
+        inline SIMD_M128D expNonPositive(const SIMD_M128D x) noexcept
+        {
+            using namespace ExpDCoeffs;
+
+            const auto magic = SIMD_MM(set1_pd)(kRoundMagic);
+            const auto t = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(x, SIMD_MM(set1_pd)(kLog2e)), magic);
+            const auto k = SIMD_MM(sub_pd)(t, magic);
+            const auto r = SIMD_MM(sub_pd)(SIMD_MM(sub_pd)(x, SIMD_MM(mul_pd)(k, SIMD_MM(set1_pd)(C1))),
+                                           SIMD_MM(mul_pd)(k, SIMD_MM(set1_pd)(C2)));
+
+            const auto r2 = SIMD_MM(mul_pd)(r, r);
+            auto p = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(SIMD_MM(set1_pd)(P0), r2), SIMD_MM(set1_pd)(P1));
+            p      = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(p, r2), SIMD_MM(set1_pd)(P2));
+            const auto px = SIMD_MM(mul_pd)(r, p);
+
+            auto qx = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(SIMD_MM(set1_pd)(Q0), r2), SIMD_MM(set1_pd)(Q1));
+            qx      = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(qx, r2), SIMD_MM(set1_pd)(Q2));
+            qx      = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(qx, r2), SIMD_MM(set1_pd)(Q3));
+
+            const auto e = SIMD_MM(add_pd)(SIMD_MM(set1_pd)(1.0),
+                                           SIMD_MM(mul_pd)(SIMD_MM(set1_pd)(2.0), SIMD_MM(div_pd)(px, SIMD_MM(sub_pd)(qx, px))));
+
+            const auto bias  = SIMD_MM(set1_epi64x)(1023);
+            const auto scale = SIMD_MM(castsi128_pd)(SIMD_MM(slli_epi64)(SIMD_MM(add_epi64)(SIMD_MM(castpd_si128)(t), bias), 52));
+            return SIMD_MM(mul_pd)(e, scale);
+        }
+
+#ifdef MARSCORE_SIMD_AVX
+        inline SIMD_M256D expNonPositive(const SIMD_M256D x) noexcept
+        {
+            using namespace ExpDCoeffs;
+
+            const auto magic = SIMD_MM256(set1_pd)(kRoundMagic);
+            const auto t = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(x, SIMD_MM256(set1_pd)(kLog2e)), magic);
+            const auto k = SIMD_MM256(sub_pd)(t, magic);
+            const auto r = SIMD_MM256(sub_pd)(SIMD_MM256(sub_pd)(x, SIMD_MM256(mul_pd)(k, SIMD_MM256(set1_pd)(C1))),
+                                              SIMD_MM256(mul_pd)(k, SIMD_MM256(set1_pd)(C2)));
+
+            const auto r2 = SIMD_MM256(mul_pd)(r, r);
+            auto p = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(P0), r2), SIMD_MM256(set1_pd)(P1));
+            p      = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(p, r2), SIMD_MM256(set1_pd)(P2));
+            const auto px = SIMD_MM256(mul_pd)(r, p);
+
+            auto qx = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(Q0), r2), SIMD_MM256(set1_pd)(Q1));
+            qx      = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(qx, r2), SIMD_MM256(set1_pd)(Q2));
+            qx      = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(qx, r2), SIMD_MM256(set1_pd)(Q3));
+
+            const auto e = SIMD_MM256(add_pd)(SIMD_MM256(set1_pd)(1.0),
+                                              SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(2.0), SIMD_MM256(div_pd)(px, SIMD_MM256(sub_pd)(qx, px))));
+
+            // AVX1 has no 256-bit integer shift: build 2^k per 128-bit half
+            const auto bias = SIMD_MM(set1_epi64x)(1023);
+            auto pow2 = [&bias](const SIMD_M128D half)
+            {
+                return SIMD_MM(castsi128_pd)(SIMD_MM(slli_epi64)(SIMD_MM(add_epi64)(SIMD_MM(castpd_si128)(half), bias), 52));
+            };
+            const auto scale = SIMD_MM256(insertf128_pd)(SIMD_MM256(castpd128_pd256)(pow2(SIMD_MM256(castpd256_pd128)(t))),
+                                                         pow2(SIMD_MM256(extractf128_pd)(t, 1)), 1);
+            return SIMD_MM256(mul_pd)(e, scale);
+        }
+#endif
+    }
+//==============================================================================//
+    // tanh, two ranges
+    //
+    //   |x| < 0.625   x + x³·P(x²)/Q(x²)            (cephes [2/3] in x²)
+    //   otherwise     sign(x) · (1 - u) / (1 + u),   u = e^(-2|x|)
+    //
+    // the tail never sees cancellation (u ≤ 0.29) and saturates cleanly: u
+    // underflows towards 0 and the quotient rounds to exactly ±1 past
+    // |x| ≈ 19. max abs error ~2e-16 everywhere, NaN propagates.
+    namespace TanhDCoeffs
+    {
+        constexpr double kSmall = 0.625;
+
+        constexpr double P0 = -9.64399179425052238628e-1;
+        constexpr double P1 = -9.92877231001918586564e1;
+        constexpr double P2 = -1.61468768441708447952e3;
+
+        constexpr double Q0 =  1.12811678491632931402e2;
+        constexpr double Q1 =  2.23548839060100448583e3;
+        constexpr double Q2 =  4.84406305325125486048e3;
+    }
+
+    inline double fasterTanh(const double x) noexcept
+    {
+        using namespace TanhDCoeffs;
+
+        const double a = std::abs(x);
+        if (a < kSmall)
+        {
+            const double z = x * x;
+            return x + x * z * (((P0 * z + P1) * z + P2) / (((z + Q0) * z + Q1) * z + Q2));
+        }
+
+        // NaN fails the compare above and propagates through u
+        const double u = DoubleDetail::expNonPositive(std::max(-2.0 * a, ExpDCoeffs::kMin));
+        return std::copysign((1.0 - u) / (1.0 + u), x);
+    }
+
+    inline SIMD_M128D fasterTanh(const SIMD_M128D x) noexcept
+    {
+        using namespace TanhDCoeffs;
+
+        const auto signMask = SIMD_MM(set1_pd)(-0.0);
+        const auto a = SIMD_MM(andnot_pd)(signMask, x);
+        const auto z = SIMD_MM(mul_pd)(x, x);
+
+        auto p = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(SIMD_MM(set1_pd)(P0), z), SIMD_MM(set1_pd)(P1));
+        p      = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(p, z), SIMD_MM(set1_pd)(P2));
+        auto q = SIMD_MM(add_pd)(z, SIMD_MM(set1_pd)(Q0));
+        q      = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(q, z), SIMD_MM(set1_pd)(Q1));
+        q      = SIMD_MM(add_pd)(SIMD_MM(mul_pd)(q, z), SIMD_MM(set1_pd)(Q2));
+        const auto small = SIMD_MM(add_pd)(x, SIMD_MM(mul_pd)(SIMD_MM(mul_pd)(x, z), SIMD_MM(div_pd)(p, q)));
+
+        // max_pd returns its second operand on NaN, so the argument goes second
+        const auto u = DoubleDetail::expNonPositive(SIMD_MM(max_pd)(SIMD_MM(set1_pd)(ExpDCoeffs::kMin),
+                                                                    SIMD_MM(mul_pd)(SIMD_MM(set1_pd)(-2.0), a)));
+        const auto one  = SIMD_MM(set1_pd)(1.0);
+        const auto tail = SIMD_MM(or_pd)(SIMD_MM(div_pd)(SIMD_MM(sub_pd)(one, u), SIMD_MM(add_pd)(one, u)),
+                                         SIMD_MM(and_pd)(signMask, x));
+
+        const auto isSmall = SIMD_MM(cmplt_pd)(a, SIMD_MM(set1_pd)(kSmall));
+        return SIMD_MM(or_pd)(SIMD_MM(and_pd)(isSmall, small), SIMD_MM(andnot_pd)(isSmall, tail));
+    }
+
+#ifdef MARSCORE_SIMD_AVX
+    inline SIMD_M256D fasterTanh(const SIMD_M256D x) noexcept
+    {
+        using namespace TanhDCoeffs;
+
+        const auto signMask = SIMD_MM256(set1_pd)(-0.0);
+        const auto a = SIMD_MM256(andnot_pd)(signMask, x);
+        const auto z = SIMD_MM256(mul_pd)(x, x);
+
+        auto p = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(P0), z), SIMD_MM256(set1_pd)(P1));
+        p      = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(p, z), SIMD_MM256(set1_pd)(P2));
+        auto q = SIMD_MM256(add_pd)(z, SIMD_MM256(set1_pd)(Q0));
+        q      = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(q, z), SIMD_MM256(set1_pd)(Q1));
+        q      = SIMD_MM256(add_pd)(SIMD_MM256(mul_pd)(q, z), SIMD_MM256(set1_pd)(Q2));
+        const auto small = SIMD_MM256(add_pd)(x, SIMD_MM256(mul_pd)(SIMD_MM256(mul_pd)(x, z), SIMD_MM256(div_pd)(p, q)));
+
+        const auto u = DoubleDetail::expNonPositive(SIMD_MM256(max_pd)(SIMD_MM256(set1_pd)(ExpDCoeffs::kMin),
+                                                                       SIMD_MM256(mul_pd)(SIMD_MM256(set1_pd)(-2.0), a)));
+        const auto one  = SIMD_MM256(set1_pd)(1.0);
+        const auto tail = SIMD_MM256(or_pd)(SIMD_MM256(div_pd)(SIMD_MM256(sub_pd)(one, u), SIMD_MM256(add_pd)(one, u)),
+                                            SIMD_MM256(and_pd)(signMask, x));
+
+        const auto isSmall = SIMD_MM256(cmp_pd)(a, SIMD_MM256(set1_pd)(kSmall), SIMD_CMP(LT_OQ));
+        return SIMD_MM256(blendv_pd)(tail, small, isSmall);
+    }
+#endif
+//==============================================================================//
+    // wrap into [-π, π], same algorithm as the float version
+    inline double boundToPi(const double angle) noexcept
+    {
+        constexpr double pi = std::numbers::pi;
+
+        // fast path: already in canonical range
+        if (angle <= pi && angle >= -pi)
+            return angle;
+
+        const double shifted    = angle + pi;
+        const double wholeTurns = static_cast<double>(static_cast<int>(shifted * (0.5 / pi)));
+
+        double wrapped = shifted - 2.0 * pi * wholeTurns;
+        if (wrapped < 0.0)
+            wrapped += 2.0 * pi;
+
+        return wrapped - pi;
+    }
+
+    inline SIMD_M128D boundToPiSIMD(const SIMD_M128D angle) noexcept
+    {
+        constexpr double pi = std::numbers::pi;
+
+        const auto vPi    = SIMD_MM(set1_pd)(pi);
+        const auto vTwoPi = SIMD_MM(set1_pd)(2.0 * pi);
+
+        const auto shifted    = SIMD_MM(add_pd)(angle, vPi);
+        const auto wholeTurns = SIMD_MM(cvtepi32_pd)(SIMD_MM(cvttpd_epi32)(SIMD_MM(mul_pd)(shifted, SIMD_MM(set1_pd)(0.5 / pi))));
+
+        auto wrapped = SIMD_MM(sub_pd)(shifted, SIMD_MM(mul_pd)(vTwoPi, wholeTurns));
+        wrapped      = SIMD_MM(add_pd)(wrapped, SIMD_MM(and_pd)(SIMD_MM(cmplt_pd)(wrapped, SIMD_MM(setzero_pd)()), vTwoPi));
+
+        return SIMD_MM(sub_pd)(wrapped, vPi);
+    }
+
+#ifdef MARSCORE_SIMD_AVX
+    inline SIMD_M256D boundToPiSIMD(const SIMD_M256D angle) noexcept
+    {
+        constexpr double pi = std::numbers::pi;
+
+        const auto vPi    = SIMD_MM256(set1_pd)(pi);
+        const auto vTwoPi = SIMD_MM256(set1_pd)(2.0 * pi);
+
+        const auto shifted    = SIMD_MM256(add_pd)(angle, vPi);
+        const auto wholeTurns = SIMD_MM256(cvtepi32_pd)(SIMD_MM256(cvttpd_epi32)(SIMD_MM256(mul_pd)(shifted, SIMD_MM256(set1_pd)(0.5 / pi))));
+
+        auto wrapped = SIMD_MM256(sub_pd)(shifted, SIMD_MM256(mul_pd)(vTwoPi, wholeTurns));
+        wrapped      = SIMD_MM256(add_pd)(wrapped, SIMD_MM256(and_pd)(SIMD_MM256(cmp_pd)(wrapped, SIMD_MM256(setzero_pd)(), SIMD_CMP(LT_OQ)), vTwoPi));
+
+        return SIMD_MM256(sub_pd)(wrapped, vPi);
+    }
+#endif
+}
+#endif
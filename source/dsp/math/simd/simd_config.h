@@ -35,6 +35,13 @@
 #include <smmintrin.h>          // SSE4.1
 #endif
 // ══════════════════════════════════════════════════════════════
+// AVX Detection | 256-bit paths are compile-time only (-mavx / /arch:AVX)
+// ──────────────────────────────────────────────────────────────
+#if defined(MARSCORE_SIMD_NATIVE_X86) && defined(__AVX__)
+#define MARSCORE_SIMD_AVX
+#include <immintrin.h>          // AVX
+#endif
+// ══════════════════════════════════════════════════════════════
 // SIMDe (SIMD-Everywhere) | (NEON, WASM, or scalar fallback).
 // ──────────────────────────────────────────────────────────────
 #ifndef SIMDE_UNAVAILABLE
@@ -49,6 +56,11 @@
     #endif
     #include <simde/x86/sse4.2.h>
 
+    #ifndef MARSCORE_SIMD_NATIVE_X86
+    #include <simde/x86/avx.h>
+    #define MARSCORE_SIMD_AVX
+    #endif
+
 #endif
 // ══════════════════════════════════════════════════════════════
 // Branch A: Native x86 OR SIMDe is unavailable
@@ -65,6 +77,12 @@
 
 // _MM_SHUFFLE(z,y,x,w) builds an 8-bit immediate for shuffle ops
 #define SIMD_MM_SHUFFLE _MM_SHUFFLE
+
+// SIMD_MM256(add_pd) expands to _mm256_add_pd (only with MARSCORE_SIMD_AVX)
+#define SIMD_MM256(x) _mm256_##x
+#define SIMD_M256  __m256       // 8 × 32-bit float
+#define SIMD_M256D __m256d      // 4 × 64-bit double
+#define SIMD_CMP(x) _CMP_##x    // SIMD_CMP(LT_OQ) predicate for cmp_pd
 // ══════════════════════════════════════════════════════════════
 // Branch B: Non-x86 with SIMDe available
 // ══════════════════════════════════════════════════════════════
@@ -74,6 +92,10 @@
 #define SIMD_M128I simde__m128i
 #define SIMD_M128D simde__m128d
 #define SIMD_MM_SHUFFLE SIMDE_MM_SHUFFLE
+#define SIMD_MM256(x) simde_mm256_##x
+#define SIMD_M256  simde__m256
+#define SIMD_M256D simde__m256d
+#define SIMD_CMP(x) SIMDE_CMP_##x
 #endif
 // ══════════════════════════════════════════════════════════════
 // Hard requirement: C++23 or later.
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef CHRONOS_CYCLE_COUNTER_H
+#define CHRONOS_CYCLE_COUNTER_H
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace MarsDSP::inline Utils {
+
+    // cheapest monotonic tick the CPU offers: the TSC on x86 (constant
+    // rate on anything from the last decade), the virtual counter on
+    // arm64, steady_clock nanoseconds anywhere else. A read is a few ns
+    // and never enters the kernel, so it's fine on the audio thread.
+    inline uint64_t readCycles() noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // readCycles() ticks per second, measured against steady_clock once
+    // per process (the first call spins for about 5 ms)
+    inline double cyclesPerSecond() noexcept
+    {
+        static const double rate = []
+        {
+            using Clock = std::chrono::steady_clock;
+            const auto t0 = Clock::now();
+            const uint64_t c0 = readCycles();
+            auto t1 = t0;
+            while (t1 - t0 < std::chrono::milliseconds(5))
+                t1 = Clock::now();
+            const uint64_t c1 = readCycles();
+            return static_cast<double>(c1 - c0) / std::chrono::duration<double>(t1 - t0).count();
+        }();
+        return rate;
+    }
+}
+#endif
@@ -0,0 +1,90 @@
+#pragma once
+
+#ifndef CHRONOS_EVENT_QUEUE_H
+#define CHRONOS_EVENT_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace MarsDSP::inline Utils {
+
+    // bounded lock-free queue, any number of producers, one consumer.
+    //
+    // every cell carries a sequence number (Vyukov's bounded queue): a
+    // producer claims a slot with one CAS on the write position, fills it
+    // and publishes by bumping the cell's sequence; the consumer owns the
+    // read position outright. no allocation after construction and no
+    // locks, so the audio thread can drain it and the UI / host threads
+    // can push from anywhere. push() fails (and drops the event) when full.
+    template<typename T, std::size_t Capacity>
+    class EventQueue
+    {
+    public:
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        EventQueue() noexcept
+        {
+            for (std::size_t i = 0; i < Capacity; ++i)
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        // any thread
+        bool push(const T& item) noexcept
+        {
+            Cell* cell;
+            std::size_t pos = writePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells[pos & kMask];
+                const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false;       // full
+                else
+                    pos = writePos.load(std::memory_order_relaxed);
+            }
+            cell->data = item;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // consumer thread only
+        bool pop(T& item) noexcept
+        {
+            const std::size_t pos = readPos.load(std::memory_order_relaxed);
+            Cell& cell = cells[pos & kMask];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1)
+                return false;           // empty, or the producer has not published yet
+            item = cell.data;
+            cell.sequence.store(pos + Capacity, std::memory_order_release);
+            readPos.store(pos + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+    private:
+        static constexpr std::size_t kMask = Capacity - 1;
+        static constexpr std::size_t kLine = 64;
+
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence;
+            T data;
+        };
+
+        alignas(kLine) Cell cells[Capacity];
+        alignas(kLine) std::atomic<std::size_t> writePos { 0 };
+        alignas(kLine) std::atomic<std::size_t> readPos  { 0 };
+    };
+}
+#endif
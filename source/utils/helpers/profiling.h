@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef CHRONOS_PROFILING_H
+#define CHRONOS_PROFILING_H
+
+// Tracy zones and plots inside the DSP code.
+//
+// Off unless the build defines CHRONOS_PROFILE_ENGINE=1 (CMake option of
+// the same name, which also needs TRACY_ENABLE); then every macro below
+// expands to nothing and the engine doesn't even include Tracy. Shipping
+// builds leave it off. A profiling build of the same sources shows, per
+// block:
+//
+//   zones  DelayEngine::process › pre-read, PASS 1..3, write/mirror, history
+//   plots  ns/sample, duck gain, delay position, dirty parameters
+//
+// Zones that share a scope use the BEGIN / END pair (Tracy's C API), so
+// the passes don't need extra braces around them.
+
+#ifndef CHRONOS_PROFILE_ENGINE
+#define CHRONOS_PROFILE_ENGINE 0
+#endif
+
+#if CHRONOS_PROFILE_ENGINE && defined(TRACY_ENABLE)
+
+#include <chrono>
+#include <tracy/Tracy.hpp>
+#include <tracy/TracyC.h>
+
+namespace MarsDSP::inline Utils {
+
+    // plots the scope's wall time divided by numSamples, in ns
+    class NsPerSamplePlot
+    {
+    public:
+        NsPerSamplePlot(const char* plotName, const int numSamples) noexcept
+            : name(plotName), samples(numSamples), start(std::chrono::steady_clock::now()) {}
+
+        ~NsPerSamplePlot()
+        {
+            using Nanoseconds = std::chrono::duration<double, std::nano>;
+            const double ns = Nanoseconds(std::chrono::steady_clock::now() - start).count();
+            if (samples > 0)
+                TracyPlot(name, ns / samples);
+        }
+
+        NsPerSamplePlot(const NsPerSamplePlot&) = delete;
+        NsPerSamplePlot& operator=(const NsPerSamplePlot&) = delete;
+
+    private:
+        const char* name;
+        int samples;
+        std::chrono::steady_clock::time_point start;
+    };
+}
+
+#define CHRONOS_ENGINE_ZONE(name)                  ZoneScopedN(name)
+#define CHRONOS_ENGINE_ZONE_BEGIN(ctx, name)       TracyCZoneN(ctx, name, 1)
+#define CHRONOS_ENGINE_ZONE_END(ctx)               TracyCZoneEnd(ctx)
+#define CHRONOS_ENGINE_PLOT(name, value)           TracyPlot(name, static_cast<double>(value))
+#define CHRONOS_ENGINE_NS_PER_SAMPLE(name, n)      const MarsDSP::NsPerSamplePlot chronosNsPerSamplePlot { name, n }
+
+#else
+
+#define CHRONOS_ENGINE_ZONE(name)                  static_cast<void>(0)
+#define CHRONOS_ENGINE_ZONE_BEGIN(ctx, name)       static_cast<void>(0)
+#define CHRONOS_ENGINE_ZONE_END(ctx)               static_cast<void>(0)
+#define CHRONOS_ENGINE_PLOT(name, value)           static_cast<void>(0)
+#define CHRONOS_ENGINE_NS_PER_SAMPLE(name, n)      static_cast<void>(0)
+
+#endif
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef CHRONOS_SPSC_RING_H
+#define CHRONOS_SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace MarsDSP::inline Utils {
+
+    // bounded wait-free ring, exactly one producer and one consumer.
+    //
+    // each side owns its index and only reads the other's, so push and pop
+    // are a couple of loads, a copy and one release store: no CAS, no retry
+    // loop, no allocation after construction. push() drops the item when the
+    // consumer has fallen a full ring behind, which is what a meter wants –
+    // the audio thread never waits on a UI that stopped drawing.
+    template<typename T, std::size_t Capacity>
+    class SpscRing
+    {
+    public:
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static_assert(std::is_trivially_copyable_v<T>, "items are copied in and out by value");
+
+        SpscRing() = default;
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        // producer thread only. false when full and the item was dropped
+        bool push(const T& item) noexcept
+        {
+            const std::size_t pos = writePos.load(std::memory_order_relaxed);
+            if (pos - readPosCache == Capacity)
+            {
+                readPosCache = readPos.load(std::memory_order_acquire);
+                if (pos - readPosCache == Capacity)
+                    return false;
+            }
+            items[pos & kMask] = item;
+            writePos.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // consumer thread only
+        bool pop(T& item) noexcept
+        {
+            const std::size_t pos = readPos.load(std::memory_order_relaxed);
+            if (pos == writePosCache)
+            {
+                writePosCache = writePos.load(std::memory_order_acquire);
+                if (pos == writePosCache)
+                    return false;
+            }
+            item = items[pos & kMask];
+            readPos.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // ------------------------------------------------------------------
+        // Bulk, for sample streams: at most two memcpys either way
+        // ------------------------------------------------------------------
+
+        // producer thread only. Room the consumer is guaranteed to have left
+        // free until the next push (it can only grow in between).
+        std::size_t writeSpace() noexcept
+        {
+            readPosCache = readPos.load(std::memory_order_acquire);
+            return Capacity - (writePos.load(std::memory_order_relaxed) - readPosCache);
+        }
+
+        // producer thread only. All n items or none
+        bool pushN(const T* src, const std::size_t n) noexcept
+        {
+            const std::size_t pos = writePos.load(std::memory_order_relaxed);
+            if (Capacity - (pos - readPosCache) < n && writeSpace() < n)
+                return false;
+            const std::size_t at    = pos & kMask;
+            const std::size_t first = std::min(n, Capacity - at);
+            std::memcpy(items + at, src, first * sizeof(T));
+            std::memcpy(items, src + first, (n - first) * sizeof(T));
+            writePos.store(pos + n, std::memory_order_release);
+            return true;
+        }
+
+        // consumer thread only. Up to n items, returns how many
+        std::size_t popN(T* dst, const std::size_t n) noexcept
+        {
+            const std::size_t pos = readPos.load(std::memory_order_relaxed);
+            writePosCache = writePos.load(std::memory_order_acquire);
+            const std::size_t count = std::min(n, writePosCache - pos);
+            const std::size_t at    = pos & kMask;
+            const std::size_t first = std::min(count, Capacity - at);
+            std::memcpy(dst, items + at, first * sizeof(T));
+            std::memcpy(dst + first, items, (count - first) * sizeof(T));
+            readPos.store(pos + count, std::memory_order_release);
+            return count;
+        }
+
+        static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+    private:
+        static constexpr std::size_t kMask = Capacity - 1;
+        static constexpr std::size_t kLine = 64;
+
+        // each side's index sits on its own line next to its cached copy of
+        // the other side's index, which it only refreshes when the cache
+        // says full / empty
+        alignas(kLine) T items[Capacity] {};
+        alignas(kLine) std::atomic<std::size_t> writePos { 0 };
+        std::size_t readPosCache = 0;                               // producer's view of readPos
+        alignas(kLine) std::atomic<std::size_t> readPos { 0 };
+        std::size_t writePosCache = 0;                              // consumer's view of writePos
+    };
+}
+#endif
@@ -3,7 +3,47 @@
 #ifndef CHRONOS_TEMPOSYNC_H
 #define CHRONOS_TEMPOSYNC_H
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
 namespace MarsDSP::inline Utils {
 
+    // host-synced modulation rates, one LFO cycle per division.
+    // keep the order stable: the index is what the choice parameter stores.
+    enum class SyncDivision : int
+    {
+        Sixteenth, Eighth, Quarter, Half, Bar, TwoBars, FourBars
+    };
+
+    inline constexpr std::array<const char*, 7> kSyncDivisionNames
+    {
+        "1/16", "1/8", "1/4", "1/2", "1 Bar", "2 Bars", "4 Bars"
+    };
+
+    // length of one cycle in quarter notes (4/4 assumed for bars, hosts
+    // report ppq in quarter notes regardless of the time signature)
+    constexpr double beatsPerCycle(const SyncDivision division) noexcept
+    {
+        constexpr std::array<double, 7> beats { 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0 };
+        const auto i = static_cast<std::size_t>(division);
+        return i < beats.size() ? beats[i] : 1.0;
+    }
+
+    constexpr double syncedRateHz(const double bpm, const SyncDivision division) noexcept
+    {
+        return bpm / (60.0 * beatsPerCycle(division));
+    }
+
+    // phase of a cycle locked to the host timeline, as a full-scale uint32
+    // (2^32 = one cycle) for the integer phase accumulators in LfoBank.
+    // works for negative ppq (pre-roll) as well.
+    inline std::uint32_t phaseFromPpq(const double ppqPosition, const SyncDivision division) noexcept
+    {
+        const double cycles = ppqPosition / beatsPerCycle(division);
+        const double frac   = cycles - std::floor(cycles);
+        return static_cast<std::uint32_t>(static_cast<std::uint64_t>(frac * 4294967296.0) & 0xFFFFFFFFu);
+    }
 }
-#endif
\ No newline at end of file
+#endif
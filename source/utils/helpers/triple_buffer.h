@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef CHRONOS_TRIPLE_BUFFER_H
+#define CHRONOS_TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace MarsDSP::inline Utils {
+
+    // latest-value handoff between one writer and one reader.
+    //
+    // three slots: the writer fills its back slot and swaps it with the
+    // middle one, the reader swaps the middle one for its front slot when
+    // something new was published. each side only ever touches its own
+    // slot, so neither waits and a slow reader just skips to the newest
+    // value. no allocation after construction.
+    template<typename T>
+    class TripleBuffer
+    {
+    public:
+        TripleBuffer() = default;
+        TripleBuffer(const TripleBuffer&) = delete;
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+        // writer thread only
+        T& back() noexcept { return slots[backIndex]; }
+
+        void publish() noexcept
+        {
+            backIndex = middle.exchange(static_cast<uint8_t>(backIndex | kFresh), std::memory_order_acq_rel) & kIndexMask;
+        }
+
+        // reader thread only. true when front() changed
+        bool update() noexcept
+        {
+            if ((middle.load(std::memory_order_relaxed) & kFresh) == 0)
+                return false;
+            frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & kIndexMask;
+            return true;
+        }
+
+        const T& front() const noexcept { return slots[frontIndex]; }
+
+    private:
+        static constexpr uint8_t kIndexMask = 3;
+        static constexpr uint8_t kFresh     = 4;
+
+        std::array<T, 3> slots {};
+        std::atomic<uint8_t> middle { 1 };
+        uint8_t backIndex  = 0;
+        uint8_t frontIndex = 2;
+    };
+}
+#endif
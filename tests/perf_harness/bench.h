@@ -0,0 +1,447 @@
+// Statistical benchmark runner shared by the perf harness targets.
+//
+//   Bench::Suite suite("perf_sin", argc, argv);
+//   suite.run("std::sin", blockSize, [&] { ...one block...; Bench::doNotOptimize(output); });
+//   suite.run("Pade (SIMD)", blockSize, [&] { ... }, { .relativeTo = "std::sin" });
+//   return suite.finish();
+//
+// Per case: warm-up, then an iteration count calibrated so that one
+// repetition lasts at least --min-time, then --reps timed repetitions.
+// Everything is reported per iteration (one call of the case's function):
+// median, MAD, p99, min and mean over the repetitions, how many
+// repetitions were outliers (more than kOutlierMads MADs from the median -
+// preemption, frequency steps; the median and MAD ignore them anyway),
+// throughput in items / s from the median, speedup against another case
+// and the hardware counters of perf_counters.h over all repetitions.
+//
+// finish() prints the table and writes logs/<suite>_results.csv and
+// logs/<suite>_results.json, one row / object per case with the same
+// fields in both (see kFields). Against a baseline - --baseline FILE, or
+// baselines/<suite>.csv when that exists - every case whose median grew by
+// more than --threshold is flagged and the exit code is 1. Baselines are
+// machine-specific: --save-baseline writes this run's CSV there.
+// viz_bench.py draws any suite's CSV as a bar chart.
+//
+// The thread is pinned to one CPU (--cpu N, default the one it starts on)
+// so repetitions don't migrate between cores or caches; macOS has no
+// affinity API, there it only runs. --filter TEXT runs the cases whose
+// name contains TEXT, --quick trades precision for a short run.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "perf_counters.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace Bench
+{
+    // keeps the compiler from proving a result unused
+    template<typename T>
+    inline void doNotOptimize(T& value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    // pins the calling thread to cpu (-1: the one it is on now); returns
+    // the CPU it ended up on, or -1 where there is no affinity API
+    inline int pinThread(const int cpu) noexcept
+    {
+#if defined(__linux__)
+        const int target = cpu >= 0 ? cpu : sched_getcpu();
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(target, &set);
+        return target >= 0 && sched_setaffinity(0, sizeof(set), &set) == 0 ? target : -1;
+#elif defined(_WIN32)
+        const int target = cpu >= 0 ? cpu : static_cast<int>(GetCurrentProcessorNumber());
+        return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << target) != 0 ? target : -1;
+#else
+        (void) cpu;
+        return -1;
+#endif
+    }
+
+    struct CaseOptions
+    {
+        std::string relativeTo;     // latest case of this name divides the speedup; empty: none
+        std::string tags;           // free-form "key=value;key=value" for the plots
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::string tags;
+        double   items = 1.0;                   // per iteration (samples, ...)
+        int      reps = 0;
+        uint64_t itersPerRep = 0;
+        double   medianNs = 0.0;                // all times per iteration
+        double   madNs = 0.0;
+        double   p99Ns = 0.0;
+        double   minNs = 0.0;
+        double   meanNs = 0.0;
+        int      outliers = 0;
+        double   itemsPerSecond = 0.0;
+        double   speedup = std::numeric_limits<double>::quiet_NaN();
+        double   baselineNs = std::numeric_limits<double>::quiet_NaN();
+        double   change = std::numeric_limits<double>::quiet_NaN();    // median / baseline - 1
+        bool     regressed = false;
+        CounterReading counters;                // over all repetitions
+        double   countedIterations = 0.0;
+    };
+
+    class Suite
+    {
+    public:
+        static constexpr double kOutlierMads = 5.0;
+
+        Suite(std::string suiteName, const int argc, char** argv) : name(std::move(suiteName))
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                const std::string_view arg = argv[i];
+                auto value = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+                if (arg == "--reps")               reps = std::max(3, std::atoi(value().c_str()));
+                else if (arg == "--min-time")      minRepSeconds = std::atof(value().c_str());
+                else if (arg == "--warmup")        warmupSeconds = std::atof(value().c_str());
+                else if (arg == "--cpu")           cpu = std::atoi(value().c_str());
+                else if (arg == "--baseline")      baselinePath = value();
+                else if (arg == "--threshold")     threshold = std::atof(value().c_str());
+                else if (arg == "--filter")        filter = value();
+                else if (arg == "--save-baseline") saveBaseline = true;
+                else if (arg == "--quick")         { reps = 9; minRepSeconds = 0.002; warmupSeconds = 0.01; }
+                else
+                    std::cerr << "ignoring unknown argument " << arg << "\n";
+            }
+            if (baselinePath.empty())
+                baselinePath = (std::filesystem::path(kDir) / "baselines" / (name + ".csv")).string();
+
+            pinned = pinThread(cpu);
+            std::cout << name << ": " << reps << " reps of >= " << minRepSeconds * 1.0e3 << " ms, "
+                      << (pinned >= 0 ? "pinned to CPU " + std::to_string(pinned) : std::string("not pinned")) << "\n"
+                      << counters.describe() << std::endl;
+        }
+
+        Suite(const Suite&) = delete;
+        Suite& operator=(const Suite&) = delete;
+
+        // times fn(), which does `items` units of work per call
+        template<typename Fn>
+        Result run(const std::string& caseName, const double items, Fn&& fn, const CaseOptions& options = {})
+        {
+            if (!filter.empty() && caseName.find(filter) == std::string::npos)
+                return {};
+
+            using Clock = std::chrono::steady_clock;
+            auto timeIterations = [&](const uint64_t n) {
+                const auto t0 = Clock::now();
+                for (uint64_t i = 0; i < n; ++i)
+                    fn();
+                return std::chrono::duration<double>(Clock::now() - t0).count();
+            };
+
+            // warm-up doubles as calibration: grow the batch until one lasts min-time
+            uint64_t iters = 1;
+            double warmed = 0.0;
+            for (;;)
+            {
+                const double t = timeIterations(iters);
+                warmed += t;
+                if (t >= minRepSeconds && warmed >= warmupSeconds)
+                    break;
+                if (t < minRepSeconds)
+                    iters = std::max(iters + 1, static_cast<uint64_t>(static_cast<double>(iters) * std::min(10.0, 1.2 * minRepSeconds / std::max(t, 1.0e-9))));
+            }
+
+            std::vector<double> samples(static_cast<size_t>(reps));
+            counters.start();
+            for (auto& s : samples)
+                s = timeIterations(iters) * 1.0e9 / static_cast<double>(iters);
+            const CounterReading reading = counters.stop();
+
+            Result r;
+            r.name        = caseName;
+            r.tags        = options.tags;
+            r.items       = items;
+            r.reps        = reps;
+            r.itersPerRep = iters;
+            r.counters    = reading;
+            r.countedIterations = static_cast<double>(iters) * reps;
+            summarise(samples, r);
+            if (!options.relativeTo.empty())
+            {
+                const auto it = std::find_if(results.rbegin(), results.rend(), [&](const Result& o) { return o.name == options.relativeTo; });
+                if (it != results.rend())
+                    r.speedup = it->medianNs / r.medianNs;
+                else if (options.relativeTo == caseName)
+                    r.speedup = 1.0;
+            }
+            results.push_back(r);
+            printRow(r);
+            return r;
+        }
+
+        // writes the logs, compares against the baseline; returns the exit code
+        int finish()
+        {
+            const auto baseline = readBaseline(baselinePath);
+            int regressions = 0;
+            for (auto& r : results)
+            {
+                const auto it = baseline.find(key(r.name, r.tags));
+                if (it == baseline.end())
+                    continue;
+                r.baselineNs = it->second;
+                r.change     = r.medianNs / r.baselineNs - 1.0;
+                r.regressed  = r.change > threshold;
+                regressions += r.regressed ? 1 : 0;
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(std::filesystem::path(kDir) / "logs", ec);
+            const auto stem = std::filesystem::path(kDir) / "logs" / (name + "_results");
+            const bool wrote = writeCsv(stem.string() + ".csv") && writeJson(stem.string() + ".json");
+            if (!wrote)
+                std::cerr << "Failed to write " << stem.string() << ".csv / .json" << std::endl;
+
+            if (!baseline.empty())
+            {
+                const auto flags = std::cout.flags();
+                const auto precision = std::cout.precision();
+                std::cout << "\nAgainst " << baselinePath << " (threshold +" << threshold * 100.0 << " %):\n";
+                for (const auto& r : results)
+                    if (std::isfinite(r.change))
+                        std::cout << "  " << std::left << std::setw(34) << label(r) << std::right << std::showpos
+                                  << std::fixed << std::setprecision(1) << r.change * 100.0 << " %" << std::noshowpos
+                                  << (r.regressed ? "  REGRESSION" : "") << "\n";
+                std::cout << (regressions == 0 ? "No regressions." : std::to_string(regressions) + " regression(s).") << std::endl;
+                std::cout.flags(flags);
+                std::cout.precision(precision);
+            }
+
+            if (saveBaseline)
+            {
+                std::filesystem::create_directories(std::filesystem::path(baselinePath).parent_path(), ec);
+                if (writeCsv(baselinePath))
+                    std::cout << "Saved baseline " << baselinePath << std::endl;
+            }
+            return wrote && regressions == 0 ? 0 : 1;
+        }
+
+        [[nodiscard]] const std::vector<Result>& getResults() const noexcept { return results; }
+
+        // ------------------------------------------------------------------
+        // Schema: one CSV column / JSON key per entry, in this order
+        // ------------------------------------------------------------------
+        static constexpr const char* kFields =
+            "suite,case,tags,items,reps,iters_per_rep,median_ns,mad_ns,p99_ns,min_ns,mean_ns,outliers,"
+            "items_per_s,speedup,baseline_ns,change,regression";
+
+    private:
+        static constexpr const char* kDir = "tests/perf_harness";
+
+        static void summarise(std::vector<double>& s, Result& r)
+        {
+            std::sort(s.begin(), s.end());
+            auto quantile = [](const std::vector<double>& v, const double q) {
+                const double pos = q * static_cast<double>(v.size() - 1);
+                const auto lo = static_cast<size_t>(pos);
+                const size_t hi = std::min(lo + 1, v.size() - 1);
+                return v[lo] + (v[hi] - v[lo]) * (pos - static_cast<double>(lo));
+            };
+            r.medianNs = quantile(s, 0.5);
+            std::vector<double> dev(s.size());
+            for (size_t i = 0; i < s.size(); ++i)
+                dev[i] = std::abs(s[i] - r.medianNs);
+            std::sort(dev.begin(), dev.end());
+            r.madNs = quantile(dev, 0.5);
+            r.p99Ns = quantile(s, 0.99);
+            r.minNs = s.front();
+            double sum = 0.0;
+            for (const double x : s)
+                sum += x;
+            r.meanNs = sum / static_cast<double>(s.size());
+            for (const double d : dev)
+                r.outliers += d > kOutlierMads * r.madNs && r.madNs > 0.0 ? 1 : 0;
+            r.itemsPerSecond = r.items * 1.0e9 / r.medianNs;
+        }
+
+        static std::string label(const Result& r)
+        {
+            return r.tags.empty() ? r.name : r.name + " [" + r.tags + "]";
+        }
+
+        static void printRow(const Result& r)
+        {
+            const auto flags = std::cout.flags();
+            const auto precision = std::cout.precision();
+            std::cout << "  " << std::left << std::setw(34) << r.name << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(12) << r.medianNs * 1.0e-3 << " us  +-" << std::setw(7) << r.madNs * 1.0e-3
+                      << "  p99 " << std::setw(10) << r.p99Ns * 1.0e-3 << " us  "
+                      << std::setprecision(1) << std::setw(8) << r.itemsPerSecond * 1.0e-6 << " M/s";
+            if (std::isfinite(r.speedup))
+                std::cout << "  " << std::setprecision(2) << r.speedup << "x";
+            if (r.outliers > 0)
+                std::cout << "  (" << r.outliers << " outliers)";
+            if (!r.tags.empty())
+                std::cout << "  [" << r.tags << "]";
+            std::cout << std::endl;
+            std::cout.flags(flags);
+            std::cout.precision(precision);
+        }
+
+        static std::string key(const std::string& caseName, const std::string& tags) { return caseName + '\x1f' + tags; }
+
+        static std::string csvQuote(const std::string& s)
+        {
+            if (s.find_first_of(",\"\n") == std::string::npos)
+                return s;
+            std::string q = "\"";
+            for (const char c : s)
+                q += c == '"' ? std::string("\"\"") : std::string(1, c);
+            return q + "\"";
+        }
+
+        static std::vector<std::string> csvSplit(const std::string& line)
+        {
+            std::vector<std::string> cells(1);
+            bool quoted = false;
+            for (size_t i = 0; i < line.size(); ++i)
+            {
+                const char c = line[i];
+                if (quoted && c == '"' && i + 1 < line.size() && line[i + 1] == '"') { cells.back() += '"'; ++i; }
+                else if (c == '"')                                                    quoted = !quoted;
+                else if (c == ',' && !quoted)                                         cells.emplace_back();
+                else                                                                  cells.back() += c;
+            }
+            return cells;
+        }
+
+        // case + tags -> median_ns of a CSV this class wrote; empty if there is none
+        static std::map<std::string, double> readBaseline(const std::string& path)
+        {
+            std::map<std::string, double> medians;
+            std::ifstream f(path);
+            std::string line;
+            if (!f.is_open() || !std::getline(f, line))
+                return medians;
+            const auto header = csvSplit(line);
+            auto column = [&](const char* field) {
+                return static_cast<size_t>(std::find(header.begin(), header.end(), field) - header.begin());
+            };
+            const size_t caseCol = column("case"), tagsCol = column("tags"), medianCol = column("median_ns");
+            if (caseCol >= header.size() || tagsCol >= header.size() || medianCol >= header.size())
+            {
+                std::cerr << path << " is not a benchmark CSV, no baseline comparison" << std::endl;
+                return medians;
+            }
+            while (std::getline(f, line))
+            {
+                const auto cells = csvSplit(line);
+                if (cells.size() == header.size())
+                    medians[key(cells[caseCol], cells[tagsCol])] = std::atof(cells[medianCol].c_str());
+            }
+            return medians;
+        }
+
+        static std::string num(const double x)
+        {
+            if (!std::isfinite(x))
+                return "";
+            std::ostringstream s;
+            s << std::setprecision(9) << x;
+            return s.str();
+        }
+
+        bool writeCsv(const std::string& path) const
+        {
+            std::ofstream f(path);
+            if (!f.is_open())
+                return false;
+            f << kFields << ',' << PerfCounters::csvHeader() << '\n';
+            for (const auto& r : results)
+                f << csvQuote(name) << ',' << csvQuote(r.name) << ',' << csvQuote(r.tags) << ',' << num(r.items) << ','
+                  << r.reps << ',' << r.itersPerRep << ',' << num(r.medianNs) << ',' << num(r.madNs) << ','
+                  << num(r.p99Ns) << ',' << num(r.minNs) << ',' << num(r.meanNs) << ',' << r.outliers << ','
+                  << num(r.itemsPerSecond) << ',' << num(r.speedup) << ',' << num(r.baselineNs) << ','
+                  << num(r.change) << ',' << (r.regressed ? 1 : 0) << ','
+                  << PerfCounters::csvFields(r.counters, r.countedIterations) << '\n';
+            return true;
+        }
+
+        bool writeJson(const std::string& path) const
+        {
+            std::ofstream f(path);
+            if (!f.is_open())
+                return false;
+            auto str = [](const std::string& s) {
+                std::string q = "\"";
+                for (const char c : s)
+                    q += c == '"' || c == '\\' ? std::string("\\") + c : std::string(1, c);
+                return q + "\"";
+            };
+            auto jnum = [](const double x) { return std::isfinite(x) ? num(x) : std::string("null"); };
+            auto perIter = [&](const double count, const Result& r) { return jnum(count / r.countedIterations); };
+
+            f << "{\n  \"suite\": " << str(name) << ",\n  \"config\": { \"reps\": " << reps
+              << ", \"min_rep_s\": " << jnum(minRepSeconds) << ", \"warmup_s\": " << jnum(warmupSeconds)
+              << ", \"cpu\": " << pinned << ", \"threshold\": " << jnum(threshold) << " },\n  \"cases\": [";
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const auto& r = results[i];
+                f << (i == 0 ? "\n" : ",\n") << "    { \"suite\": " << str(name) << ", \"case\": " << str(r.name)
+                  << ", \"tags\": " << str(r.tags) << ", \"items\": " << jnum(r.items) << ", \"reps\": " << r.reps
+                  << ", \"iters_per_rep\": " << r.itersPerRep << ", \"median_ns\": " << jnum(r.medianNs)
+                  << ", \"mad_ns\": " << jnum(r.madNs) << ", \"p99_ns\": " << jnum(r.p99Ns)
+                  << ", \"min_ns\": " << jnum(r.minNs) << ", \"mean_ns\": " << jnum(r.meanNs)
+                  << ", \"outliers\": " << r.outliers << ", \"items_per_s\": " << jnum(r.itemsPerSecond)
+                  << ", \"speedup\": " << jnum(r.speedup) << ", \"baseline_ns\": " << jnum(r.baselineNs)
+                  << ", \"change\": " << jnum(r.change) << ", \"regression\": " << (r.regressed ? "true" : "false")
+                  << ", \"cycles\": " << perIter(r.counters.cycles, r) << ", \"instructions\": " << perIter(r.counters.instructions, r)
+                  << ", \"ipc\": " << jnum(r.counters.ipc()) << ", \"l1d_misses\": " << perIter(r.counters.l1dMisses, r)
+                  << ", \"llc_misses\": " << perIter(r.counters.llcMisses, r) << ", \"branch_misses\": " << perIter(r.counters.branchMisses, r)
+                  << " }";
+            }
+            f << "\n  ]\n}\n";
+            return true;
+        }
+
+        std::string name;
+        int    reps = 31;
+        double minRepSeconds = 0.01;
+        double warmupSeconds = 0.05;
+        int    cpu = -1;
+        int    pinned = -1;
+        double threshold = 0.05;
+        bool   saveBaseline = false;
+        std::string baselinePath;
+        std::string filter;
+
+        PerfCounters counters;
+        std::vector<Result> results;
+    };
+}
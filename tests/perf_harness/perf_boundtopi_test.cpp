@@ -1,20 +1,13 @@
 #include <iostream>
-#include <fstream>
-#include <chrono>
 #include <vector>
 #include <cmath>
 #include <numbers>
-#include <iomanip>
-#include <filesystem>
 #include "dsp/math/fastermath.h"
+#include "bench.h"
 
-int main()
+int main(int argc, char** argv)
 {
     const int blockSize = 512;
-    const int iterations = 1000000;
-
-    // Ensure the logs directory exists
-    std::filesystem::create_directories("tests/perf_harness/logs");
 
     std::vector<float> input(blockSize);
     for (int i = 0; i < blockSize; ++i)
@@ -25,53 +18,22 @@ int main()
 
     std::vector<float> output(blockSize);
 
-    std::cout << "Benchmarking boundToPi implementations (Block Size: " << blockSize << ", Iterations: " << iterations << ")..." << std::endl;
+    std::cout << "Benchmarking boundToPi implementations (Block Size: " << blockSize << ")..." << std::endl;
+    Bench::Suite suite("perf_boundtopi", argc, argv);
 
-    // 1. Benchmark boundToPi (Scalar)
-    auto start = std::chrono::high_resolution_clock::now();
-    for (int it = 0; it < iterations; ++it)
-    {
+    // 1. boundToPi (Scalar)
+    suite.run("boundToPi (Scalar)", blockSize, [&] {
         for (int i = 0; i < blockSize; ++i)
-        {
             output[i] = MarsDSP::boundToPi(input[i]);
-        }
-        if (output[0] > 1000.0f) std::cout << "Never happens";
-    }
-    auto end = std::chrono::high_resolution_clock::now();
-    double timeScalar = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = "boundToPi (Scalar)" });
 
-    // 2. Benchmark boundToPiSIMD (SIMD)
-    start = std::chrono::high_resolution_clock::now();
-    for (int it = 0; it < iterations; ++it)
-    {
+    // 2. boundToPiSIMD (SIMD)
+    suite.run("boundToPiSIMD (SIMD)", blockSize, [&] {
         for (int i = 0; i < blockSize; i += 4)
-        {
-            SIMD_M128 vx = SIMD_MM(loadu_ps)(&input[i]);
-            SIMD_M128 vres = MarsDSP::boundToPiSIMD(vx);
-            SIMD_MM(storeu_ps)(&output[i], vres);
-        }
-        if (output[0] > 1000.0f) std::cout << "Never happens";
-    }
-    end = std::chrono::high_resolution_clock::now();
-    double timeSimd = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
-
-    // Output to CSV
-    std::ofstream csv("tests/perf_harness/logs/perf_boundtopi_results.csv");
-    if (!csv.is_open())
-    {
-        std::cerr << "Failed to open tests/perf_harness/logs/perf_boundtopi_results.csv" << std::endl;
-        return 1;
-    }
-
-    csv << "algorithm,avg_time_us,speedup\n";
-    csv << std::fixed << std::setprecision(6);
-    csv << "boundToPi (Scalar)," << timeScalar << ",1.0\n";
-    csv << "boundToPiSIMD (SIMD)," << timeSimd << "," << (timeScalar / timeSimd) << "\n";
-    csv.close();
-
-    std::cout << "\nResults (Average time per block of " << blockSize << " samples):" << std::endl;
-    std::cout << "  boundToPi (Scalar): " << std::setw(8) << timeScalar << " us" << std::endl;
-    std::cout << "  boundToPiSIMD (SIMD): " << std::setw(8) << timeSimd << " us (" << (timeScalar / timeSimd) << "x faster)" << std::endl;
+            SIMD_MM(storeu_ps)(&output[i], MarsDSP::boundToPiSIMD(SIMD_MM(loadu_ps)(&input[i])));
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = "boundToPi (Scalar)" });
 
-    return 0;
+    return suite.finish();
 }
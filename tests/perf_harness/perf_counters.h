@@ -0,0 +1,208 @@
+// Hardware performance counters around a measured region, via perf_event_open.
+//
+//   PerfCounters counters;                   // opens what it can, once
+//   counters.start();
+//   ... measured region ...
+//   const CounterReading c = counters.stop();
+//   csv << ... << "," << PerfCounters::csvFields(c, iterations) << "\n";
+//
+// Counts cycles, instructions, L1D read misses, last-level-cache misses and
+// branch mispredictions of this thread, user space only. Each counter is
+// opened on its own, so one the PMU lacks (LLC on some VMs) only blanks its
+// own column, and a counter the kernel multiplexed is scaled up by
+// enabled / running time. Where nothing can be opened – not Linux,
+// perf_event_paranoid too strict, a container without the syscall – every
+// reading is NaN and the CSV fields come out empty: the benchmark runs and
+// reports wall-clock time exactly as before.
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct CounterReading
+{
+    double cycles       = std::numeric_limits<double>::quiet_NaN();
+    double instructions = std::numeric_limits<double>::quiet_NaN();
+    double l1dMisses    = std::numeric_limits<double>::quiet_NaN();
+    double llcMisses    = std::numeric_limits<double>::quiet_NaN();
+    double branchMisses = std::numeric_limits<double>::quiet_NaN();
+
+    [[nodiscard]] double ipc() const noexcept { return instructions / cycles; }
+};
+
+class PerfCounters
+{
+public:
+    static constexpr int kNumCounters = 5;
+
+    PerfCounters()
+    {
+#if defined(__linux__)
+        constexpr auto cache = [](const uint64_t id, const uint64_t result) {
+            return id | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+        };
+        const std::array<std::pair<uint32_t, uint64_t>, kNumCounters> events {{
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_MISS) },
+            { PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_LL,  PERF_COUNT_HW_CACHE_RESULT_MISS) },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        }};
+        for (int i = 0; i < kNumCounters; ++i)
+        {
+            perf_event_attr attr {};
+            attr.size           = sizeof(attr);
+            attr.type           = events[static_cast<size_t>(i)].first;
+            attr.config         = events[static_cast<size_t>(i)].second;
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds[static_cast<size_t>(i)] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fds[static_cast<size_t>(i)] < 0 && firstError == 0)
+                firstError = errno;
+        }
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#if defined(__linux__)
+        for (const int fd : fds)
+            if (fd >= 0)
+                close(fd);
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // true when at least one counter opened
+    [[nodiscard]] bool available() const noexcept
+    {
+        for (const int fd : fds)
+            if (fd >= 0)
+                return true;
+        return false;
+    }
+
+    // one line for the benchmark's console header
+    [[nodiscard]] std::string describe() const
+    {
+        static constexpr const char* names[kNumCounters] = { "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses" };
+        std::ostringstream s;
+        s << "perf counters: ";
+        if (!available())
+        {
+#if defined(__linux__)
+            s << "unavailable (" << std::strerror(firstError);
+            if (firstError == EACCES || firstError == EPERM)
+                s << "; see /proc/sys/kernel/perf_event_paranoid";
+            else if (firstError == ENOENT || firstError == EOPNOTSUPP)
+                s << "; no hardware PMU exposed, e.g. inside a VM";
+            s << ")";
+#else
+            s << "unavailable on this platform";
+#endif
+            s << ", counter columns left empty";
+            return s.str();
+        }
+        for (int i = 0; i < kNumCounters; ++i)
+            s << names[i] << (fds[static_cast<size_t>(i)] >= 0 ? "" : " (n/a)") << (i + 1 < kNumCounters ? ", " : "");
+        return s.str();
+    }
+
+    void start() noexcept
+    {
+#if defined(__linux__)
+        for (const int fd : fds)
+            if (fd >= 0)
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        for (const int fd : fds)
+            if (fd >= 0)
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    // counts since start(); NaN for a counter that isn't there or never ran
+    CounterReading stop() noexcept
+    {
+        std::array<double, kNumCounters> v;
+        v.fill(std::numeric_limits<double>::quiet_NaN());
+#if defined(__linux__)
+        for (const int fd : fds)
+            if (fd >= 0)
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        for (int i = 0; i < kNumCounters; ++i)
+        {
+            struct { uint64_t value, enabled, running; } r {};
+            const int fd = fds[static_cast<size_t>(i)];
+            if (fd >= 0 && read(fd, &r, sizeof(r)) == static_cast<ssize_t>(sizeof(r)) && r.running > 0)
+                v[static_cast<size_t>(i)] = static_cast<double>(r.value) * static_cast<double>(r.enabled) / static_cast<double>(r.running);
+        }
+#endif
+        CounterReading c;
+        c.cycles       = v[0];
+        c.instructions = v[1];
+        c.l1dMisses    = v[2];
+        c.llcMisses    = v[3];
+        c.branchMisses = v[4];
+        return c;
+    }
+
+    // measures fn() between start() and stop()
+    template<typename Fn>
+    CounterReading measure(Fn&& fn) noexcept(noexcept(fn()))
+    {
+        start();
+        fn();
+        return stop();
+    }
+
+    // ------------------------------------------------------------------
+    // CSV: appended after a benchmark's own columns
+    // ------------------------------------------------------------------
+
+    static const char* csvHeader() noexcept
+    {
+        return "cycles,instructions,ipc,l1d_misses,llc_misses,branch_misses";
+    }
+
+    // each count divided by perUnit (iterations, samples, ...) so the
+    // columns use the same unit as the row's time; blank when not counted
+    static std::string csvFields(const CounterReading& c, const double perUnit)
+    {
+        std::ostringstream s;
+        s.precision(6);
+        auto field = [&](const double x, const bool last = false) {
+            if (std::isfinite(x))
+                s << x;
+            if (!last)
+                s << ',';
+        };
+        field(c.cycles / perUnit);
+        field(c.instructions / perUnit);
+        field(c.ipc());
+        field(c.l1dMisses / perUnit);
+        field(c.llcMisses / perUnit);
+        field(c.branchMisses / perUnit, true);
+        return s.str();
+    }
+
+private:
+    std::array<int, kNumCounters> fds { -1, -1, -1, -1, -1 };
+    int firstError = 0;
+};
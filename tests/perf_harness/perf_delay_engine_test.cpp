@@ -8,22 +8,24 @@
 //   2. "juce_dsp"       - juce::dsp::DelayLine<float, Lagrange3rd>.
 //                         Industry-standard library baseline.
 //
-// Emits a CSV (tests/perf_harness/logs/delay_perf.csv) with ns-per-sample
-// and realtime factor for each engine across a sweep of block sizes.
+// One benchmark case per engine, mode and block size on bench.h: one
+// iteration is one block, so the logs (tests/perf_harness/logs/
+// delay_perf_results.csv / .json) hold median / MAD / p99 time per block,
+// samples per second and per-block hardware counters; the tags carry the
+// engine, mode, block size and sample rate for the plot.
 //
 // Pair with viz_delay_perf.py for the PNG chart.
 #include <iostream>
-#include <fstream>
 #include <vector>
 #include <string>
 #include <random>
-#include <chrono>
 #include <algorithm>
 #include <cmath>
 #include <cstring>
 
 #include <JuceHeader.h>
 #include "dsp/engine/delay/delay_engine.h"
+#include "bench.h"
 
 using namespace MarsDSP::DSP;
 
@@ -137,155 +139,51 @@ struct JuceDspDelay
     }
 };
 
-// ---------------------------------------------------------------------------
-// Timing helpers
-// ---------------------------------------------------------------------------
-struct BenchResult
-{
-    std::string engine;
-    int   blockSize;
-    std::string mode;           // "stereo" or "mono"
-    int64_t totalSamples;
-    double ns_per_sample;
-    double realtime_factor;     // = 1e9 / ns_per_sample / sampleRate
-};
-
-template <typename Fn>
-double timeRunNs(Fn&& f, int warmupBlocks, int timedBlocks)
-{
-    for (int i = 0; i < warmupBlocks; ++i) f();
-    const auto t0 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < timedBlocks; ++i) f();
-    const auto t1 = std::chrono::high_resolution_clock::now();
-    return std::chrono::duration<double, std::nano>(t1 - t0).count();
-}
-
-// Touch-the-buffer barrier so compilers can't dead-code-eliminate the work.
-volatile float g_sink = 0.0f;
-static inline void sinkBuffers(const float* L, const float* R, int n)
-{
-    float s = 0.0f;
-    for (int i = 0; i < n; ++i) { s += L[i] + R[i]; }
-    g_sink = s;
-}
-
 // ---------------------------------------------------------------------------
 // Main
 // ---------------------------------------------------------------------------
-int main()
+int main(int argc, char** argv)
 {
     std::cout << "Chronos DelayEngine performance benchmark\n";
+    Bench::Suite suite("delay_perf", argc, argv);
 
     constexpr double sampleRate = 48000.0;
     const std::vector<int> blockSizes = { 32, 64, 128, 256, 512, 1024, 2048 };
-    constexpr int warmupBlocks = 32;
-    // Aim for ~2 seconds of audio per measurement regardless of block size.
-    auto blocksForSeconds = [](double sec, int bs) {
-        return std::max(8, static_cast<int>(std::ceil(sec * sampleRate / bs)));
-    };
 
+    // one long stretch of noise every engine reads the same windows of, so
+    // input generation stays out of the timed block
+    constexpr int kNoiseLength = 1 << 16;
     std::mt19937 rng(42);
     std::uniform_real_distribution<float> dist(-0.25f, 0.25f);
+    std::vector<float> noiseL(kNoiseLength), noiseR(kNoiseLength);
+    for (int i = 0; i < kNoiseLength; ++i) { noiseL[i] = dist(rng); noiseR[i] = dist(rng); }
 
-    std::vector<BenchResult> results;
+    // sums the output so it can't be dead-code-eliminated
+    float sink = 0.0f;
 
     for (int bs : blockSizes)
     {
-        const int timedBlocks = blocksForSeconds(2.0, bs);
-        const int64_t totalSamples = static_cast<int64_t>(timedBlocks) * bs;
-
-        // Reusable scratch input. We regenerate fresh random data for each
-        // engine/mode to make sure caches aren't giving one engine an unfair
-        // advantage on later runs.
-        std::vector<float> scratchL(static_cast<size_t>(bs));
-        std::vector<float> scratchR(static_cast<size_t>(bs));
+        juce::AudioBuffer<float> buf(2, bs);
+        int readPos = 0;
 
-        // Helper: run a closure that processes a (bs)-sample block in-place
-        // on scratchL/scratchR and returns ns-per-sample.
-        auto runEngine = [&](const std::string& engineName,
-                             const std::string& mode,
-                             auto setupFn,
-                             auto processFn)
+        // times processFn over (bs)-sample blocks in place in buf
+        auto runEngine = [&](const std::string& engineName, const std::string& mode, auto setupFn, auto processFn)
         {
             setupFn();
-            // fresh pseudo-random input each run
-            auto fill = [&] {
-                for (int i = 0; i < bs; ++i) {
-                    scratchL[i] = dist(rng);
-                    scratchR[i] = dist(rng);
-                }
-            };
-            auto step = [&] {
-                fill();
-                processFn(scratchL.data(), scratchR.data(), bs);
-                sinkBuffers(scratchL.data(), scratchR.data(), bs);
-            };
-            const double ns = timeRunNs(step, warmupBlocks, timedBlocks);
-            BenchResult r;
-            r.engine          = engineName;
-            r.blockSize       = bs;
-            r.mode            = mode;
-            r.totalSamples    = totalSamples;
-            r.ns_per_sample   = ns / static_cast<double>(totalSamples);
-            r.realtime_factor = 1.0e9 / (r.ns_per_sample * sampleRate);
-            results.push_back(r);
-            std::cout << "  [" << engineName << " " << mode
-                      << " bs=" << bs << "] "
-                      << r.ns_per_sample << " ns/sample, "
-                      << r.realtime_factor << "x realtime\n";
+            const std::string tags = "engine=" + engineName + ";mode=" + mode + ";block_size=" + std::to_string(bs)
+                                   + ";sample_rate=" + std::to_string(static_cast<int>(sampleRate));
+            suite.run(engineName + " " + mode, bs, [&] {
+                float* L = buf.getWritePointer(0);
+                float* R = buf.getWritePointer(1);
+                std::memcpy(L, noiseL.data() + readPos, sizeof(float) * static_cast<size_t>(bs));
+                std::memcpy(R, noiseR.data() + readPos, sizeof(float) * static_cast<size_t>(bs));
+                readPos = (readPos + bs) % (kNoiseLength - bs);
+                processFn(L, R, bs);
+                sink += L[0] + R[bs - 1];
+                Bench::doNotOptimize(sink);
+            }, { .relativeTo = "naive_scalar stereo", .tags = tags });
         };
 
-        // ---- Chronos stereo ----
-        DelayEngine<float> chronos;
-        runEngine("chronos", "stereo",
-            /*setup*/ [&] {
-                juce::dsp::ProcessSpec s{}; s.sampleRate = sampleRate;
-                s.maximumBlockSize = static_cast<uint32_t>(bs); s.numChannels = 2;
-                chronos.prepare(s);
-                chronos.setDelayTimeParam(200.0f);
-                chronos.setMixParam(0.5f);
-                chronos.setFeedbackParam(0.3f);
-                chronos.setCrossfeedParam(0.3f);
-                chronos.setLowCutParam(100.0f);
-                chronos.setHighCutParam(8000.0f);
-                chronos.setMono(false);
-                chronos.setBypassed(false);
-            },
-            /*process*/ [&](float* L, float* R, int n) {
-                juce::AudioBuffer<float> buf(2, n);
-                std::memcpy(buf.getWritePointer(0), L, sizeof(float) * n);
-                std::memcpy(buf.getWritePointer(1), R, sizeof(float) * n);
-                juce::dsp::AudioBlock<float> block(buf);
-                chronos.process(block, n);
-                std::memcpy(L, buf.getReadPointer(0), sizeof(float) * n);
-                std::memcpy(R, buf.getReadPointer(1), sizeof(float) * n);
-            });
-
-        // ---- Chronos mono ----
-        DelayEngine<float> chronosMono;
-        runEngine("chronos", "mono",
-            [&] {
-                juce::dsp::ProcessSpec s{}; s.sampleRate = sampleRate;
-                s.maximumBlockSize = static_cast<uint32_t>(bs); s.numChannels = 2;
-                chronosMono.prepare(s);
-                chronosMono.setDelayTimeParam(200.0f);
-                chronosMono.setMixParam(0.5f);
-                chronosMono.setFeedbackParam(0.3f);
-                chronosMono.setLowCutParam(100.0f);
-                chronosMono.setHighCutParam(8000.0f);
-                chronosMono.setMono(true);
-                chronosMono.setBypassed(false);
-            },
-            [&](float* L, float* R, int n) {
-                juce::AudioBuffer<float> buf(2, n);
-                std::memcpy(buf.getWritePointer(0), L, sizeof(float) * n);
-                std::memcpy(buf.getWritePointer(1), R, sizeof(float) * n);
-                juce::dsp::AudioBlock<float> block(buf);
-                chronosMono.process(block, n);
-                std::memcpy(L, buf.getReadPointer(0), sizeof(float) * n);
-                std::memcpy(R, buf.getReadPointer(1), sizeof(float) * n);
-            });
-
         // ---- Naive scalar baseline (stereo) ----
         NaiveScalarDelay naive;
         runEngine("naive_scalar", "stereo",
@@ -297,22 +195,33 @@ int main()
         runEngine("juce_dsp", "stereo",
             [&] { juced.prepare(sampleRate, bs); },
             [&](float* L, float* R, int n) { juced.process(L, R, n); });
-    }
 
-    // Write CSV
-    const std::string csv = "tests/perf_harness/logs/delay_perf.csv";
-    if (FILE* dir = fopen("tests/perf_harness/logs/.keep", "w")) fclose(dir);
-    std::ofstream f(csv);
-    if (!f.is_open()) {
-        std::cerr << "Failed to open " << csv << " for writing.\n";
-        return 1;
-    }
-    f << "engine,block_size,mode,total_samples,ns_per_sample,realtime_factor\n";
-    for (const auto& r : results) {
-        f << r.engine << ',' << r.blockSize << ',' << r.mode << ','
-          << r.totalSamples << ',' << r.ns_per_sample << ',' << r.realtime_factor << '\n';
+        // ---- Chronos, processing buf directly ----
+        auto runChronos = [&](const std::string& mode, bool mono)
+        {
+            DelayEngine<float> chronos;
+            runEngine("chronos", mode,
+                [&] {
+                    juce::dsp::ProcessSpec s{}; s.sampleRate = sampleRate;
+                    s.maximumBlockSize = static_cast<uint32_t>(bs); s.numChannels = 2;
+                    chronos.prepare(s);
+                    chronos.setDelayTimeParam(200.0f);
+                    chronos.setMixParam(0.5f);
+                    chronos.setFeedbackParam(0.3f);
+                    if (!mono) chronos.setCrossfeedParam(0.3f);
+                    chronos.setLowCutParam(100.0f);
+                    chronos.setHighCutParam(8000.0f);
+                    chronos.setMono(mono);
+                    chronos.setBypassed(false);
+                },
+                [&](float*, float*, int n) {
+                    juce::dsp::AudioBlock<float> block(buf);
+                    chronos.process(block, n);
+                });
+        };
+        runChronos("stereo", false);
+        runChronos("mono", true);
     }
-    f.close();
-    std::cout << "Wrote " << csv << "\n";
-    return 0;
+
+    return suite.finish();
 }
@@ -0,0 +1,212 @@
+// Chronos DelayEngine operating-point matrix.
+//
+// perf_delay_engine_test sweeps only the block size, at 48 kHz, 200 ms and
+// feedback 0.3. How far behind the write head the read head sits (delay
+// time x sample rate against L1 / L2 / LLC), the channel count and how
+// much the feedback path has to do all move the cost per sample, so this
+// one times the engine over the cross product of
+//
+//   --rates     sample rates in Hz       (default 44100,48000,96000,192000)
+//   --delays    delay times in ms        (default 5,20,100,500,2000,5000)
+//   --feedbacks feedback amounts         (default 0,0.5,0.99)
+//   --modes     mono and / or stereo     (default mono,stereo)
+//   --sizes     host block sizes         (default 64,512)
+//
+// One bench.h case per point, one iteration per block, its speedup taken
+// against the first delay of the list at the same other settings (below
+// 1 where a longer delay costs more); every other argument (--reps,
+// --quick, --filter, --cpu, ...) goes to the Suite. The
+// parameters are set before prepare() so each point starts settled
+// instead of gliding there from the defaults.
+//
+// The engine's ring buffer holds DelayEngine<float>::maxDelaySamples()
+// whatever the rate, so a point whose delay x rate is longer (with the
+// defaults: 5000 ms at 96 kHz, 2000 ms and up at 192 kHz) would only time
+// a wrapped read distance; those are skipped and listed on stderr. Block
+// sizes past DelayEngine<float>::maxBlockSize() are dropped the same way.
+//
+// The tags carry the point: tests/perf_harness/logs/delay_matrix_results.csv is the heatmap input
+// for viz_delay_perf.py (delay_matrix.png) and the table it prints of the
+// points whose ns / sample falls off a cliff.
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <JuceHeader.h>
+#include "dsp/engine/delay/delay_engine.h"
+#include "bench.h"
+
+using namespace MarsDSP::DSP;
+
+namespace
+{
+    struct Matrix
+    {
+        std::vector<double> rates     = { 44100.0, 48000.0, 96000.0, 192000.0 };
+        std::vector<double> delays    = { 5.0, 20.0, 100.0, 500.0, 2000.0, 5000.0 };
+        std::vector<double> feedbacks = { 0.0, 0.5, 0.99 };
+        std::vector<std::string> modes = { "mono", "stereo" };
+        std::vector<double> sizes     = { 64.0, 512.0 };
+    };
+
+    std::vector<std::string> splitList(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::stringstream s(list);
+        for (std::string item; std::getline(s, item, ',');)
+            if (!item.empty())
+                items.push_back(item);
+        return items;
+    }
+
+    std::vector<double> numberList(const std::string& list)
+    {
+        std::vector<double> values;
+        for (const auto& item : splitList(list))
+            values.push_back(std::atof(item.c_str()));
+        return values;
+    }
+
+    // shortest round-trip text for a tag / case name: 0.5, 44100, 5000
+    std::string fmt(const double v)
+    {
+        std::ostringstream s;
+        s << v;
+        return s.str();
+    }
+
+    // takes the matrix options out of argv; the rest is left for the Suite
+    Matrix parseMatrix(int& argc, char** argv)
+    {
+        Matrix m;
+        int kept = 1;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            auto value = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+            if (arg == "--rates")          m.rates = numberList(value());
+            else if (arg == "--delays")    m.delays = numberList(value());
+            else if (arg == "--feedbacks") m.feedbacks = numberList(value());
+            else if (arg == "--modes")     m.modes = splitList(value());
+            else if (arg == "--sizes")     m.sizes = numberList(value());
+            else
+                argv[kept++] = argv[i];
+        }
+        argc = kept;
+
+        // the engine clamps anyway; clamping here keeps the tags honest
+        for (auto& d : m.delays)
+            d = paramRange(EngineParam::DelayTime).clamp(static_cast<float>(d));
+        for (auto& f : m.feedbacks)
+            f = paramRange(EngineParam::Feedback).clamp(static_cast<float>(f));
+        std::erase_if(m.rates, [](const double r) { return r < 8000.0; });
+        std::erase_if(m.sizes, [](const double s) {
+            if (s <= DelayEngine<float>::maxBlockSize())
+                return s < 1.0;
+            std::cerr << "ignoring block size " << s << ": DelayEngine<float> takes at most "
+                      << DelayEngine<float>::maxBlockSize() << " samples per process() call\n";
+            return true;
+        });
+        std::erase_if(m.modes, [](const std::string& mode) {
+            if (mode == "mono" || mode == "stereo")
+                return false;
+            std::cerr << "ignoring unknown mode " << mode << "\n";
+            return true;
+        });
+        return m;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const Matrix m = parseMatrix(argc, argv);
+
+    std::cout << "Chronos DelayEngine operating-point matrix: "
+              << m.rates.size() << " rates x " << m.delays.size() << " delays x " << m.feedbacks.size()
+              << " feedbacks x " << m.modes.size() << " modes x " << m.sizes.size() << " block sizes\n";
+    Bench::Suite suite("delay_matrix", argc, argv);
+
+    // one long stretch of noise every point reads the same windows of, so
+    // input generation stays out of the timed block
+    constexpr int kNoiseLength = 1 << 16;
+    static_assert(DelayEngine<float>::maxBlockSize() <= kNoiseLength, "every accepted block size fits the noise source");
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-0.25f, 0.25f);
+    std::vector<float> noiseL(kNoiseLength), noiseR(kNoiseLength);
+    for (int i = 0; i < kNoiseLength; ++i) { noiseL[i] = dist(rng); noiseR[i] = dist(rng); }
+
+    // sums the output so it can't be dead-code-eliminated
+    float sink = 0.0f;
+
+    // points the ring buffer can't hold, reported once
+    for (const double rate : m.rates)
+        for (const double delayMs : m.delays)
+            if (rate * delayMs * 0.001 > DelayEngine<float>::maxDelaySamples())
+                std::cerr << "skipping sr=" << fmt(rate) << " delay=" << fmt(delayMs) << "ms: "
+                          << fmt(rate * delayMs * 0.001) << " samples is past the " << DelayEngine<float>::maxDelaySamples()
+                          << "-sample ring buffer\n";
+
+    // a fresh engine per point, so each starts from a zeroed ring buffer;
+    // that buffer is a fixed 2 x 1 MB whatever the rate or delay, and only
+    // one is alive at a time, so earlier points don't crowd it out of cache
+    for (const double size : m.sizes)
+    {
+        const int bs = static_cast<int>(size);
+        juce::AudioBuffer<float> buf(2, bs);
+        int readPos = 0;
+
+        for (const double rate : m.rates)
+            for (const std::string& mode : m.modes)
+                for (const double delayMs : m.delays)
+                    for (const double feedback : m.feedbacks)
+                    {
+                        if (rate * delayMs * 0.001 > DelayEngine<float>::maxDelaySamples())
+                            continue;
+                        const bool mono = mode == "mono";
+                        DelayEngine<float> engine;
+                        engine.setDelayTimeParam(static_cast<float>(delayMs));
+                        engine.setMixParam(0.5f);
+                        engine.setFeedbackParam(static_cast<float>(feedback));
+                        engine.setCrossfeedParam(mono ? 0.0f : 0.3f);
+                        engine.setLowCutParam(100.0f);
+                        engine.setHighCutParam(8000.0f);
+                        engine.setMono(mono);
+                        engine.setBypassed(false);
+
+                        juce::dsp::ProcessSpec spec {};
+                        spec.sampleRate = rate;
+                        spec.maximumBlockSize = static_cast<uint32_t>(bs);
+                        spec.numChannels = 2;
+                        engine.prepare(spec);
+
+                        auto pointName = [&](const double d) {
+                            return "sr=" + fmt(rate) + " delay=" + fmt(d) + "ms fb=" + fmt(feedback)
+                                 + " " + mode + " bs=" + std::to_string(bs);
+                        };
+                        const std::string point = pointName(delayMs);
+                        const std::string tags = "engine=chronos;mode=" + mode + ";block_size=" + std::to_string(bs)
+                                               + ";sample_rate=" + fmt(rate) + ";delay_ms=" + fmt(delayMs)
+                                               + ";feedback=" + fmt(feedback);
+                        suite.run(point, bs, [&] {
+                            float* L = buf.getWritePointer(0);
+                            float* R = buf.getWritePointer(1);
+                            std::memcpy(L, noiseL.data() + readPos, sizeof(float) * static_cast<size_t>(bs));
+                            std::memcpy(R, noiseR.data() + readPos, sizeof(float) * static_cast<size_t>(bs));
+                            readPos = (readPos + bs) % (kNoiseLength - bs + 1);
+                            juce::dsp::AudioBlock<float> block(buf);
+                            engine.process(block, bs);
+                            sink += L[0] + R[bs - 1];
+                            Bench::doNotOptimize(sink);
+                        }, { .relativeTo = pointName(m.delays.front()), .tags = tags });
+                    }
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,463 @@
+// Chronos DelayEngine worst-case block latency under parameter automation.
+//
+// perf_delay_engine_test reports the median block with the knobs parked;
+// a host only cares whether the slowest block still fits its deadline.
+// This one times every block on its own (readCycles() around the whole
+// callback, setters included) for --blocks blocks per block size while
+// every parameter moves the way heavy automation moves it:
+//
+//   - each continuous EngineParam gets 0-3 ParamEvents per block at
+//     random offsets, so cutoff changes land in the middle of blocks,
+//     coefficient recomputation and all;
+//   - now and then the delay time jumps across its whole 5 ms - 5 s
+//     range instead of drifting (long lag glides, wrap copies at new
+//     head distances);
+//   - mono, Glide / Jump, the jump fade, the LFO shape, tempo sync and
+//     cross-ramps toggle at block rate like the plugin's switches;
+//   - a quarter of the blocks see no change at all, for comparison.
+//
+// Each block carries a bit per kind of change it saw, so the worst blocks
+// can be blamed on what happened in them. Written to tests/perf_harness/
+// logs/:
+//   delay_worstcase_summary.csv    per block size: min / median / mean /
+//                                  p99 / p99.9 / p99.99 / max in us, the
+//                                  deadline (block / sample rate), blocks
+//                                  over it and max / deadline
+//   delay_worstcase_histogram.csv  per block size, log-spaced bins of
+//                                  block time / deadline
+//   delay_worstcase_flags.csv      per block size and kind of change:
+//                                  p50 / p99.9 / max of the blocks with it
+//   delay_worstcase_worst.csv      the --top slowest blocks per size and
+//                                  what changed in them
+//
+// The maximum of a non-realtime process also contains preemption and
+// interrupts; run pinned (--cpu) on an idle core and compare the flags
+// table against the "none" row before blaming the engine.
+//
+//   --blocks N       timed blocks per block size (default 1000000)
+//   --warmup N       untimed blocks first (default 2000)
+//   --sizes a,b,..   block sizes (default 32,64,128,256,512,1024,2048), at most
+//                    DelayEngine<float>::maxBlockSize(); larger ones are dropped
+//   --sample-rate R  (default 48000)
+//   --top N          rows per size in the worst-blocks log (default 32)
+//   --seed S         automation RNG seed (default 1)
+//   --cpu N          pin to CPU N (default the current one)
+//   --max-load X     exit 1 when a block took more than X deadlines
+//   --quick          20000 blocks, 200 warm-up
+//
+// Pair with viz_delay_worstcase.py for the PNG charts.
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <array>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <JuceHeader.h>
+#include "dsp/engine/delay/delay_engine.h"
+#include "utils/helpers/cycle_counter.h"
+#include "bench.h"
+
+using namespace MarsDSP::DSP;
+
+namespace
+{
+    constexpr int kNumParams = static_cast<int>(EngineParam::Count);
+
+    // one bit per EngineParam that had an event, then the block-rate switches
+    enum Flag : uint32_t
+    {
+        kDelayJump  = 1u << (kNumParams + 0),     // DelayTime event across the full range
+        kMonoToggle = 1u << (kNumParams + 1),
+        kModeSwitch = 1u << (kNumParams + 2),     // Glide <-> Jump
+        kFadeChange = 1u << (kNumParams + 3),     // jump fade length
+        kShapeSwap  = 1u << (kNumParams + 4),
+        kSyncToggle = 1u << (kNumParams + 5),
+        kCrossRamp  = 1u << (kNumParams + 6)
+    };
+    constexpr int kNumFlags = kNumParams + 7;
+
+    constexpr std::array<const char*, kNumFlags> kFlagNames
+    {
+        "delay_time", "mix", "feedback", "low_cut", "high_cut", "crossfeed",
+        "mod_rate", "mod_depth", "mod_feedback",
+        "delay_jump", "mono_toggle", "mode_switch", "fade_change", "shape_swap", "sync_toggle", "cross_ramp"
+    };
+
+    std::string flagList(const uint32_t flags)
+    {
+        std::string s;
+        for (int f = 0; f < kNumFlags; ++f)
+            if (flags & (1u << f))
+                s += (s.empty() ? "" : "|") + std::string(kFlagNames[static_cast<size_t>(f)]);
+        return s.empty() ? "none" : s;
+    }
+
+    struct Options
+    {
+        int    blocks = 1000000;
+        int    warmup = 2000;
+        std::vector<int> sizes = { 32, 64, 128, 256, 512, 1024, 2048 };
+        double sampleRate = 48000.0;
+        int    top = 32;
+        unsigned seed = 1;
+        int    cpu = -1;
+        double maxLoad = 0.0;
+    };
+
+    Options parseOptions(const int argc, char** argv)
+    {
+        Options o;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            auto value = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+            if (arg == "--blocks")           o.blocks = std::max(1, std::atoi(value().c_str()));
+            else if (arg == "--warmup")      o.warmup = std::max(0, std::atoi(value().c_str()));
+            else if (arg == "--sample-rate") o.sampleRate = std::max(8000.0, std::atof(value().c_str()));
+            else if (arg == "--top")         o.top = std::max(1, std::atoi(value().c_str()));
+            else if (arg == "--seed")        o.seed = static_cast<unsigned>(std::strtoul(value().c_str(), nullptr, 10));
+            else if (arg == "--cpu")         o.cpu = std::atoi(value().c_str());
+            else if (arg == "--max-load")    o.maxLoad = std::atof(value().c_str());
+            else if (arg == "--quick")       { o.blocks = 20000; o.warmup = 200; }
+            else if (arg == "--sizes")
+            {
+                o.sizes.clear();
+                std::stringstream list(value());
+                for (std::string item; std::getline(list, item, ',');)
+                {
+                    const int bs = std::atoi(item.c_str());
+                    if (bs > DelayEngine<float>::maxBlockSize())
+                        std::cerr << "ignoring block size " << bs << ": DelayEngine<float> takes at most "
+                                  << DelayEngine<float>::maxBlockSize() << " samples per process() call\n";
+                    else if (bs > 0)
+                        o.sizes.push_back(bs);
+                }
+            }
+            else
+                std::cerr << "ignoring unknown argument " << arg << "\n";
+        }
+        return o;
+    }
+
+    // Draws one block's automation: sorted events for the continuous
+    // parameters plus the block-rate switches, and the flags describing them.
+    class Automation
+    {
+    public:
+        static constexpr int kMaxEventsPerParam = 3;
+        static constexpr int kMaxEvents = kNumParams * kMaxEventsPerParam;
+
+        explicit Automation(const unsigned seed) : rng(seed) {}
+
+        struct Block
+        {
+            std::array<ParamEvent, kMaxEvents> events;
+            int      numEvents = 0;
+            uint32_t flags = 0;
+            bool     toggleMono = false;
+            bool     toggleMode = false;
+            bool     toggleSync = false;
+            float    jumpFadeMs = -1.0f;        // < 0: unchanged
+            int      shape = -1;                // < 0: unchanged
+            float    crossRampMs = -1.0f;       // < 0: none
+        };
+
+        void next(Block& b, const int blockSize)
+        {
+            b = Block {};
+            // a quarter of the blocks stay untouched: the "none" floor
+            if (chance(0.25))
+                return;
+            for (int p = 0; p < kNumParams; ++p)
+            {
+                const int count = static_cast<int>(rng() % (kMaxEventsPerParam + 1));
+                for (int e = 0; e < count; ++e)
+                {
+                    const auto param = static_cast<EngineParam>(p);
+                    const float value = drawValue(param, b.flags);
+                    b.events[static_cast<size_t>(b.numEvents++)] = { static_cast<int>(rng() % static_cast<unsigned>(blockSize)), param, value };
+                    b.flags |= 1u << p;
+                }
+            }
+            std::sort(b.events.begin(), b.events.begin() + b.numEvents,
+                      [](const ParamEvent& x, const ParamEvent& y) { return x.sampleOffset < y.sampleOffset; });
+
+            // block-rate switches: rare enough that the engine settles in
+            // between, frequent enough to hit every combination many times
+            if (chance(1.0 / 64.0))  { b.toggleMono = true; b.flags |= kMonoToggle; }
+            if (chance(1.0 / 64.0))  { b.toggleMode = true; b.flags |= kModeSwitch; }
+            if (chance(1.0 / 128.0)) { b.jumpFadeMs = logUniform(kJumpFadeRange.min, kJumpFadeRange.max); b.flags |= kFadeChange; }
+            if (chance(1.0 / 128.0)) { b.shape = static_cast<int>(rng() % 3); b.flags |= kShapeSwap; }
+            if (chance(1.0 / 256.0)) { b.toggleSync = true; b.flags |= kSyncToggle; }
+            if (chance(1.0 / 512.0)) { b.crossRampMs = logUniform(5.0f, 500.0f); b.flags |= kCrossRamp; }
+        }
+
+    private:
+        bool chance(const double p) { return std::uniform_real_distribution<double>(0.0, 1.0)(rng) < p; }
+
+        float logUniform(const float lo, const float hi)
+        {
+            return lo * std::pow(hi / lo, std::uniform_real_distribution<float>(0.0f, 1.0f)(rng));
+        }
+
+        // frequency- and time-like parameters are log-distributed, the rest
+        // linear; a delay-time event wanders near the current time unless it
+        // is a jump across the whole range
+        float drawValue(const EngineParam param, uint32_t& flags)
+        {
+            const ParamRange r = paramRange(param);
+            switch (param)
+            {
+                case EngineParam::DelayTime:
+                    if (chance(1.0 / 32.0))
+                    {
+                        flags |= kDelayJump;
+                        delayMs = logUniform(r.min, r.max);
+                    }
+                    else
+                    {
+                        delayMs = r.clamp(delayMs * std::exp2(std::uniform_real_distribution<float>(-0.05f, 0.05f)(rng)));
+                    }
+                    return delayMs;
+                case EngineParam::LowCut:
+                case EngineParam::HighCut:
+                case EngineParam::ModRate:
+                    return logUniform(r.min, r.max);
+                default:
+                    return std::uniform_real_distribution<float>(r.min, r.max)(rng);
+            }
+        }
+
+        std::mt19937 rng;
+        float delayMs = 200.0f;
+    };
+
+    // nearest-rank quantile of an ascending vector
+    double quantile(const std::vector<double>& sorted, const double q)
+    {
+        if (sorted.empty())
+            return std::numeric_limits<double>::quiet_NaN();
+        const auto rank = static_cast<size_t>(std::ceil(q * static_cast<double>(sorted.size())));
+        return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+    }
+
+    // histogram bins of block time / deadline: kBinsPerDecade per decade
+    // from kLoadMin to kLoadMax, the first and last catching everything
+    // beyond
+    constexpr double kLoadMin = 1.0e-4;
+    constexpr double kLoadMax = 10.0;
+    constexpr int    kBinsPerDecade = 20;
+    constexpr int    kNumBins = 5 * kBinsPerDecade;
+
+    double binEdge(const int i) { return kLoadMin * std::pow(10.0, static_cast<double>(i) / kBinsPerDecade); }
+
+    int binOf(const double load)
+    {
+        if (!(load > kLoadMin))
+            return 0;
+        const int i = static_cast<int>(std::floor(std::log10(load / kLoadMin) * kBinsPerDecade));
+        return std::clamp(i, 0, kNumBins - 1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const Options opt = parseOptions(argc, argv);
+    const int pinned = Bench::pinThread(opt.cpu);
+    const double ticksPerNs = MarsDSP::cyclesPerSecond() * 1.0e-9;
+
+    std::cout << "Chronos DelayEngine worst-case block latency\n"
+              << opt.blocks << " blocks per size after " << opt.warmup << " warm-up, "
+              << opt.sampleRate << " Hz, every parameter automated, "
+              << (pinned >= 0 ? "pinned to CPU " + std::to_string(pinned) : std::string("not pinned")) << "\n"
+              << "timer: " << ticksPerNs << " ticks / ns" << std::endl;
+
+    std::error_code ec;
+    const std::filesystem::path logs = "tests/perf_harness/logs";
+    std::filesystem::create_directories(logs, ec);
+    std::ofstream summary(logs / "delay_worstcase_summary.csv");
+    std::ofstream histogram(logs / "delay_worstcase_histogram.csv");
+    std::ofstream flagsCsv(logs / "delay_worstcase_flags.csv");
+    std::ofstream worst(logs / "delay_worstcase_worst.csv");
+    if (!summary || !histogram || !flagsCsv || !worst)
+    {
+        std::cerr << "Failed to open the logs in " << logs << std::endl;
+        return 1;
+    }
+    summary << "block_size,sample_rate,blocks,budget_us,min_us,median_us,mean_us,p99_us,p999_us,p9999_us,max_us,"
+               "overruns,max_load,p999_load\n";
+    histogram << "block_size,bin_lo_load,bin_hi_load,bin_lo_us,bin_hi_us,count\n";
+    flagsCsv << "block_size,flag,blocks,median_us,p999_us,max_us\n";
+    worst << "block_size,rank,block,time_us,load,events,flags\n";
+
+    // one long stretch of noise the blocks read windows of, outside the timing
+    constexpr int kNoiseLength = 1 << 16;
+    static_assert(DelayEngine<float>::maxBlockSize() <= kNoiseLength, "every accepted block size fits the noise source");
+    std::mt19937 noiseRng(42);
+    std::uniform_real_distribution<float> dist(-0.25f, 0.25f);
+    std::vector<float> noiseL(kNoiseLength), noiseR(kNoiseLength);
+    for (int i = 0; i < kNoiseLength; ++i) { noiseL[i] = dist(noiseRng); noiseR[i] = dist(noiseRng); }
+
+    std::cout << "\n" << std::left << std::setw(7) << "block" << std::right
+              << std::setw(11) << "budget us" << std::setw(10) << "median" << std::setw(10) << "p99"
+              << std::setw(10) << "p99.9" << std::setw(10) << "p99.99" << std::setw(10) << "max"
+              << std::setw(10) << "max/bud" << std::setw(10) << "overruns" << "\n";
+
+    bool deadlineMissed = false;
+    float sink = 0.0f;
+
+    for (const int bs : opt.sizes)
+    {
+        juce::AudioBuffer<float> buf(2, bs);
+        DelayEngine<float> engine;
+        juce::dsp::ProcessSpec spec {};
+        spec.sampleRate = opt.sampleRate;
+        spec.maximumBlockSize = static_cast<uint32_t>(bs);
+        spec.numChannels = 2;
+        engine.prepare(spec);
+        engine.setDelayTimeParam(200.0f);
+        engine.setMixParam(0.5f);
+        engine.setFeedbackParam(0.5f);
+        engine.setBypassed(false);
+
+        Automation automation(opt.seed);
+        Automation::Block a;
+        bool mono = false;
+        bool sync = false;
+        int readPos = 0;
+        double ppq = 0.0;
+        const double ppqPerBlock = 120.0 / 60.0 * bs / opt.sampleRate;
+
+        const int total = opt.warmup + opt.blocks;
+        std::vector<uint64_t> ticks(static_cast<size_t>(opt.blocks));
+        std::vector<uint32_t> flags(static_cast<size_t>(opt.blocks));
+        std::vector<uint8_t>  eventCounts(static_cast<size_t>(opt.blocks));
+
+        for (int n = 0; n < total; ++n)
+        {
+            automation.next(a, bs);
+            float* L = buf.getWritePointer(0);
+            float* R = buf.getWritePointer(1);
+            std::memcpy(L, noiseL.data() + readPos, sizeof(float) * static_cast<size_t>(bs));
+            std::memcpy(R, noiseR.data() + readPos, sizeof(float) * static_cast<size_t>(bs));
+            readPos = (readPos + bs) % (kNoiseLength - bs + 1);
+
+            // the callback as the plugin runs it: switches, transport, then
+            // the block with its events
+            const uint64_t t0 = MarsDSP::readCycles();
+            {
+                juce::ScopedNoDenormals noDenormals;
+                if (a.toggleMono)         engine.setMono(mono = !mono);
+                if (a.toggleMode)         engine.setDelayTimeMode(engine.getDelayTimeMode() == DelayTimeMode::Glide
+                                                                      ? DelayTimeMode::Jump : DelayTimeMode::Glide);
+                if (a.jumpFadeMs >= 0.0f) engine.setJumpFadeMs(a.jumpFadeMs);
+                if (a.shape >= 0)         engine.setModShape(static_cast<LfoShape>(a.shape));
+                if (a.toggleSync)         engine.setModSync(sync = !sync, MarsDSP::SyncDivision::Eighth);
+                if (a.crossRampMs >= 0.0f) engine.startCrossRamp(a.crossRampMs);
+                engine.setHostTempo(120.0, ppq, true);
+                juce::dsp::AudioBlock<float> block(buf);
+                engine.process(block, bs, a.events.data(), a.numEvents);
+            }
+            const uint64_t t1 = MarsDSP::readCycles();
+            ppq += ppqPerBlock;
+            sink += L[0] + R[bs - 1];
+            Bench::doNotOptimize(sink);
+
+            if (n >= opt.warmup)
+            {
+                const auto i = static_cast<size_t>(n - opt.warmup);
+                ticks[i]       = t1 - t0;
+                flags[i]       = a.flags;
+                eventCounts[i] = static_cast<uint8_t>(a.numEvents);
+            }
+        }
+
+        // ---- statistics ----
+        const double budgetNs = 1.0e9 * bs / opt.sampleRate;
+        std::vector<double> ns(ticks.size());
+        for (size_t i = 0; i < ticks.size(); ++i)
+            ns[i] = static_cast<double>(ticks[i]) / ticksPerNs;
+
+        std::vector<double> sorted = ns;
+        std::sort(sorted.begin(), sorted.end());
+        const double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size());
+        const auto overruns = std::count_if(sorted.begin(), sorted.end(), [&](const double t) { return t > budgetNs; });
+        const double maxLoad = sorted.back() / budgetNs;
+        if (opt.maxLoad > 0.0 && maxLoad > opt.maxLoad)
+            deadlineMissed = true;
+
+        summary << bs << "," << opt.sampleRate << "," << sorted.size() << "," << budgetNs * 1.0e-3 << ","
+                << sorted.front() * 1.0e-3 << "," << quantile(sorted, 0.5) * 1.0e-3 << "," << mean * 1.0e-3 << ","
+                << quantile(sorted, 0.99) * 1.0e-3 << "," << quantile(sorted, 0.999) * 1.0e-3 << ","
+                << quantile(sorted, 0.9999) * 1.0e-3 << "," << sorted.back() * 1.0e-3 << ","
+                << overruns << "," << maxLoad << "," << quantile(sorted, 0.999) / budgetNs << "\n";
+
+        std::cout << std::left << std::setw(7) << bs << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(11) << budgetNs * 1.0e-3 << std::setw(10) << quantile(sorted, 0.5) * 1.0e-3
+                  << std::setw(10) << quantile(sorted, 0.99) * 1.0e-3 << std::setw(10) << quantile(sorted, 0.999) * 1.0e-3
+                  << std::setw(10) << quantile(sorted, 0.9999) * 1.0e-3 << std::setw(10) << sorted.back() * 1.0e-3
+                  << std::setprecision(3) << std::setw(10) << maxLoad << std::setw(10) << overruns
+                  << std::defaultfloat << std::setprecision(6) << std::endl;
+
+        std::array<uint64_t, kNumBins> bins {};
+        for (const double t : ns)
+            ++bins[static_cast<size_t>(binOf(t / budgetNs))];
+        for (int i = 0; i < kNumBins; ++i)
+            histogram << bs << "," << binEdge(i) << "," << binEdge(i + 1) << ","
+                      << binEdge(i) * budgetNs * 1.0e-3 << "," << binEdge(i + 1) * budgetNs * 1.0e-3 << ","
+                      << bins[static_cast<size_t>(i)] << "\n";
+
+        // blocks grouped by what changed in them; "none" is the floor the
+        // others are read against
+        auto flagRow = [&](const std::string& label, auto&& has)
+        {
+            std::vector<double> subset;
+            for (size_t i = 0; i < ns.size(); ++i)
+                if (has(flags[i]))
+                    subset.push_back(ns[i]);
+            std::sort(subset.begin(), subset.end());
+            flagsCsv << bs << "," << label << "," << subset.size();
+            if (subset.empty())
+                flagsCsv << ",,,\n";
+            else
+                flagsCsv << "," << quantile(subset, 0.5) * 1.0e-3 << "," << quantile(subset, 0.999) * 1.0e-3
+                         << "," << subset.back() * 1.0e-3 << "\n";
+        };
+        flagRow("none", [](const uint32_t f) { return f == 0; });
+        flagRow("all", [](uint32_t) { return true; });
+        for (int f = 0; f < kNumFlags; ++f)
+            flagRow(kFlagNames[static_cast<size_t>(f)], [f](const uint32_t x) { return (x & (1u << f)) != 0; });
+
+        std::vector<size_t> order(ns.size());
+        std::iota(order.begin(), order.end(), size_t { 0 });
+        const auto top = std::min(order.size(), static_cast<size_t>(opt.top));
+        std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(top), order.end(),
+                          [&](const size_t x, const size_t y) { return ns[x] > ns[y]; });
+        for (size_t r = 0; r < top; ++r)
+        {
+            const size_t i = order[r];
+            worst << bs << "," << r + 1 << "," << i << "," << ns[i] * 1.0e-3 << "," << ns[i] / budgetNs << ","
+                  << static_cast<int>(eventCounts[i]) << "," << flagList(flags[i]) << "\n";
+        }
+    }
+
+    std::cout << "\nLogs written to " << logs.string() << "/delay_worstcase_*.csv" << std::endl;
+    if (deadlineMissed)
+    {
+        std::cout << "FAILED: a block took more than " << opt.maxLoad << " of its deadline" << std::endl;
+        return 1;
+    }
+    return 0;
+}
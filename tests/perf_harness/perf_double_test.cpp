@@ -0,0 +1,125 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "dsp/math/fastermath_double.h"
+#include "bench.h"
+
+int main(int argc, char** argv)
+{
+    const int blockSize = 512;
+
+    // angles over a few turns, tan kept off its poles, tanh through both ranges
+    std::vector<double> angleIn(blockSize), tanIn(blockSize), tanhIn(blockSize);
+    for (int i = 0; i < blockSize; ++i)
+    {
+        const double t = static_cast<double>(i) / blockSize;
+        angleIn[i] = -20.0 + 40.0 * t;
+        tanIn[i]   = -1.5 + 3.0 * t;
+        tanhIn[i]  = -5.0 + 10.0 * t;
+    }
+
+    std::vector<double> output(blockSize), output2(blockSize);
+
+    // one block through fn, a sample, an SSE2 pair or an AVX quad at a time
+    auto scalar = [&](const std::vector<double>& in, auto fn)
+    {
+        return [&in, &output, fn] {
+            for (int i = 0; i < blockSize; ++i)
+                output[i] = fn(in[i]);
+            Bench::doNotOptimize(output);
+        };
+    };
+    auto simd = [&](const std::vector<double>& in, auto fn)
+    {
+        return [&in, &output, fn] {
+            for (int i = 0; i < blockSize; i += 2)
+                SIMD_MM(storeu_pd)(&output[i], fn(SIMD_MM(loadu_pd)(&in[i])));
+            Bench::doNotOptimize(output);
+        };
+    };
+#ifdef MARSCORE_SIMD_AVX
+    auto avx = [&](const std::vector<double>& in, auto fn)
+    {
+        return [&in, &output, fn] {
+            for (int i = 0; i < blockSize; i += 4)
+                SIMD_MM256(storeu_pd)(&output[i], fn(SIMD_MM256(loadu_pd)(&in[i])));
+            Bench::doNotOptimize(output);
+        };
+    };
+#endif
+
+    std::cout << "Benchmarking double-precision implementations (Block Size: " << blockSize << ")..." << std::endl;
+#ifndef MARSCORE_SIMD_AVX
+    std::cout << "  (AVX path not compiled in, build with -mavx to time it)" << std::endl;
+#endif
+    Bench::Suite suite("perf_double", argc, argv);
+
+    // speedup is relative to the libm case of the same function
+    suite.run("std::sin", blockSize, scalar(angleIn, [](double x) { return std::sin(x); }),
+              { .relativeTo = "std::sin", .tags = "group=sin" });
+    suite.run("fasterSin (Scalar)", blockSize, scalar(angleIn, [](double x) { return MarsDSP::fasterSin(x); }),
+              { .relativeTo = "std::sin", .tags = "group=sin" });
+    suite.run("fasterSin (SSE2)", blockSize, simd(angleIn, [](SIMD_M128D x) { return MarsDSP::fasterSin(x); }),
+              { .relativeTo = "std::sin", .tags = "group=sin" });
+#ifdef MARSCORE_SIMD_AVX
+    suite.run("fasterSin (AVX)", blockSize, avx(angleIn, [](SIMD_M256D x) { return MarsDSP::fasterSin(x); }),
+              { .relativeTo = "std::sin", .tags = "group=sin" });
+#endif
+
+    // both outputs: libm sin + cos against one fused call
+    suite.run("std::sin+cos", blockSize, [&] {
+        for (int i = 0; i < blockSize; ++i)
+        {
+            output[i]  = std::sin(angleIn[i]);
+            output2[i] = std::cos(angleIn[i]);
+        }
+        Bench::doNotOptimize(output);
+        Bench::doNotOptimize(output2);
+    }, { .relativeTo = "std::sin+cos", .tags = "group=sincos" });
+    suite.run("fasterSinCos (SSE2)", blockSize, [&] {
+        for (int i = 0; i < blockSize; i += 2)
+        {
+            SIMD_M128D vs, vc;
+            MarsDSP::fasterSinCos(SIMD_MM(loadu_pd)(&angleIn[i]), vs, vc);
+            SIMD_MM(storeu_pd)(&output[i], vs);
+            SIMD_MM(storeu_pd)(&output2[i], vc);
+        }
+        Bench::doNotOptimize(output);
+        Bench::doNotOptimize(output2);
+    }, { .relativeTo = "std::sin+cos", .tags = "group=sincos" });
+
+    suite.run("std::tan", blockSize, scalar(tanIn, [](double x) { return std::tan(x); }),
+              { .relativeTo = "std::tan", .tags = "group=tan" });
+    suite.run("fasterTan (Scalar)", blockSize, scalar(tanIn, [](double x) { return MarsDSP::fasterTan(x); }),
+              { .relativeTo = "std::tan", .tags = "group=tan" });
+    suite.run("fasterTan (SSE2)", blockSize, simd(tanIn, [](SIMD_M128D x) { return MarsDSP::fasterTan(x); }),
+              { .relativeTo = "std::tan", .tags = "group=tan" });
+#ifdef MARSCORE_SIMD_AVX
+    suite.run("fasterTan (AVX)", blockSize, avx(tanIn, [](SIMD_M256D x) { return MarsDSP::fasterTan(x); }),
+              { .relativeTo = "std::tan", .tags = "group=tan" });
+#endif
+
+    suite.run("std::tanh", blockSize, scalar(tanhIn, [](double x) { return std::tanh(x); }),
+              { .relativeTo = "std::tanh", .tags = "group=tanh" });
+    suite.run("fasterTanh (Scalar)", blockSize, scalar(tanhIn, [](double x) { return MarsDSP::fasterTanh(x); }),
+              { .relativeTo = "std::tanh", .tags = "group=tanh" });
+    suite.run("fasterTanh (SSE2)", blockSize, simd(tanhIn, [](SIMD_M128D x) { return MarsDSP::fasterTanh(x); }),
+              { .relativeTo = "std::tanh", .tags = "group=tanh" });
+#ifdef MARSCORE_SIMD_AVX
+    suite.run("fasterTanh (AVX)", blockSize, avx(tanhIn, [](SIMD_M256D x) { return MarsDSP::fasterTanh(x); }),
+              { .relativeTo = "std::tanh", .tags = "group=tanh" });
+#endif
+
+    suite.run("std::remainder", blockSize, scalar(angleIn, [](double x) { return std::remainder(x, 2.0 * M_PI); }),
+              { .relativeTo = "std::remainder", .tags = "group=wrap" });
+    suite.run("boundToPi (Scalar)", blockSize, scalar(angleIn, [](double x) { return MarsDSP::boundToPi(x); }),
+              { .relativeTo = "std::remainder", .tags = "group=wrap" });
+    suite.run("boundToPi (SSE2)", blockSize, simd(angleIn, [](SIMD_M128D x) { return MarsDSP::boundToPiSIMD(x); }),
+              { .relativeTo = "std::remainder", .tags = "group=wrap" });
+#ifdef MARSCORE_SIMD_AVX
+    suite.run("boundToPi (AVX)", blockSize, avx(angleIn, [](SIMD_M256D x) { return MarsDSP::boundToPiSIMD(x); }),
+              { .relativeTo = "std::remainder", .tags = "group=wrap" });
+#endif
+
+    return suite.finish();
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "dsp/math/fastermath.h"
+#include "bench.h"
+
+int main(int argc, char** argv)
+{
+    const int blockSize = 512;
+
+    // control-rate style inputs: exponents, gains near 1 and dB values
+    std::vector<float> expIn(blockSize), gainIn(blockSize), dbIn(blockSize);
+    for (int i = 0; i < blockSize; ++i)
+    {
+        const float t = static_cast<float>(i) / blockSize;
+        expIn[i]  = -20.0f + 40.0f * t;
+        gainIn[i] = 1.0e-4f + 2.0f * t;
+        dbIn[i]   = -96.0f + 108.0f * t;
+    }
+
+    std::vector<float> output(blockSize);
+
+    // one block through fn, a sample or a quad at a time
+    auto scalar = [&](const std::vector<float>& in, auto fn)
+    {
+        return [&in, &output, fn] {
+            for (int i = 0; i < blockSize; ++i)
+                output[i] = fn(in[i]);
+            Bench::doNotOptimize(output);
+        };
+    };
+    auto simd = [&](const std::vector<float>& in, auto fn)
+    {
+        return [&in, &output, fn] {
+            for (int i = 0; i < blockSize; i += 4)
+                SIMD_MM(storeu_ps)(&output[i], fn(SIMD_MM(loadu_ps)(&in[i])));
+            Bench::doNotOptimize(output);
+        };
+    };
+
+    std::cout << "Benchmarking exp / log / pow / dB implementations (Block Size: " << blockSize << ")..." << std::endl;
+    Bench::Suite suite("perf_explog", argc, argv);
+
+    // speedup is relative to the libm case of the same function
+    suite.run("std::exp2", blockSize, scalar(expIn, [](float x) { return std::exp2(x); }),
+              { .relativeTo = "std::exp2", .tags = "group=exp2" });
+    suite.run("fasterExp2 (Scalar)", blockSize, scalar(expIn, [](float x) { return MarsDSP::fasterExp2(x); }),
+              { .relativeTo = "std::exp2", .tags = "group=exp2" });
+    suite.run("fasterExp2 (SIMD)", blockSize, simd(expIn, [](SIMD_M128 x) { return MarsDSP::fasterExp2(x); }),
+              { .relativeTo = "std::exp2", .tags = "group=exp2" });
+
+    suite.run("std::log2", blockSize, scalar(gainIn, [](float x) { return std::log2(x); }),
+              { .relativeTo = "std::log2", .tags = "group=log2" });
+    suite.run("fasterLog2 (Scalar)", blockSize, scalar(gainIn, [](float x) { return MarsDSP::fasterLog2(x); }),
+              { .relativeTo = "std::log2", .tags = "group=log2" });
+    suite.run("fasterLog2 (SIMD)", blockSize, simd(gainIn, [](SIMD_M128 x) { return MarsDSP::fasterLog2(x); }),
+              { .relativeTo = "std::log2", .tags = "group=log2" });
+
+    suite.run("std::pow", blockSize, scalar(gainIn, [](float x) { return std::pow(x, 0.37f); }),
+              { .relativeTo = "std::pow", .tags = "group=pow" });
+    suite.run("fasterPow (SIMD)", blockSize, simd(gainIn, [](SIMD_M128 x) { return MarsDSP::fasterPow(x, SIMD_MM(set1_ps)(0.37f)); }),
+              { .relativeTo = "std::pow", .tags = "group=pow" });
+
+    suite.run("std::pow dB->gain", blockSize, scalar(dbIn, [](float x) { return std::pow(10.0f, x * 0.05f); }),
+              { .relativeTo = "std::pow dB->gain", .tags = "group=db" });
+    suite.run("dbToGain (SIMD)", blockSize, simd(dbIn, [](SIMD_M128 x) { return MarsDSP::dbToGain(x); }),
+              { .relativeTo = "std::pow dB->gain", .tags = "group=db" });
+
+    return suite.finish();
+}
@@ -0,0 +1,90 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+#include "dsp/engine/modulation/lfo_bank.h"
+#include "bench.h"
+
+int main(int argc, char** argv)
+{
+    const int blockSize = 512;
+    constexpr int numLfos = 8;
+    constexpr float fs = 48000.0f;
+    const float rates[numLfos] = { 0.05f, 0.3f, 1.0f, 2.5f, 7.0f, 13.0f, 55.0f, 440.0f };
+
+    // every variant writes all LFOs for every sample of the block
+    std::vector<float> output(static_cast<size_t>(blockSize * numLfos));
+
+    std::cout << "Benchmarking " << numLfos << " LFOs (Block Size: " << blockSize << ")..." << std::endl;
+    Bench::Suite suite("perf_lfo_bank", argc, argv);
+
+    // speedup is relative to the libm case
+    constexpr auto baseline = "std::sin (float phase)";
+
+    // 1. scalar float-phase LFO with libm sin, the usual textbook loop
+    float phase[numLfos] = {};
+    suite.run(baseline, blockSize, [&] {
+        for (int n = 0; n < blockSize; ++n)
+            for (int i = 0; i < numLfos; ++i)
+            {
+                phase[i] += rates[i] / fs;
+                if (phase[i] >= 1.0f) phase[i] -= 1.0f;
+                output[static_cast<size_t>(n * numLfos + i)] = std::sin(2.0f * std::numbers::pi_v<float> * phase[i]);
+            }
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = baseline });
+
+    // 2. scalar radian phase through boundToPi + fasterSin
+    float radians[numLfos] = {};
+    suite.run("boundToPi+fasterSin", blockSize, [&] {
+        for (int n = 0; n < blockSize; ++n)
+            for (int i = 0; i < numLfos; ++i)
+            {
+                radians[i] = MarsDSP::boundToPi(radians[i] + 2.0f * std::numbers::pi_v<float> * rates[i] / fs);
+                output[static_cast<size_t>(n * numLfos + i)] = MarsDSP::fasterSin(radians[i]);
+            }
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = baseline });
+
+    // 3. LfoBank, stepped per sample
+    auto makeBank = [&](MarsDSP::DSP::LfoShape shape)
+    {
+        MarsDSP::DSP::LfoBank<numLfos> bank;
+        bank.prepare(fs);
+        for (int i = 0; i < numLfos; ++i)
+        {
+            bank.setRateHz(i, rates[i]);
+            bank.setShape(i, shape);
+        }
+        return bank;
+    };
+
+    const std::pair<MarsDSP::DSP::LfoShape, const char*> shapes[] = {
+        { MarsDSP::DSP::LfoShape::Sine,         "LfoBank sine" },
+        { MarsDSP::DSP::LfoShape::Triangle,     "LfoBank triangle" },
+        { MarsDSP::DSP::LfoShape::SmoothRandom, "LfoBank random" },
+    };
+    for (const auto& [shape, name] : shapes)
+    {
+        auto bank = makeBank(shape);
+        suite.run(name, blockSize, [&] {
+            for (int n = 0; n < blockSize; ++n)
+            {
+                bank.process();
+                std::copy(bank.values(), bank.values() + numLfos, output.begin() + n * numLfos);
+            }
+            Bench::doNotOptimize(output);
+        }, { .relativeTo = baseline });
+    }
+
+    // 4. LfoBank at block rate, the engine's use: one advance() per block
+    auto bank = makeBank(MarsDSP::DSP::LfoShape::Sine);
+    suite.run("LfoBank sine advance()", blockSize, [&] {
+        bank.advance(blockSize);
+        std::copy(bank.values(), bank.values() + numLfos, output.begin());
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = baseline });
+
+    return suite.finish();
+}
@@ -1,20 +1,13 @@
 #include <iostream>
-#include <fstream>
-#include <chrono>
 #include <vector>
 #include <cmath>
 #include <numbers>
-#include <iomanip>
-#include <filesystem>
 #include "dsp/math/fastermath.h"
+#include "bench.h"
 
-int main()
+int main(int argc, char** argv)
 {
     const int blockSize = 512;
-    const int iterations = 1000000;
-
-    // Ensure the logs directory exists
-    std::filesystem::create_directories("tests/perf_harness/logs");
 
     std::vector<float> input(blockSize);
     for (int i = 0; i < blockSize; ++i)
@@ -23,70 +16,72 @@ int main()
     }
 
     std::vector<float> output(blockSize);
+    std::vector<float> outputCos(blockSize);
 
-    std::cout << "Benchmarking sine implementations (Block Size: " << blockSize << ", Iterations: " << iterations << ")..." << std::endl;
+    std::cout << "Benchmarking sine implementations (Block Size: " << blockSize << ")..." << std::endl;
+    Bench::Suite suite("perf_sin", argc, argv);
 
-    // 1. Benchmark std::sin (Scalar Baseline)
-    auto start = std::chrono::high_resolution_clock::now();
-    for (int it = 0; it < iterations; ++it)
-    {
+    // 1. std::sin (Scalar Baseline)
+    suite.run("std::sin", blockSize, [&] {
         for (int i = 0; i < blockSize; ++i)
-        {
             output[i] = std::sin(input[i]);
-        }
-        // Use the output to prevent compiler optimization
-        if (output[0] > 100.0f) std::cout << "Never happens";
-    }
-    auto end = std::chrono::high_resolution_clock::now();
-    double timeStd = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = "std::sin" });
 
-    // 2. Benchmark Pade (Scalar)
-    start = std::chrono::high_resolution_clock::now();
-    for (int it = 0; it < iterations; ++it)
-    {
+    // 2. Pade (Scalar)
+    suite.run("Pade (Scalar)", blockSize, [&] {
         for (int i = 0; i < blockSize; ++i)
-        {
             output[i] = MarsDSP::padeSinApprox(input[i]);
-        }
-        if (output[0] > 100.0f) std::cout << "Never happens";
-    }
-    end = std::chrono::high_resolution_clock::now();
-    double timeScalar = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = "std::sin" });
 
-    // 3. Benchmark Pade (SIMD)
-    start = std::chrono::high_resolution_clock::now();
-    for (int it = 0; it < iterations; ++it)
-    {
+    // 3. Pade (SIMD)
+    suite.run("Pade (SIMD)", blockSize, [&] {
+        for (int i = 0; i < blockSize; i += 4)
+            SIMD_MM(storeu_ps)(&output[i], MarsDSP::fasterSin(SIMD_MM(loadu_ps)(&input[i])));
+        Bench::doNotOptimize(output);
+    }, { .relativeTo = "std::sin" });
+
+    // 4. separate Pade sin + cos (SIMD), the pre-fusion way to get both
+    suite.run("Pade sin+cos (SIMD)", blockSize, [&] {
         for (int i = 0; i < blockSize; i += 4)
         {
             SIMD_M128 vx = SIMD_MM(loadu_ps)(&input[i]);
-            SIMD_M128 vres = MarsDSP::fasterSin(vx);
-            SIMD_MM(storeu_ps)(&output[i], vres);
+            SIMD_MM(storeu_ps)(&output[i], MarsDSP::fasterSin(vx));
+            SIMD_MM(storeu_ps)(&outputCos[i], MarsDSP::fasterCos(vx));
         }
-        if (output[0] > 100.0f) std::cout << "Never happens";
-    }
-    end = std::chrono::high_resolution_clock::now();
-    double timeSimd = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+        Bench::doNotOptimize(output);
+        Bench::doNotOptimize(outputCos);
+    }, { .relativeTo = "std::sin" });
 
-    // Output to CSV
-    std::ofstream csv("tests/perf_harness/logs/perf_sin_results.csv");
-    if (!csv.is_open())
-    {
-        std::cerr << "Failed to open tests/perf_harness/logs/perf_sin_results.csv" << std::endl;
-        return 1;
-    }
+    // 5. same, wrapped first so it is valid for any angle like fasterSinCos
+    const auto wrapped = suite.run("boundToPi+Pade sin+cos (SIMD)", blockSize, [&] {
+        for (int i = 0; i < blockSize; i += 4)
+        {
+            SIMD_M128 vx = MarsDSP::boundToPiSIMD(SIMD_MM(loadu_ps)(&input[i]));
+            SIMD_MM(storeu_ps)(&output[i], MarsDSP::fasterSin(vx));
+            SIMD_MM(storeu_ps)(&outputCos[i], MarsDSP::fasterCos(vx));
+        }
+        Bench::doNotOptimize(output);
+        Bench::doNotOptimize(outputCos);
+    }, { .relativeTo = "std::sin" });
 
-    csv << "algorithm,avg_time_us,speedup\n";
-    csv << std::fixed << std::setprecision(6);
-    csv << "std::sin," << timeStd << ",1.0\n";
-    csv << "Pade (Scalar)," << timeScalar << "," << (timeStd / timeScalar) << "\n";
-    csv << "Pade (SIMD)," << timeSimd << "," << (timeStd / timeSimd) << "\n";
-    csv.close();
+    // 6. fused full-range SinCos (SIMD)
+    const auto fused = suite.run("SinCos fused (SIMD)", blockSize, [&] {
+        for (int i = 0; i < blockSize; i += 4)
+        {
+            SIMD_M128 vs, vc;
+            MarsDSP::fasterSinCos(SIMD_MM(loadu_ps)(&input[i]), vs, vc);
+            SIMD_MM(storeu_ps)(&output[i], vs);
+            SIMD_MM(storeu_ps)(&outputCos[i], vc);
+        }
+        Bench::doNotOptimize(output);
+        Bench::doNotOptimize(outputCos);
+    }, { .relativeTo = "std::sin" });
 
-    std::cout << "\nResults (Average time per block of " << blockSize << " samples):" << std::endl;
-    std::cout << "  std::sin:       " << std::setw(8) << timeStd << " us" << std::endl;
-    std::cout << "  Pade (Scalar):  " << std::setw(8) << timeScalar << " us (" << (timeStd / timeScalar) << "x faster)" << std::endl;
-    std::cout << "  Pade (SIMD):    " << std::setw(8) << timeSimd << " us (" << (timeStd / timeSimd) << "x faster)" << std::endl;
+    if (wrapped.medianNs > 0.0 && fused.medianNs > 0.0)
+        std::cout << "\nSinCos fused vs wrapped + Pade (both outputs, any angle): "
+                  << wrapped.medianNs / fused.medianNs << "x" << std::endl;
 
-    return 0;
+    return suite.finish();
 }
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <string>
+#include <numbers>
+#include "dsp/engine/smoothing/smoother_bank.h"
+#include "bench.h"
+
+using namespace MarsDSP;
+
+// the engine's previous smoothers, one object per parameter
+struct LegacyLipol
+{
+    float current = 0.0f, target = 0.0f, delta = 0.0f;
+
+    void setTarget(float t, int blockSize) noexcept
+    {
+        target = t;
+        delta  = (blockSize > 0) ? (t - current) / static_cast<float>(blockSize) : 0.0f;
+    }
+    void advanceBlock() noexcept { current = target; delta = 0.0f; }
+
+    SIMD_M128 quad(int q) const noexcept
+    {
+        const float base = current + delta * static_cast<float>(4 * q);
+        return SIMD_MM(add_ps)(SIMD_MM(set1_ps)(base),
+                               SIMD_MM(mul_ps)(SIMD_MM(set1_ps)(delta),
+                                               SIMD_MM(setr_ps)(0.0f, 1.0f, 2.0f, 3.0f)));
+    }
+};
+
+struct LegacyLag
+{
+    float v = 0.0f, target = 0.0f, lpinvLog2 = 0.0f;
+
+    void setRateInMilliseconds(double ms, double fs)
+    {
+        const float samples = static_cast<float>(ms * 0.001 * fs);
+        lpinvLog2 = fasterLog2(fasterExp(-2.0f * std::numbers::pi_v<float> / samples));
+    }
+    void processN(int n) { v = target + (v - target) * fasterExp2(lpinvLog2 * static_cast<float>(n)); }
+};
+
+int main(int argc, char** argv)
+{
+    const int blockSizes[] = { 32, 128, 512 };
+    constexpr double fs = 48000.0;
+
+    // stand-in for PASS 3: mix / feedback MAC on two channels
+    std::vector<float> in(512, 0.25f), fbIn(512, 0.5f), out(512), write(512);
+
+    std::cout << "Benchmarking 4 ramps + 1 lag through a PASS 3 style loop..." << std::endl;
+    Bench::Suite suite("perf_smoother_bank", argc, argv);
+
+    auto targetOf = [](int it, int p) { return 0.5f + 0.4f * static_cast<float>(((it + p) & 7) - 4) * 0.125f; };
+
+    // speedup is relative to the legacy case of the same block size
+    for (const int blockSize : blockSizes)
+    {
+        const std::string legacy = "LipolSIMD+SurgeLag @" + std::to_string(blockSize);
+        const std::string tags = "block_size=" + std::to_string(blockSize);
+
+        // 1. per-parameter objects, vectors rebuilt from set1/setr every quad
+        {
+            LegacyLipol mix, fbL, fbR, crossfeed;
+            LegacyLag delayMs;
+            delayMs.setRateInMilliseconds(150.0, fs);
+            int it = 0;
+            suite.run(legacy, blockSize, [&] {
+                mix.setTarget(targetOf(it, 0), blockSize);
+                fbL.setTarget(targetOf(it, 1), blockSize);
+                fbR.setTarget(targetOf(it, 2), blockSize);
+                crossfeed.setTarget(targetOf(it, 3), blockSize);
+                delayMs.target = 100.0f + targetOf(it, 4);
+                delayMs.processN(blockSize);
+                ++it;
+
+                for (int n = 0; n < blockSize; n += 4)
+                {
+                    const int q = n >> 2;
+                    const auto vMix = mix.quad(q);
+                    const auto vX   = SIMD_MM(loadu_ps)(&in[n]);
+                    const auto vY   = SIMD_MM(loadu_ps)(&fbIn[n]);
+                    SIMD_MM(storeu_ps)(&write[n], SIMD_MM(add_ps)(vX, SIMD_MM(mul_ps)(SIMD_MM(add_ps)(fbL.quad(q), fbR.quad(q)), vY)));
+                    SIMD_MM(storeu_ps)(&out[n], SIMD_MM(add_ps)(SIMD_MM(mul_ps)(vY, vMix),
+                                                                SIMD_MM(mul_ps)(vX, SIMD_MM(sub_ps)(SIMD_MM(set1_ps)(1.0f), vMix))));
+                }
+                out[0] += crossfeed.current * 1.0e-9f + delayMs.v * 1.0e-12f;
+
+                mix.advanceBlock(); fbL.advanceBlock(); fbR.advanceBlock(); crossfeed.advanceBlock();
+                Bench::doNotOptimize(out);
+                Bench::doNotOptimize(write);
+            }, { .relativeTo = legacy, .tags = tags });
+        }
+
+        // 2. SmootherBank: one beginBlock, ramps held in registers, one quad counter
+        {
+            DSP::SmootherBank<8> bank;
+            bank.setLagMs(4, 150.0, fs);
+            int it = 0;
+            suite.run("SmootherBank @" + std::to_string(blockSize), blockSize, [&] {
+                for (int p = 0; p < 4; ++p) bank.setTarget(p, targetOf(it, p));
+                bank.setTarget(4, 100.0f + targetOf(it, 4));
+                bank.beginBlock(blockSize);
+                ++it;
+
+                const auto rMix = bank.ramp(0), rFbL = bank.ramp(1), rFbR = bank.ramp(2);
+                const auto vOne = SIMD_MM(set1_ps)(1.0f);
+                auto vQ = SIMD_MM(setzero_ps)();
+                for (int n = 0; n < blockSize; n += 4, vQ = SIMD_MM(add_ps)(vQ, vOne))
+                {
+                    const auto vMix = rMix.quad(vQ);
+                    const auto vX   = SIMD_MM(loadu_ps)(&in[n]);
+                    const auto vY   = SIMD_MM(loadu_ps)(&fbIn[n]);
+                    SIMD_MM(storeu_ps)(&write[n], SIMD_MM(add_ps)(vX, SIMD_MM(mul_ps)(SIMD_MM(add_ps)(rFbL.quad(vQ), rFbR.quad(vQ)), vY)));
+                    SIMD_MM(storeu_ps)(&out[n], SIMD_MM(add_ps)(SIMD_MM(mul_ps)(vY, vMix),
+                                                                SIMD_MM(mul_ps)(vX, SIMD_MM(sub_ps)(vOne, vMix))));
+                }
+                out[0] += bank.getCurrent(3) * 1.0e-9f + bank.getBlockEnd(4) * 1.0e-12f;
+
+                bank.endBlock();
+                Bench::doNotOptimize(out);
+                Bench::doNotOptimize(write);
+            }, { .relativeTo = legacy, .tags = tags });
+        }
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <JuceHeader.h>
+#include "PluginState.h"
+#include "bench.h"
+
+using namespace Chronos;
+
+// the previous getStateInformation / setStateInformation: APVTS-shaped
+// ValueTree → XML → binary, and back through the XML parser
+static void xmlSave(const std::array<float, kNumParams>& values, juce::MemoryBlock& dest)
+{
+    juce::ValueTree state("PARAMETERS");
+    state.setProperty(kStateVersionProperty, kPluginStateVersion, nullptr);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        juce::ValueTree param("PARAM");
+        param.setProperty("id", juce::String(kParamSpecs[i].id), nullptr);
+        param.setProperty("value", values[i], nullptr);
+        state.appendChild(param, nullptr);
+    }
+    std::unique_ptr xml(state.createXml());
+    juce::AudioProcessor::copyXmlToBinary(*xml, dest);
+}
+
+static bool xmlLoad(const juce::MemoryBlock& src, std::array<float, kNumParams>& values)
+{
+    std::unique_ptr xml(juce::AudioProcessor::getXmlFromBinary(src.getData(), static_cast<int>(src.getSize())));
+    if (xml == nullptr)
+        return false;
+
+    auto tree = juce::ValueTree::fromXml(*xml);
+    migrateStateTree(tree, static_cast<int>(tree.getProperty(kStateVersionProperty, 0)));
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        const auto param = tree.getChildWithProperty("id", juce::String(kParamSpecs[i].id));
+        if (param.isValid())
+            values[i] = static_cast<float>(param.getProperty("value"));
+    }
+    return true;
+}
+
+static void binarySave(const std::array<float, kNumParams>& values, juce::MemoryBlock& dest)
+{
+    dest.setSize(BinaryState::kStateSize);
+    BinaryState::write(dest.getData(), values);
+}
+
+static bool binaryLoad(const juce::MemoryBlock& src, std::array<float, kNumParams>& values)
+{
+    values = BinaryState::defaults();
+    BinaryState::Header header {};
+    if (!BinaryState::read(src.getData(), src.getSize(), values, header))
+        return false;
+    if (header.streamingVersion < MarsDSP::DSP::DelayEngine<float>::streamingVersion)
+        MarsDSP::DSP::DelayEngine<float>::remapParametersForStreamingVersion(
+            static_cast<int16_t>(header.streamingVersion), values.data());
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    // a non-default value for every parameter, inside its range
+    std::array<float, kNumParams> saved {};
+    for (size_t i = 0; i < saved.size(); ++i)
+    {
+        const auto& p = kParamSpecs[i];
+        saved[i] = (p.kind == ParamKind::Float) ? p.min + (p.max - p.min) * 0.37f : p.max;
+    }
+
+    // ---- correctness: round trip, XML rejected by the binary path, truncation rejected ----
+    {
+        juce::MemoryBlock bin, xml;
+        std::array<float, kNumParams> loaded {};
+        binarySave(saved, bin);
+        xmlSave(saved, xml);
+
+        const bool roundTrip = binaryLoad(bin, loaded) && loaded == saved;
+        const bool xmlIsForeign = !BinaryState::isBinaryState(xml.getData(), xml.getSize());
+        BinaryState::Header header {};
+        auto scratch = BinaryState::defaults();
+        const bool truncated = !BinaryState::read(bin.getData(), bin.getSize() - 1, scratch, header);
+
+        std::cout << "State size: binary " << bin.getSize() << " bytes, XML " << xml.getSize() << " bytes" << std::endl;
+        if (!roundTrip || !xmlIsForeign || !truncated)
+        {
+            std::cerr << "Binary state check failed (round trip " << roundTrip << ", xml foreign " << xmlIsForeign
+                      << ", truncated rejected " << truncated << ")" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Benchmarking state save/load round trips..." << std::endl;
+    Bench::Suite suite("perf_state", argc, argv);
+
+    // one save + load per iteration, speedup relative to the XML path
+    auto roundTrip = [&](auto save, auto load)
+    {
+        return [&saved, save, load, block = juce::MemoryBlock(), loaded = std::array<float, kNumParams> {}]() mutable {
+            save(saved, block);
+            if (!load(block, loaded) || loaded[0] != saved[0]) std::cout << "Never happens";
+            Bench::doNotOptimize(loaded);
+        };
+    };
+    suite.run("XML (ValueTree)", 1, roundTrip(xmlSave, xmlLoad), { .relativeTo = "XML (ValueTree)" });
+    suite.run("Binary",          1, roundTrip(binarySave, binaryLoad), { .relativeTo = "XML (ValueTree)" });
+
+    return suite.finish();
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <sstream>
+#include <JuceHeader.h>
+#include "dsp/engine/delay/delay_engine.h"
+#include "bench.h"
+
+using namespace MarsDSP::DSP;
+
+// what render() replaces: the UI walking the raw ring for every column
+static void naiveRender(const std::vector<float>& ring, int head, int numSamples, WaveformColumn* columns, int numColumns)
+{
+    const int size = static_cast<int>(ring.size());
+    const double perColumn = static_cast<double>(numSamples) / numColumns;
+    const double origin = static_cast<double>(head + size - numSamples);
+    for (int c = 0; c < numColumns; ++c)
+    {
+        const int s0 = static_cast<int>(origin + c * perColumn);
+        const int s1 = std::max(s0 + 1, static_cast<int>(origin + (c + 1) * perColumn));
+        WaveformColumn col { ring[static_cast<size_t>(s0 % size)], ring[static_cast<size_t>(s0 % size)] };
+        for (int s = s0 + 1; s < s1; ++s)
+        {
+            const float x = ring[static_cast<size_t>(s % size)];
+            col.min = std::min(col.min, x);
+            col.max = std::max(col.max, x);
+        }
+        columns[c] = col;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int blockSizes[] = { 32, 128, 512 };
+    constexpr double fs = 48000.0;
+    constexpr int kRing = 1 << 14;
+    constexpr int kColumns = 1000;
+
+    // ---- correctness: every pair brackets its samples, across two ring laps ----
+    {
+        WaveformPyramid<kRing> pyramid;
+        pyramid.clear();
+        std::vector<float> ring(kRing, 0.0f);
+        uint32_t state = 0x9E3779B9u;
+        int head = 0;
+        for (int written = 0; written < 2 * kRing + 777;)
+        {
+            state = state * 1664525u + 1013904223u;
+            const int n = 1 + static_cast<int>(state >> 23);        // 1..512
+            for (int k = 0; k < n; ++k)
+            {
+                state = state * 1664525u + 1013904223u;
+                ring[static_cast<size_t>((head + k) & (kRing - 1))] = static_cast<float>(static_cast<int32_t>(state)) * (1.5f / 2147483648.0f);
+            }
+            pyramid.update(ring.data(), head, n);
+            head = (head + n) & (kRing - 1);
+            written += n;
+        }
+
+        // a pair covers its samples minus the not-yet-rewritten rest of the
+        // bucket holding the head; quantisation is one int16 step
+        const float step = 1.001f * WaveformPyramid<kRing>::kRange / 32767.0f;
+        const int stale0 = head, stale1 = (head + 63) & ~63;
+        bool ok = pyramid.newest() == head;
+        for (int level = 0; ok && level < WaveformPyramid<kRing>::kLevels; ++level)
+        {
+            const int size = 64 << level;
+            for (int b = 0; ok && b < kRing / size; ++b)
+            {
+                float lo = 0.0f, hi = 0.0f;
+                bool any = false;
+                for (int s = b * size; s < (b + 1) * size; ++s)
+                {
+                    if (s >= stale0 && s < stale1) continue;
+                    const float x = ring[static_cast<size_t>(s)];
+                    lo = any ? std::min(lo, x) : x;
+                    hi = any ? std::max(hi, x) : x;
+                    any = true;
+                }
+                const auto pair = pyramid.bucket(level, b);
+                ok = pair.min <= lo && pair.min >= lo - step && pair.max >= hi && pair.max <= hi + step;
+            }
+        }
+        if (!ok)
+        {
+            std::cerr << "Waveform pyramid check failed" << std::endl;
+            return 1;
+        }
+        std::cout << "Pyramid brackets every bucket on all " << WaveformPyramid<kRing>::kLevels << " levels" << std::endl;
+    }
+
+    Bench::Suite suite("perf_waveform", argc, argv);
+
+    // ---- audio thread: DelayEngine::process with the history off vs on ----
+    std::cout << "Benchmarking DelayEngine::process, waveform history off / on..." << std::endl;
+    for (const int blockSize : blockSizes)
+    {
+        const std::string off = "process (history off) @" + std::to_string(blockSize);
+        const std::string tags = "group=process;block_size=" + std::to_string(blockSize);
+        for (const bool history : { false, true })
+        {
+            DelayEngine<float> engine;
+            juce::dsp::ProcessSpec spec {};
+            spec.sampleRate = fs;
+            spec.maximumBlockSize = static_cast<uint32_t>(blockSize);
+            spec.numChannels = 2;
+            engine.prepare(spec);
+            engine.setDelayTimeParam(350.0f);
+            engine.setFeedbackParam(0.5f);
+            engine.setMixParam(0.5f);
+            engine.setWaveformHistoryEnabled(history);
+
+            juce::AudioBuffer<float> buf(2, blockSize);
+            int it = 0;
+            suite.run(history ? "process (history on) @" + std::to_string(blockSize) : off, blockSize, [&] {
+                for (int ch = 0; ch < 2; ++ch)
+                    buf.setSample(ch, 0, (it & 63) == 0 ? 0.5f : 0.0f);
+                ++it;
+                juce::dsp::AudioBlock<float> block(buf);
+                engine.process(block, blockSize);
+                Bench::doNotOptimize(buf);
+            }, { .relativeTo = off, .tags = tags });
+        }
+    }
+
+    // ---- UI thread: one frame of kColumns columns at several zooms ----
+    std::cout << "Benchmarking a " << kColumns << "-column frame, raw ring walk vs pyramid..." << std::endl;
+    {
+        constexpr int kEngineRing = 1 << 18;
+        std::vector<float> ring(kEngineRing);
+        for (int s = 0; s < kEngineRing; ++s)
+            ring[static_cast<size_t>(s)] = std::sin(0.01f * static_cast<float>(s)) * 0.5f;
+        WaveformPyramid<kEngineRing> pyramid;
+        pyramid.clear();
+        pyramid.update(ring.data(), 0, kEngineRing);
+
+        std::vector<WaveformColumn> columns(kColumns);
+        for (const double seconds : { 0.1, 1.0, 5.0 })
+        {
+            const int span = static_cast<int>(seconds * fs);
+            std::ostringstream secs;
+            secs << seconds;
+            const std::string walk = "ring walk " + secs.str() + " s";
+            const std::string tags = "group=frame;seconds=" + secs.str();
+            suite.run(walk, kColumns, [&] {
+                naiveRender(ring, 0, span, columns.data(), kColumns);
+                Bench::doNotOptimize(columns);
+            }, { .relativeTo = walk, .tags = tags });
+            suite.run("pyramid " + secs.str() + " s", kColumns, [&] {
+                pyramid.render(span, columns.data(), kColumns);
+                Bench::doNotOptimize(columns);
+            }, { .relativeTo = walk, .tags = tags });
+        }
+    }
+
+    return suite.finish();
+}
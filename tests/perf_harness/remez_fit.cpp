@@ -0,0 +1,656 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <bit>
+#include <string>
+#include <array>
+#include <utility>
+#include <numbers>
+#include <iomanip>
+#include <algorithm>
+#include <filesystem>
+#include "dsp/math/fastermath.h"
+
+using namespace MarsDSP;
+
+// offline minimax fitter for the fastermath approximants
+//
+//   remez_fit                                  fit every target with its defaults
+//   remez_fit tanh --range -5 5 --num 4 --den 3 --metric abs --budget 1e-6
+//
+// for each (num, den) order pair up to the limits it runs a rational remez
+// exchange (the reference system is solved in long double, the coefficients
+// and the error scan kept in double), rounds the coefficients to float, and
+// then measures the float SIMD kernel it would become: max abs / rel / ulp
+// error over the range and ns per element. the candidates and their pareto
+// front go to
+//
+//   tests/perf_harness/logs/remez_<func>_pareto.csv
+//
+// and the cheapest pareto candidate that meets the budget is written out as a
+// fastermath-style header (scalar + SIMD_M128 kernel, float coefficients)
+//
+//   tests/perf_harness/logs/fastermath_remez_<func>.h        (or --out path)
+//
+// odd / even targets are fitted in u = x² the way the pade kernels are
+// written (x·P(x²)/Q(x²) and P(x²)/Q(x²)), so orders count powers of u.
+// orders are limited to kMaxNum / kMaxDen because every (num, den) kernel is
+// a separate template instantiation; that is what makes the timings honest.
+namespace
+{
+    constexpr int kMaxNum = 8;
+    constexpr int kMaxDen = 4;
+
+    enum class Symmetry { Odd, Even, None };
+    enum class Metric { Abs, Rel, Ulp };
+
+    struct Target
+    {
+        std::string name;
+        Symmetry sym;
+        double lo, hi;
+        Metric metric;
+        double budget;
+        int maxNum, maxDen;
+        double (*f)(double);
+        double limit0;                                  // f(x)/x at 0, odd targets only
+        SIMD_M128 (*baseline)(SIMD_M128);
+        std::string baselineName;
+    };
+
+    struct Config
+    {
+        Target target;
+        std::string out;
+    };
+
+    std::vector<Target> defaultTargets()
+    {
+        const double pi = std::numbers::pi;
+        const double halfLn2 = 0.5 * std::numbers::ln2;
+        return {
+            { "sin",  Symmetry::Odd,  -pi, pi,           Metric::Abs, 1.0e-6, 5, 3,
+              [](double x) { return std::sin(x); },  1.0, [](SIMD_M128 x) { return fasterSin(x); },  "fasterSin" },
+            { "cos",  Symmetry::Even, -pi, pi,           Metric::Abs, 1.0e-6, 5, 3,
+              [](double x) { return std::cos(x); },  0.0, [](SIMD_M128 x) { return fasterCos(x); },  "fasterCos" },
+            { "tan",  Symmetry::Odd,  -pi / 4, pi / 4,   Metric::Rel, 1.0e-6, 4, 3,
+              [](double x) { return std::tan(x); },  1.0, [](SIMD_M128 x) { return fasterTan(x); },  "fasterTan" },
+            { "tanh", Symmetry::Odd,  -5.0, 5.0,         Metric::Abs, 1.0e-6, 4, 4,
+              [](double x) { return std::tanh(x); }, 1.0, [](SIMD_M128 x) { return fasterTanh(x); }, "fasterTanh" },
+            { "exp2", Symmetry::None, -0.5, 0.5,         Metric::Rel, 2.0e-7, 7, 3,
+              [](double x) { return std::exp2(x); }, 0.0, [](SIMD_M128 x) { return fasterExp2(x); }, "fasterExp2" },
+            { "exp",  Symmetry::None, -halfLn2, halfLn2, Metric::Rel, 2.0e-7, 7, 3,
+              [](double x) { return std::exp(x); },  0.0, [](SIMD_M128 x) { return fasterExp(x); },  "fasterExp" },
+        };
+    }
+
+    // ---- remez exchange ----
+    //
+    // fits R(u) = P(u) / Q(u), q[0] = 1, to g(u) minimising max |w(u)·(R - g)|
+    //
+    //   odd   x·R(x²) ≈ f(x)     g = f(x)/x    abs weight x
+    //   even    R(x²) ≈ f(x)     g = f(x)      abs weight 1
+    //   none    R(x)  ≈ f(x)     g = f(x)      abs weight 1
+    //
+    // with rel weight 1/|g| in all three cases. the rational system is
+    // nonlinear in the levelled error E; it is linearised by using the previous
+    // E in the E·Q(u) term and iterating to a fixed point.
+    struct Problem
+    {
+        Symmetry sym;
+        double (*f)(double);
+        double limit0;
+        bool relative;
+        double xa, xb;                                  // fitted x interval
+        std::vector<double> grid;                       // in u
+
+        double toU(const double x) const { return sym == Symmetry::None ? x : x * x; }
+
+        double g(const double u) const
+        {
+            if (sym == Symmetry::None) return f(u);
+            const double x = std::sqrt(u);
+            if (sym == Symmetry::Even) return f(x);
+            return x == 0.0 ? limit0 : f(x) / x;
+        }
+
+        double w(const double u) const
+        {
+            if (relative) return 1.0 / std::abs(g(u));
+            return sym == Symmetry::Odd ? std::sqrt(u) : 1.0;
+        }
+    };
+
+    struct Fit
+    {
+        std::vector<double> p, q;
+        double levelled = 0.0;                          // |E| of the last solve
+        double maxErr = 0.0;                            // weighted, over the grid
+        bool ok = false;
+    };
+
+    long double horner(const std::vector<double>& c, const long double u)
+    {
+        long double r = 0.0L;
+        for (std::size_t i = c.size(); i-- > 0;) r = r * u + c[i];
+        return r;
+    }
+
+    bool solve(std::vector<std::vector<long double>>& a, std::vector<long double>& b)
+    {
+        const std::size_t n = b.size();
+        for (std::size_t col = 0; col < n; ++col)
+        {
+            std::size_t pivot = col;
+            for (std::size_t r = col + 1; r < n; ++r)
+                if (std::abs(a[r][col]) > std::abs(a[pivot][col])) pivot = r;
+            if (a[pivot][col] == 0.0L) return false;
+            std::swap(a[col], a[pivot]);
+            std::swap(b[col], b[pivot]);
+
+            for (std::size_t r = col + 1; r < n; ++r)
+            {
+                const long double f = a[r][col] / a[col][col];
+                for (std::size_t j = col; j < n; ++j) a[r][j] -= f * a[col][j];
+                b[r] -= f * b[col];
+            }
+        }
+        for (std::size_t i = n; i-- > 0;)
+        {
+            for (std::size_t j = i + 1; j < n; ++j) b[i] -= a[i][j] * b[j];
+            b[i] /= a[i][i];
+        }
+        return std::all_of(b.begin(), b.end(), [](long double v) { return std::isfinite(v); });
+    }
+
+    Fit remez(const Problem& pr, const int M, const int N)
+    {
+        const int K = M + N + 2;
+
+        // chebyshev nodes in x as the first reference
+        std::vector<double> ref(K);
+        for (int i = 0; i < K; ++i)
+        {
+            const double c = 0.5 * (1.0 - std::cos(std::numbers::pi * (i + 0.5) / K));
+            ref[i] = pr.toU(pr.xa + (pr.xb - pr.xa) * c);
+        }
+
+        Fit best;
+        best.maxErr = std::numeric_limits<double>::infinity();
+        std::vector<double> err(pr.grid.size());
+
+        for (int iter = 0; iter < 60; ++iter)
+        {
+            Fit fit;
+            fit.p.assign(M + 1, 0.0);
+            fit.q.assign(N + 1, 0.0);
+            fit.q[0] = 1.0;
+
+            // ---- solve on the reference, iterating E for rationals ----
+            long double E = 0.0L;
+            bool solved = false;
+            for (int inner = 0; inner < (N > 0 ? 40 : 1); ++inner)
+            {
+                std::vector<std::vector<long double>> a(K, std::vector<long double>(K, 0.0L));
+                std::vector<long double> b(K);
+                for (int i = 0; i < K; ++i)
+                {
+                    const long double u  = ref[i];
+                    const long double gi = pr.g(ref[i]);
+                    const long double si = (i % 2 == 0) ? 1.0L : -1.0L;
+                    const long double wi = pr.w(ref[i]);
+
+                    long double up = 1.0L;
+                    for (int j = 0; j <= M; ++j, up *= u) a[i][j] = up;
+                    up = u;
+                    for (int k = 1; k <= N; ++k, up *= u) a[i][M + k] = -(gi + si * E / wi) * up;
+                    a[i][K - 1] = -si / wi;
+                    b[i] = gi;
+                }
+                if (!(solved = solve(a, b))) break;
+
+                const long double En = b[K - 1];
+                for (int j = 0; j <= M; ++j) fit.p[j] = static_cast<double>(b[j]);
+                for (int k = 1; k <= N; ++k) fit.q[k] = static_cast<double>(b[M + k]);
+
+                const bool settled = std::abs(En - E) <= 1.0e-10L * std::abs(En);
+                E = En;
+                if (settled) break;
+            }
+            if (!solved) break;
+            fit.levelled = static_cast<double>(std::abs(E));
+
+            // ---- weighted error on the grid; Q must stay positive ----
+            bool poleFree = true;
+            fit.maxErr = 0.0;
+            for (std::size_t j = 0; j < pr.grid.size(); ++j)
+            {
+                const long double u = pr.grid[j];
+                const long double den = horner(fit.q, u);
+                if (!(den > 0.0L)) { poleFree = false; break; }
+                err[j] = static_cast<double>(pr.w(pr.grid[j]) * (horner(fit.p, u) / den - pr.g(pr.grid[j])));
+                if (!std::isfinite(err[j])) err[j] = 0.0;    // weight 0 · inf at u = 0 for odd abs
+                fit.maxErr = std::max(fit.maxErr, std::abs(err[j]));
+            }
+            if (!poleFree) break;
+
+            fit.ok = true;
+            if (fit.maxErr < best.maxErr) best = fit;
+            if (fit.maxErr <= fit.levelled * (1.0 + 1.0e-4)) break;
+
+            // ---- exchange: one extremum per sign run, trimmed to K ----
+            std::vector<std::size_t> ext;
+            for (std::size_t j = 0; j < err.size();)
+            {
+                const bool positive = err[j] >= 0.0;
+                std::size_t peak = j;
+                for (; j < err.size() && (err[j] >= 0.0) == positive; ++j)
+                    if (std::abs(err[j]) > std::abs(err[peak])) peak = j;
+                ext.push_back(peak);
+            }
+            if (static_cast<int>(ext.size()) < K) break;
+
+            auto mag = [&err](const std::size_t j) { return std::abs(err[j]); };
+            while (static_cast<int>(ext.size()) > K)
+            {
+                const auto smallest = std::min_element(ext.begin(), ext.end(),
+                                                       [&](std::size_t l, std::size_t r) { return mag(l) < mag(r); });
+                const bool atEnd = smallest == ext.begin() || smallest == ext.end() - 1;
+                if (static_cast<int>(ext.size()) == K + 1 || atEnd)
+                {
+                    // drop whichever end is smaller; alternation is kept
+                    if (mag(ext.front()) < mag(ext.back())) ext.erase(ext.begin());
+                    else ext.pop_back();
+                }
+                else
+                {
+                    // dropping an interior point leaves two same-sign neighbours: keep the larger
+                    const auto at = ext.erase(smallest);
+                    ext.erase(mag(*(at - 1)) < mag(*at) ? at - 1 : at);
+                }
+            }
+            for (int i = 0; i < K; ++i) ref[i] = pr.grid[ext[i]];
+        }
+
+        return best;
+    }
+
+    // ---- float kernels: one instantiation per (symmetry, num, den) ----
+    using KernelFn = void (*)(const float*, float*, int, const float*, const float*);
+
+    template<Symmetry S, int M, int N>
+    void kernelBlock(const float* in, float* out, const int n, const float* p, const float* q)
+    {
+        SIMD_M128 vp[M + 1], vq[N + 1];
+        for (int k = 0; k <= M; ++k) vp[k] = SIMD_MM(set1_ps)(p[k]);
+        for (int k = 0; k <= N; ++k) vq[k] = SIMD_MM(set1_ps)(q[k]);
+
+        for (int i = 0; i + 4 <= n; i += 4)
+        {
+            const auto x = SIMD_MM(loadu_ps)(in + i);
+            const auto u = (S == Symmetry::None) ? x : SIMD_MM(mul_ps)(x, x);
+
+            auto num = vp[M];
+            for (int k = M - 1; k >= 0; --k) num = SIMD_MM(add_ps)(vp[k], SIMD_MM(mul_ps)(u, num));
+
+            auto r = num;
+            if constexpr (N > 0)
+            {
+                auto den = vq[N];
+                for (int k = N - 1; k >= 0; --k) den = SIMD_MM(add_ps)(vq[k], SIMD_MM(mul_ps)(u, den));
+                r = SIMD_MM(div_ps)(num, den);
+            }
+            if constexpr (S == Symmetry::Odd) r = SIMD_MM(mul_ps)(x, r);
+
+            SIMD_MM(storeu_ps)(out + i, r);
+        }
+    }
+
+    template<Symmetry S, std::size_t... I>
+    constexpr std::array<KernelFn, sizeof...(I)> kernelTable(std::index_sequence<I...>)
+    {
+        return { &kernelBlock<S, static_cast<int>(I) / (kMaxDen + 1), static_cast<int>(I) % (kMaxDen + 1)>... };
+    }
+
+    KernelFn kernelFor(const Symmetry s, const int M, const int N)
+    {
+        using Seq = std::make_index_sequence<(kMaxNum + 1) * (kMaxDen + 1)>;
+        static constexpr auto odd  = kernelTable<Symmetry::Odd>(Seq {});
+        static constexpr auto even = kernelTable<Symmetry::Even>(Seq {});
+        static constexpr auto none = kernelTable<Symmetry::None>(Seq {});
+        const auto& table = s == Symmetry::Odd ? odd : (s == Symmetry::Even ? even : none);
+        return table[static_cast<std::size_t>(M * (kMaxDen + 1) + N)];
+    }
+
+    // ---- measurement ----
+    struct Candidate
+    {
+        std::string label;
+        int num = 0, den = 0;
+        std::vector<float> p, q;
+        double fitErr = 0.0;                            // weighted, in double before rounding
+        double maxAbs = 0.0, maxRel = 0.0, maxUlp = 0.0;
+        double nsPerElem = 0.0;
+        bool pareto = false, selected = false, baseline = false;
+
+        double metric(const Metric m) const { return m == Metric::Abs ? maxAbs : (m == Metric::Rel ? maxRel : maxUlp); }
+    };
+
+    std::int64_t orderedBits(const float v)
+    {
+        const auto b = static_cast<std::int32_t>(std::bit_cast<std::uint32_t>(v));
+        return b < 0 ? -static_cast<std::int64_t>(b & 0x7fffffff) : b;
+    }
+
+    template<typename Block>
+    void measure(const Target& t, Block&& block, Candidate& c)
+    {
+        // accuracy: 2^18 points across the full range, so both signs for odd / even targets
+        const int steps = 1 << 18;
+        std::vector<float> in(steps), out(steps);
+        for (int i = 0; i < steps; ++i)
+            in[i] = static_cast<float>(t.lo + (t.hi - t.lo) * i / (steps - 1));
+        block(in.data(), out.data(), steps);
+
+        for (int i = 0; i < steps; ++i)
+        {
+            const double ref = t.f(in[i]);
+            const double abs = std::abs(out[i] - ref);
+            c.maxAbs = std::max(c.maxAbs, abs);
+            if (ref != 0.0) c.maxRel = std::max(c.maxRel, abs / std::abs(ref));
+            c.maxUlp = std::max(c.maxUlp, static_cast<double>(std::abs(orderedBits(out[i]) - orderedBits(static_cast<float>(ref)))));
+        }
+
+        // speed: best of 5 runs over a 4096-sample block
+        const int n = 4096, reps = 2000;
+        double best = std::numeric_limits<double>::infinity();
+        for (int trial = 0; trial < 5; ++trial)
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int r = 0; r < reps; ++r)
+            {
+                block(in.data() + (r & 7) * 4, out.data(), n);
+                if (out[0] > 1.0e30f) std::cout << "Never happens";
+            }
+            const auto end = std::chrono::high_resolution_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(n) * reps));
+        }
+        c.nsPerElem = best;
+    }
+
+    std::string orderLabel(const Symmetry s, const int M, const int N)
+    {
+        // orders in x, the way the pade kernels are named
+        const int numX = s == Symmetry::Odd ? 2 * M + 1 : (s == Symmetry::Even ? 2 * M : M);
+        const int denX = s == Symmetry::None ? N : 2 * N;
+        return "[" + std::to_string(numX) + "/" + std::to_string(denX) + "]";
+    }
+
+    // ---- header emission ----
+    std::string floatLiteral(const float v)
+    {
+        std::ostringstream s;
+        s << std::scientific << std::setprecision(9) << v << "f";
+        return s.str();
+    }
+
+    std::string hornerScalar(const char* name, const int order)
+    {
+        std::string e = std::string(name) + std::to_string(order);
+        for (int k = order - 1; k >= 0; --k)
+            e = std::string(name) + std::to_string(k) + " + u * " + (k == order - 1 ? e : "(" + e + ")");
+        return e;
+    }
+
+    void emitHeader(const Config& cfg, const Candidate& c)
+    {
+        const Target& t = cfg.target;
+        std::string Name = t.name;
+        Name[0] = static_cast<char>(std::toupper(Name[0]));
+        std::string guard = t.name;
+        std::transform(guard.begin(), guard.end(), guard.begin(), [](char ch) { return static_cast<char>(std::toupper(ch)); });
+
+        const char* form = t.sym == Symmetry::Odd ? "x · P(x²) / Q(x²)" : (t.sym == Symmetry::Even ? "P(x²) / Q(x²)" : "P(x) / Q(x)");
+        const int M = c.num, N = c.den;
+
+        std::ofstream h(cfg.out);
+        h << "#pragma once\n\n"
+          << "#ifndef CHRONOS_FASTERMATH_REMEZ_" << guard << "_H\n"
+          << "#define CHRONOS_FASTERMATH_REMEZ_" << guard << "_H\n\n"
+          << "#include \"dsp/math/simd/simd_config.h\"\n\n"
+          << "// generated by tests/perf_harness/remez_fit, do not edit\n"
+          << "namespace MarsDSP::inline FasterMath\n{\n"
+          << "    // minimax " << c.label << " " << t.name << "(x) ≈ " << form << " on [" << t.lo << ", " << t.hi << "]\n"
+          << "    //\n"
+          << "    // max abs err " << std::scientific << std::setprecision(3) << c.maxAbs << ", max rel err " << c.maxRel
+          << std::defaultfloat << ", max " << c.maxUlp << " ulp\n"
+          << "    // " << std::fixed << std::setprecision(3) << c.nsPerElem << std::defaultfloat << " ns / element (SIMD) on the fitting machine\n"
+          << "    namespace Remez" << Name << "Coeffs\n    {\n";
+        for (int k = 0; k <= M; ++k) h << "        constexpr float P" << k << " = " << floatLiteral(c.p[k]) << ";\n";
+        if (N > 0) h << "\n";
+        for (int k = 1; k <= N; ++k) h << "        constexpr float Q" << k << " = " << floatLiteral(c.q[k]) << ";\n";
+        h << "    }\n\n";
+
+        const std::string u = t.sym == Symmetry::None ? "x" : "x * x";
+
+        // scalar
+        h << "    inline float remez" << Name << "(const float x) noexcept\n    {\n"
+          << "        using namespace Remez" << Name << "Coeffs;\n\n"
+          << "        const auto u   = " << u << ";\n"
+          << "        const auto num = " << hornerScalar("P", M) << ";\n";
+        std::string r = "num";
+        if (N > 0)
+        {
+            // Q0 = 1 is folded in
+            std::string d = "Q" + std::to_string(N);
+            for (int k = N - 1; k >= 1; --k) d = "Q" + std::to_string(k) + " + u * " + (k == N - 1 ? d : "(" + d + ")");
+            h << "        const auto den = 1.0f + u * " << (N == 1 ? d : "(" + d + ")") << ";\n";
+            r = "(num / den)";
+        }
+        h << "\n        return " << (t.sym == Symmetry::Odd ? "x * " + r : r) << ";\n    }\n\n";
+
+        // SIMD, same operation order as the scalar and the measured kernel
+        h << "    inline SIMD_M128 remez" << Name << "(const SIMD_M128 x) noexcept\n    {\n"
+          << "        using namespace Remez" << Name << "Coeffs;\n\n"
+          << "        const auto u = " << (t.sym == Symmetry::None ? "x" : "SIMD_MM(mul_ps)(x, x)") << ";\n\n"
+          << "        auto num = SIMD_MM(set1_ps)(P" << M << ");\n";
+        for (int k = M - 1; k >= 0; --k)
+            h << "        num = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(P" << k << "), SIMD_MM(mul_ps)(u, num));\n";
+        std::string rs = "num";
+        if (N > 0)
+        {
+            h << "\n        auto den = SIMD_MM(set1_ps)(Q" << N << ");\n";
+            for (int k = N - 1; k >= 1; --k)
+                h << "        den = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(Q" << k << "), SIMD_MM(mul_ps)(u, den));\n";
+            h << "        den = SIMD_MM(add_ps)(SIMD_MM(set1_ps)(1.0f), SIMD_MM(mul_ps)(u, den));\n";
+            rs = "SIMD_MM(div_ps)(num, den)";
+        }
+        h << "\n        return " << (t.sym == Symmetry::Odd ? "SIMD_MM(mul_ps)(x, " + rs + ")" : rs) << ";\n    }\n"
+          << "}\n#endif\n";
+    }
+
+    // ---- one target ----
+    bool run(const Config& cfg)
+    {
+        const Target& t = cfg.target;
+
+        Problem pr;
+        pr.sym = t.sym;
+        pr.f = t.f;
+        pr.limit0 = t.limit0;
+        pr.relative = t.metric != Metric::Abs;
+        if (t.sym == Symmetry::None)
+        {
+            pr.xa = t.lo;
+            pr.xb = t.hi;
+        }
+        else
+        {
+            // symmetric targets are fitted on the positive half
+            pr.xa = t.lo >= 0.0 ? t.lo : 0.0;
+            pr.xb = std::max(std::abs(t.lo), std::abs(t.hi));
+        }
+        const int gridSize = 16384;
+        for (int j = 0; j < gridSize; ++j)
+        {
+            const double c = 0.5 * (1.0 - std::cos(std::numbers::pi * j / (gridSize - 1)));
+            pr.grid.push_back(pr.toU(pr.xa + (pr.xb - pr.xa) * c));
+        }
+
+        std::cout << "\nFitting " << t.name << " on [" << t.lo << ", " << t.hi << "], num <= " << t.maxNum
+                  << ", den <= " << t.maxDen << " (in " << (t.sym == Symmetry::None ? "x" : "x²") << ")" << std::endl;
+
+        std::vector<Candidate> cands;
+        {
+            Candidate b;
+            b.label = t.baselineName;
+            b.baseline = true;
+            measure(t, [&t](const float* in, float* out, int n)
+            {
+                for (int i = 0; i + 4 <= n; i += 4)
+                    SIMD_MM(storeu_ps)(out + i, t.baseline(SIMD_MM(loadu_ps)(in + i)));
+            }, b);
+            cands.push_back(b);
+        }
+
+        for (int M = 0; M <= t.maxNum; ++M)
+        {
+            for (int N = 0; N <= t.maxDen; ++N)
+            {
+                const Fit fit = remez(pr, M, N);
+                if (!fit.ok) continue;
+
+                Candidate c;
+                c.label = orderLabel(t.sym, M, N);
+                c.num = M;
+                c.den = N;
+                c.fitErr = fit.maxErr;
+                for (double v : fit.p) c.p.push_back(static_cast<float>(v));
+                for (double v : fit.q) c.q.push_back(static_cast<float>(v));
+
+                const KernelFn kernel = kernelFor(t.sym, M, N);
+                measure(t, [&](const float* in, float* out, int n) { kernel(in, out, n, c.p.data(), c.q.data()); }, c);
+                cands.push_back(c);
+            }
+        }
+
+        // pareto front on (ns / element, chosen error metric)
+        for (auto& c : cands)
+        {
+            c.pareto = std::none_of(cands.begin(), cands.end(), [&](const Candidate& d)
+            {
+                return &d != &c && d.nsPerElem <= c.nsPerElem && d.metric(t.metric) <= c.metric(t.metric)
+                    && (d.nsPerElem < c.nsPerElem || d.metric(t.metric) < c.metric(t.metric));
+            });
+        }
+
+        Candidate* pick = nullptr;
+        for (auto& c : cands)
+            if (!c.baseline && c.metric(t.metric) <= t.budget && (pick == nullptr || c.nsPerElem < pick->nsPerElem))
+                pick = &c;
+        const bool metBudget = pick != nullptr;
+        if (!metBudget)
+            for (auto& c : cands)
+                if (!c.baseline && (pick == nullptr || c.metric(t.metric) < pick->metric(t.metric)))
+                    pick = &c;
+
+        // ---- report ----
+        const std::string csvPath = "tests/perf_harness/logs/remez_" + t.name + "_pareto.csv";
+        std::ofstream csv(csvPath);
+        if (!csv.is_open())
+        {
+            std::cerr << "Failed to open " << csvPath << std::endl;
+            return false;
+        }
+        csv << "candidate,num_order,den_order,fit_err,max_abs_err,max_rel_err,max_ulp,metric_err,ns_per_elem,pareto,selected\n";
+        for (const auto& c : cands)
+        {
+            csv << c.label << "," << c.num << "," << c.den << "," << std::scientific << std::setprecision(6) << c.fitErr << ","
+                << c.maxAbs << "," << c.maxRel << "," << std::defaultfloat << c.maxUlp << "," << c.metric(t.metric) << "," << std::fixed << std::setprecision(4)
+                << c.nsPerElem << std::defaultfloat << "," << c.pareto << "," << (&c == pick) << "\n";
+        }
+        csv.close();
+
+        for (const auto& c : cands)
+        {
+            if (!c.pareto) continue;
+            std::cout << "  " << (&c == pick ? "* " : "  ") << std::left << std::setw(12) << c.label << std::right
+                      << std::scientific << std::setprecision(2) << " abs " << c.maxAbs << "  rel " << c.maxRel
+                      << std::defaultfloat << "  ulp " << std::setw(8) << c.maxUlp << std::fixed << std::setprecision(3)
+                      << "  " << c.nsPerElem << " ns" << std::defaultfloat << std::endl;
+        }
+
+        if (pick == nullptr)
+        {
+            std::cout << "  no candidate converged" << std::endl;
+            return false;
+        }
+        if (!metBudget)
+            std::cout << "  nothing meets the budget of " << t.budget << "; emitting the most accurate fit" << std::endl;
+
+        emitHeader(cfg, *pick);
+        std::cout << "  wrote " << csvPath << " and " << cfg.out << std::endl;
+        return true;
+    }
+
+    Metric parseMetric(const std::string& s)
+    {
+        if (s == "rel") return Metric::Rel;
+        if (s == "ulp") return Metric::Ulp;
+        return Metric::Abs;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Ensure the logs directory exists
+    std::filesystem::create_directories("tests/perf_harness/logs");
+
+    const auto targets = defaultTargets();
+    std::vector<Config> configs;
+
+    if (argc < 2)
+    {
+        for (const auto& t : targets)
+            configs.push_back({ t, "tests/perf_harness/logs/fastermath_remez_" + t.name + ".h" });
+    }
+    else
+    {
+        const auto it = std::find_if(targets.begin(), targets.end(), [&](const Target& t) { return t.name == argv[1]; });
+        if (it == targets.end())
+        {
+            std::cerr << "usage: remez_fit [sin|cos|tan|tanh|exp2|exp] [--range lo hi] [--num n] [--den n]"
+                         " [--metric abs|rel|ulp] [--budget err] [--out header.h]" << std::endl;
+            return 1;
+        }
+
+        Config cfg { *it, "tests/perf_harness/logs/fastermath_remez_" + it->name + ".h" };
+        for (int i = 2; i < argc; ++i)
+        {
+            const std::string a = argv[i];
+            if (a == "--range" && i + 2 < argc) { cfg.target.lo = std::stod(argv[++i]); cfg.target.hi = std::stod(argv[++i]); }
+            else if (a == "--num" && i + 1 < argc)    cfg.target.maxNum = std::clamp(std::stoi(argv[++i]), 0, kMaxNum);
+            else if (a == "--den" && i + 1 < argc)    cfg.target.maxDen = std::clamp(std::stoi(argv[++i]), 0, kMaxDen);
+            else if (a == "--metric" && i + 1 < argc) cfg.target.metric = parseMetric(argv[++i]);
+            else if (a == "--budget" && i + 1 < argc) cfg.target.budget = std::stod(argv[++i]);
+            else if (a == "--out" && i + 1 < argc)    cfg.out = argv[++i];
+            else
+            {
+                std::cerr << "unknown option " << a << std::endl;
+                return 1;
+            }
+        }
+        configs.push_back(cfg);
+    }
+
+    bool ok = true;
+    for (const auto& cfg : configs)
+        ok = run(cfg) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+import csv
+import glob
+import math
+import os
+
+def generate_svg(name, data, filename):
+    margin = 100
+    width = 900
+    height = 600
+
+    points = []
+    for row in data:
+        err = float(row["metric_err"])
+        if err <= 0.0 or not math.isfinite(err):
+            continue
+        points.append((row["candidate"], float(row["ns_per_elem"]), math.log10(err),
+                       row["pareto"] == "1", row["selected"] == "1", not row["candidate"].startswith("[")))
+
+    if not points:
+        return
+
+    max_ns = max(p[1] for p in points) * 1.1
+    lo_err = math.floor(min(p[2] for p in points))
+    hi_err = math.ceil(max(p[2] for p in points))
+    if hi_err == lo_err:
+        hi_err += 1
+
+    chart_height = height - 2 * margin
+    chart_width = width - 2 * margin
+
+    def scale_x(val):
+        return margin + val / max_ns * chart_width
+
+    def scale_y(val):
+        return margin + chart_height - (val - lo_err) / (hi_err - lo_err) * chart_height
+
+    with open(filename, "w") as f:
+        f.write(f'<svg width="{width}" height="{height}" xmlns="http://www.w3.org/2000/svg">\n')
+        f.write('<rect width="100%" height="100%" fill="#ffffff"/>\n')
+
+        # Title
+        f.write(f'<text x="{width//2}" y="50" text-anchor="middle" font-family="sans-serif" font-size="24" font-weight="bold">Remez candidates: {name}</text>\n')
+        f.write(f'<text x="{width//2}" y="75" text-anchor="middle" font-family="sans-serif" font-size="14" fill="#666">error vs ns / element | pareto front in red, selected candidate ringed</text>\n')
+
+        # Grid lines and axis labels (one per decade of error)
+        for e in range(lo_err, hi_err + 1):
+            y = scale_y(e)
+            f.write(f'<line x1="{margin}" y1="{y}" x2="{width-margin}" y2="{y}" stroke="#eee" />\n')
+            f.write(f'<text x="{margin-10}" y="{y+5}" text-anchor="end" font-family="sans-serif" font-size="12" fill="#999">1e{e}</text>\n')
+        for i in range(5):
+            ns = max_ns * i / 4
+            x = scale_x(ns)
+            f.write(f'<text x="{x}" y="{margin + chart_height + 25}" text-anchor="middle" font-family="sans-serif" font-size="12" fill="#999">{ns:.2f} ns</text>\n')
+
+        # Pareto front as a step line
+        front = sorted([p for p in points if p[3]], key=lambda p: p[1])
+        for a, b in zip(front, front[1:]):
+            f.write(f'<polyline points="{scale_x(a[1])},{scale_y(a[2])} {scale_x(b[1])},{scale_y(a[2])} {scale_x(b[1])},{scale_y(b[2])}" fill="none" stroke="#e74c3c" stroke-width="1.5" stroke-dasharray="4,3"/>\n')
+
+        # Candidates
+        for label, ns, err, pareto, selected, baseline in points:
+            x, y = scale_x(ns), scale_y(err)
+            color = "#34495e" if baseline else ("#e74c3c" if pareto else "#3498db")
+            f.write(f'<circle cx="{x}" cy="{y}" r="5" fill="{color}"/>\n')
+            if selected:
+                f.write(f'<circle cx="{x}" cy="{y}" r="10" fill="none" stroke="#2ecc71" stroke-width="2"/>\n')
+            if pareto or baseline or selected:
+                f.write(f'<text x="{x + 8}" y="{y - 8}" font-family="sans-serif" font-size="11" fill="{color}">{label}</text>\n')
+
+        # Axes
+        f.write(f'<line x1="{margin}" y1="{margin + chart_height}" x2="{width-margin}" y2="{margin + chart_height}" stroke="#ccc" stroke-width="2"/>\n')
+        f.write(f'<line x1="{margin}" y1="{margin}" x2="{margin}" y2="{margin + chart_height}" stroke="#ccc" stroke-width="2"/>\n')
+
+        f.write('</svg>\n')
+
+if __name__ == "__main__":
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    csv_files = sorted(glob.glob(os.path.join(script_dir, "logs", "remez_*_pareto.csv")))
+
+    if not csv_files:
+        print(f"Error: no remez_*_pareto.csv in {os.path.join(script_dir, 'logs')}. Run remez_fit first (from project root).")
+    else:
+        for csv_file in csv_files:
+            name = os.path.basename(csv_file)[len("remez_"):-len("_pareto.csv")]
+            output_file = os.path.join(script_dir, "logs", f"remez_{name}_pareto.svg")
+            with open(csv_file, "r") as f:
+                data = list(csv.DictReader(f))
+
+            generate_svg(name, data, output_file)
+            print(f"Successfully generated SVG visualization: {output_file} from {csv_file}")
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""Bar chart for any bench.h suite.
+
+    python3 tests/perf_harness/viz_bench.py [suite ...]
+
+Reads tests/perf_harness/logs/<suite>_results.csv and writes
+tests/perf_harness/logs/<suite>_visualization.svg next to it: one bar per
+case, in run order, with the median time per iteration, a p99 whisker and
+the speedup against the case's relativeTo. Cases sharing a group (the
+"group" tag, else the whole tag string) share a colour.
+
+Without arguments it draws every perf_*_results.csv in the logs directory;
+the delay_* suites have their own plots in viz_delay_perf.py. Logs from
+before bench.h (algorithm,avg_time_us,speedup) are still accepted.
+"""
+import csv
+import glob
+import os
+import sys
+from xml.sax.saxutils import escape
+
+LOG_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "logs")
+COLORS = ["#3498db", "#e74c3c", "#2ecc71", "#f39c12", "#9b59b6", "#1abc9c", "#34495e", "#e67e22"]
+
+
+def parse_tags(text):
+    return dict(kv.split("=", 1) for kv in text.split(";") if "=" in kv)
+
+
+def read_results(path):
+    """One dict per case: name, group, items, median / p99 in us, speedup (or None)."""
+    with open(path, newline="") as f:
+        rows = list(csv.DictReader(f))
+    cases = []
+    for row in rows:
+        if "case" in row:
+            tags = row.get("tags", "")
+            median = float(row["median_ns"]) / 1000.0
+            cases.append({
+                "name":    row["case"],
+                "group":   parse_tags(tags).get("group", tags),
+                "items":   float(row["items"]),
+                "median":  median,
+                "p99":     float(row["p99_ns"]) / 1000.0 if row["p99_ns"] else median,
+                "speedup": float(row["speedup"]) if row["speedup"] not in ("", "nan") else None,
+                "reps":    int(row["reps"]),
+            })
+        elif "algorithm" in row and "avg_time_us" in row:
+            t = float(row["avg_time_us"])
+            cases.append({"name": row["algorithm"], "group": "", "items": None, "median": t, "p99": t,
+                          "speedup": float(row["speedup"]) if row.get("speedup") else None, "reps": None})
+    return cases
+
+
+def generate_svg(suite, cases, filename):
+    margin, bottom = 120, 170
+    bar_width, spacing = 90, 40
+    width = max(800, 2 * margin + len(cases) * (bar_width + spacing))
+    height = 640
+    chart_height = height - margin - bottom
+    max_time = max(max(c["p99"], c["median"]) for c in cases) or 1.0
+
+    def scale_y(val):
+        return margin + chart_height - (val / max_time * chart_height)
+
+    groups = list(dict.fromkeys(c["group"] for c in cases))
+    def color(i, case):
+        return COLORS[(groups.index(case["group"]) if len(groups) > 1 else i) % len(COLORS)]
+
+    items = {c["items"] for c in cases}
+    reps = {c["reps"] for c in cases}
+    subtitle = "median per iteration, p99 whisker"
+    if len(items) == 1 and None not in items:
+        subtitle += f" | {next(iter(items)):g} items per iteration"
+    if len(reps) == 1 and None not in reps:
+        subtitle += f" | {next(iter(reps))} reps"
+
+    with open(filename, "w") as f:
+        f.write(f'<svg width="{width}" height="{height}" xmlns="http://www.w3.org/2000/svg">\n')
+        f.write('<rect width="100%" height="100%" fill="#ffffff"/>\n')
+        f.write(f'<text x="{width // 2}" y="45" text-anchor="middle" font-family="sans-serif" font-size="24" font-weight="bold">{escape(suite)}</text>\n')
+        f.write(f'<text x="{width // 2}" y="70" text-anchor="middle" font-family="sans-serif" font-size="14" fill="#666">{escape(subtitle)}</text>\n')
+
+        # Grid lines and Y-axis labels
+        for i in range(5):
+            y_val = max_time * i / 4
+            y_pos = scale_y(y_val)
+            f.write(f'<line x1="{margin}" y1="{y_pos}" x2="{width - margin}" y2="{y_pos}" stroke="#eee" />\n')
+            f.write(f'<text x="{margin - 10}" y="{y_pos + 5}" text-anchor="end" font-family="sans-serif" font-size="12" fill="#999">{y_val:.3g} us</text>\n')
+
+        # Bars, p99 whiskers, values, names and speedups
+        base = margin + chart_height
+        for i, case in enumerate(cases):
+            x = margin + i * (bar_width + spacing) + spacing // 2
+            cx = x + bar_width // 2
+            y = scale_y(case["median"])
+            c = color(i, case)
+            f.write(f'<rect x="{x}" y="{y}" width="{bar_width}" height="{base - y}" fill="{c}" rx="5"/>\n')
+            if case["p99"] > case["median"]:
+                yp = scale_y(case["p99"])
+                f.write(f'<line x1="{cx}" y1="{y}" x2="{cx}" y2="{yp}" stroke="#333"/>\n')
+                f.write(f'<line x1="{cx - 8}" y1="{yp}" x2="{cx + 8}" y2="{yp}" stroke="#333"/>\n')
+            f.write(f'<text x="{cx}" y="{scale_y(max(case["p99"], case["median"])) - 8}" text-anchor="middle" font-family="sans-serif" font-size="12" font-weight="bold" fill="{c}">{case["median"]:.3f} us</text>\n')
+            label = "baseline" if case["speedup"] == 1.0 else (f'{case["speedup"]:.2f}x' if case["speedup"] else "")
+            f.write(f'<text x="{cx}" y="{base + 18}" text-anchor="middle" font-family="sans-serif" font-size="12" fill="#666">{label}</text>\n')
+            f.write(f'<text x="{cx}" y="{base + 34}" text-anchor="end" transform="rotate(-35 {cx} {base + 34})" font-family="sans-serif" font-size="13" font-weight="bold">{escape(case["name"])}</text>\n')
+
+        # X-axis line
+        f.write(f'<line x1="{margin}" y1="{base}" x2="{width - margin}" y2="{base}" stroke="#ccc" stroke-width="2"/>\n')
+        f.write('</svg>\n')
+
+
+def main():
+    suites = sys.argv[1:] or sorted(os.path.basename(p)[:-len("_results.csv")]
+                                    for p in glob.glob(os.path.join(LOG_DIR, "perf_*_results.csv")))
+    if not suites:
+        print(f"No perf_*_results.csv in {LOG_DIR}. Run a perf_*_test first (from project root).", file=sys.stderr)
+        return 1
+
+    status = 0
+    for suite in suites:
+        csv_file = os.path.join(LOG_DIR, f"{suite}_results.csv")
+        if not os.path.exists(csv_file):
+            print(f"Error: {csv_file} not found. Run {suite}_test first (from project root).", file=sys.stderr)
+            status = 1
+            continue
+        cases = read_results(csv_file)
+        if not cases:
+            print(f"Error: no cases in {csv_file}", file=sys.stderr)
+            status = 1
+            continue
+        output_file = os.path.join(LOG_DIR, f"{suite}_visualization.svg")
+        generate_svg(suite, cases, output_file)
+        print(f"Wrote {output_file} from {csv_file}")
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,8 +1,8 @@
 #!/usr/bin/env python3
 """Chronos DelayEngine performance visualization.
 
-Reads tests/perf_harness/logs/delay_perf.csv (written by
-perf_delay_engine_test) and produces a PNG summarizing how much faster
+Reads tests/perf_harness/logs/delay_perf_results.csv (written by
+perf_delay_engine_test in the bench.h schema) and produces a PNG summarizing how much faster
 the Chronos SIMD engine is than the naive + JUCE dsp baselines across
 block sizes.
 
@@ -11,6 +11,12 @@ Two subplots:
   * Bottom: realtime factor. Higher is better.
 
 Both include a speedup annotation (chronos vs. each baseline).
+
+When tests/perf_harness/logs/delay_matrix_results.csv exists (written by
+perf_delay_matrix_test) it also draws delay_matrix_bs<N>.png per block
+size: ns/sample heatmaps of sample rate vs. delay time, one panel per
+channel mode and feedback amount, and prints the operating points that
+cost more than CLIFF_RATIO times the shortest delay at the same settings.
 """
 import os
 import sys
@@ -20,8 +26,11 @@ import matplotlib.pyplot as plt
 import numpy as np
 
 LOG_DIR = "tests/perf_harness/logs"
-CSV_PATH = os.path.join(LOG_DIR, "delay_perf.csv")
+CSV_PATH = os.path.join(LOG_DIR, "delay_perf_results.csv")
 OUT_PATH = os.path.join(LOG_DIR, "delay_perf.png")
+MATRIX_CSV_PATH = os.path.join(LOG_DIR, "delay_matrix_results.csv")
+MATRIX_OUT_PATTERN = os.path.join(LOG_DIR, "delay_matrix_bs{}.png")
+CLIFF_RATIO = 1.25
 
 ENGINE_ORDER = ["chronos", "juce_dsp", "naive_scalar"]
 ENGINE_COLOR = {
@@ -32,12 +41,34 @@ ENGINE_COLOR = {
 MODE_PREF = "stereo"  # prefer stereo where multiple modes exist
 
 
+def read_bench_csv(path, numeric_tags=()):
+    """bench.h rows: one block per iteration, engine / mode / block size /
+    sample rate (and whatever else the benchmark tagged) in the tags."""
+    df = pd.read_csv(path, keep_default_na=False)
+    tags = df["tags"].apply(lambda t: dict(kv.split("=", 1) for kv in t.split(";") if kv))
+    for key in ("engine", "mode"):
+        df[key] = tags.map(lambda t: t[key])
+    df["block_size"] = tags.map(lambda t: int(t["block_size"]))
+    for key in ("sample_rate",) + tuple(numeric_tags):
+        df[key] = tags.map(lambda t: float(t[key]))
+    df["ns_per_sample"] = df["median_ns"].astype(float) / df["items"].astype(float)
+    df["realtime_factor"] = df["items_per_s"].astype(float) / df["sample_rate"]
+    return df
+
+
 def main():
-    if not os.path.exists(CSV_PATH):
+    have_engine = os.path.exists(CSV_PATH)
+    have_matrix = os.path.exists(MATRIX_CSV_PATH)
+    if not have_engine and not have_matrix:
         print(f"CSV not found: {CSV_PATH}. Run perf_delay_engine_test first.", file=sys.stderr)
         sys.exit(1)
+    if have_engine:
+        plot_engines(read_bench_csv(CSV_PATH))
+    if have_matrix:
+        plot_matrix(read_bench_csv(MATRIX_CSV_PATH, ("delay_ms", "feedback")))
 
-    df = pd.read_csv(CSV_PATH)
+
+def plot_engines(df):
 
     # For the headline chart, focus on stereo-vs-stereo, but also capture
     # chronos-mono as a side bar.
@@ -134,5 +165,71 @@ def main():
     print(f"Wrote {OUT_PATH}")
 
 
+def plot_matrix(df):
+    """Heatmaps of ns/sample over sample rate x delay time, one figure per
+    block size, panels by channel mode (rows) and feedback (columns), on
+    one shared color scale per figure so the cliffs stand out."""
+    modes = [m for m in ("mono", "stereo") if m in df["mode"].unique()]
+    feedbacks = sorted(df["feedback"].unique())
+    rates = sorted(df["sample_rate"].unique())
+    delays = sorted(df["delay_ms"].unique())
+
+    for bs in sorted(df["block_size"].unique()):
+        sub = df[df["block_size"] == bs]
+        vmin, vmax = sub["ns_per_sample"].min(), sub["ns_per_sample"].max()
+
+        fig, axes = plt.subplots(len(modes), len(feedbacks), squeeze=False,
+                                 figsize=(4.2 * len(feedbacks) + 1.5, 3.2 * len(modes) + 0.8))
+        image = None
+        for r, mode in enumerate(modes):
+            for c, fb in enumerate(feedbacks):
+                ax = axes[r][c]
+                cell = sub[(sub["mode"] == mode) & (sub["feedback"] == fb)]
+                grid = cell.pivot_table(index="sample_rate", columns="delay_ms",
+                                        values="ns_per_sample", aggfunc="mean")
+                grid = grid.reindex(index=rates, columns=delays)
+                image = ax.imshow(grid.values, origin="lower", aspect="auto", cmap="magma_r",
+                                  vmin=vmin, vmax=vmax)
+                for (i, j), v in np.ndenumerate(grid.values):
+                    if np.isfinite(v):
+                        ax.text(j, i, f"{v:.1f}", ha="center", va="center", fontsize=7,
+                                color="white" if v > (vmin + vmax) / 2 else "black")
+                    else:
+                        # skipped by the test: past the engine's ring buffer
+                        ax.text(j, i, "n/a", ha="center", va="center", fontsize=7, color="#888")
+                ax.set_xticks(range(len(delays)))
+                ax.set_xticklabels([f"{d:g}" for d in delays], fontsize=8)
+                ax.set_yticks(range(len(rates)))
+                ax.set_yticklabels([f"{sr / 1000:g}k" for sr in rates], fontsize=8)
+                ax.set_title(f"{mode}, feedback {fb:g}", fontsize=10)
+                if r == len(modes) - 1:
+                    ax.set_xlabel("delay time (ms)")
+                if c == 0:
+                    ax.set_ylabel("sample rate (Hz)")
+
+        fig.suptitle(f"Chronos DelayEngine ns per sample, block size {bs}  (lower is better)")
+        fig.colorbar(image, ax=axes, label="ns per sample", shrink=0.9)
+        out_path = MATRIX_OUT_PATTERN.format(bs)
+        plt.savefig(out_path, dpi=150)
+        plt.close()
+        print(f"Wrote {out_path}")
+
+    # cliffs: points costing CLIFF_RATIO x the shortest delay at the same
+    # sample rate, mode, feedback and block size
+    keys = ["sample_rate", "mode", "feedback", "block_size"]
+    shortest = df.loc[df.groupby(keys)["delay_ms"].idxmin(), keys + ["ns_per_sample"]]
+    merged = df.merge(shortest, on=keys, suffixes=("", "_shortest"))
+    merged["ratio"] = merged["ns_per_sample"] / merged["ns_per_sample_shortest"]
+    cliffs = merged[merged["ratio"] > CLIFF_RATIO].sort_values("ratio", ascending=False)
+    if cliffs.empty:
+        print(f"No operating point above {CLIFF_RATIO:g}x the shortest delay's ns/sample.")
+    else:
+        print(f"Operating points above {CLIFF_RATIO:g}x the shortest delay's ns/sample:")
+        for _, row in cliffs.iterrows():
+            print(f"  {row['sample_rate'] / 1000:g} kHz  {row['delay_ms']:g} ms  fb {row['feedback']:g}  "
+                  f"{row['mode']:<6}  bs {row['block_size']:<5}  {row['ns_per_sample']:.2f} ns/sample  "
+                  f"({row['ratio']:.2f}x)")
+
+
 if __name__ == "__main__":
     main()
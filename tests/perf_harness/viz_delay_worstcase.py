@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Chronos DelayEngine worst-case block latency visualization.
+
+Reads the logs perf_delay_worstcase_test writes to tests/perf_harness/logs/
+and produces delay_worstcase.png:
+
+  * Top left:     block-time histogram per block size, as a fraction of the
+                  block's deadline (log x). Everything right of 1.0 is a
+                  dropout.
+  * Top right:    median / p99 / p99.9 / max per block size, again as a
+                  fraction of the deadline.
+  * Bottom:       p99.9 per kind of change relative to the untouched
+                  ("none") blocks, one group per block size - which
+                  automation makes blocks slow.
+"""
+import os
+import sys
+
+import pandas as pd
+import matplotlib.pyplot as plt
+import numpy as np
+
+LOG_DIR = "tests/perf_harness/logs"
+SUMMARY_PATH = os.path.join(LOG_DIR, "delay_worstcase_summary.csv")
+HIST_PATH = os.path.join(LOG_DIR, "delay_worstcase_histogram.csv")
+FLAGS_PATH = os.path.join(LOG_DIR, "delay_worstcase_flags.csv")
+OUT_PATH = os.path.join(LOG_DIR, "delay_worstcase.png")
+
+STATS = [
+    ("median_us", "median", "#2b8a3e"),
+    ("p99_us",    "p99",    "#1971c2"),
+    ("p999_us",   "p99.9",  "#e67700"),
+    ("max_us",    "max",    "#c92a2a"),
+]
+
+
+def main():
+    for path in (SUMMARY_PATH, HIST_PATH, FLAGS_PATH):
+        if not os.path.exists(path):
+            print(f"CSV not found: {path}. Run perf_delay_worstcase_test first.", file=sys.stderr)
+            sys.exit(1)
+
+    summary = pd.read_csv(SUMMARY_PATH)
+    hist = pd.read_csv(HIST_PATH)
+    flags = pd.read_csv(FLAGS_PATH)
+
+    block_sizes = sorted(summary["block_size"].unique())
+    colors = plt.cm.viridis(np.linspace(0.0, 0.9, len(block_sizes)))
+
+    fig = plt.figure(figsize=(14, 10))
+    grid = fig.add_gridspec(2, 2)
+    ax_hist = fig.add_subplot(grid[0, 0])
+    ax_stats = fig.add_subplot(grid[0, 1])
+    ax_flags = fig.add_subplot(grid[1, :])
+
+    # -- Histogram of block time / deadline ------------------------------------
+    for bs, color in zip(block_sizes, colors):
+        h = hist[hist["block_size"] == bs]
+        centers = np.sqrt(h["bin_lo_load"] * h["bin_hi_load"])
+        fraction = h["count"] / max(h["count"].sum(), 1)
+        ax_hist.step(centers, fraction.where(fraction > 0), where="mid", color=color, label=f"{bs}")
+    ax_hist.axvline(1.0, color="black", linestyle="--", linewidth=1)
+    ax_hist.set_xscale("log")
+    ax_hist.set_yscale("log")
+    ax_hist.set_xlabel("block time / deadline")
+    ax_hist.set_ylabel("fraction of blocks")
+    ax_hist.set_title("Block time distribution")
+    ax_hist.grid(True, which="both", alpha=0.3)
+    ax_hist.legend(title="block size", fontsize=8)
+
+    # -- Tail statistics per block size ----------------------------------------
+    x = np.arange(len(block_sizes))
+    budget = summary.set_index("block_size").loc[block_sizes, "budget_us"]
+    for column, label, color in STATS:
+        values = summary.set_index("block_size").loc[block_sizes, column] / budget
+        ax_stats.plot(x, values, marker="o", label=label, color=color)
+    ax_stats.axhline(1.0, color="black", linestyle="--", linewidth=1, label="deadline")
+    ax_stats.set_yscale("log")
+    ax_stats.set_xticks(x)
+    ax_stats.set_xticklabels([str(b) for b in block_sizes])
+    ax_stats.set_xlabel("block size (samples)")
+    ax_stats.set_ylabel("fraction of deadline  (lower is better)")
+    ax_stats.set_title("Tail latency vs. deadline")
+    ax_stats.grid(True, which="both", alpha=0.3)
+    ax_stats.legend(fontsize=8)
+
+    overruns = int(summary["overruns"].sum())
+    worst = summary["max_load"].max()
+    ax_stats.text(0.01, 0.98, f"worst block: {worst:.3f} of its deadline\noverruns: {overruns}",
+                  transform=ax_stats.transAxes, va="top", ha="left", fontsize=10,
+                  bbox=dict(boxstyle="round", facecolor="white", edgecolor="#888", alpha=0.9))
+
+    # -- p99.9 per kind of change, relative to untouched blocks ----------------
+    kinds = [k for k in flags["flag"].unique() if k not in ("none", "all")]
+    bar_w = 0.8 / len(block_sizes)
+    xk = np.arange(len(kinds))
+    for i, (bs, color) in enumerate(zip(block_sizes, colors)):
+        f = flags[flags["block_size"] == bs].set_index("flag")
+        floor = f.loc["none", "p999_us"] if "none" in f.index else np.nan
+        ratio = [f.loc[k, "p999_us"] / floor if k in f.index else np.nan for k in kinds]
+        ax_flags.bar(xk + i * bar_w, ratio, bar_w, color=color, label=f"{bs}",
+                     edgecolor="black", linewidth=0.3)
+    ax_flags.axhline(1.0, color="black", linewidth=1)
+    ax_flags.set_xticks(xk + bar_w * (len(block_sizes) - 1) / 2)
+    ax_flags.set_xticklabels(kinds, rotation=30, ha="right")
+    ax_flags.set_ylabel("p99.9 / p99.9 of untouched blocks")
+    ax_flags.set_title("Which automation makes blocks slow")
+    ax_flags.grid(True, axis="y", alpha=0.3)
+    ax_flags.legend(title="block size", fontsize=8, ncol=len(block_sizes))
+
+    plt.tight_layout()
+    plt.savefig(OUT_PATH, dpi=150)
+    plt.close()
+    print(f"Wrote {OUT_PATH}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,6 +1,6 @@
 // Chronos DelayEngine functional test matrix.
 //
-// Runs seven classes of tests and emits a CSV per class for matplotlib
+// Runs eleven classes of tests and emits a CSV per class for matplotlib
 // visualization (tests/simd_harness/logs/func_*.csv). Overall pass/fail is
 // returned as the process exit code; individual tests are "soft" asserts
 // that record their outcome and continue so we capture the full picture.
@@ -13,6 +13,16 @@
 //   [5]  Mono/stereo switching    -> func_mode_switch.csv
 //   [6]  reset() state clear      -> func_reset.csv
 //   [7]  Streaming-version stub   -> func_streaming.csv
+//   [8]  LFO modulation           -> func_modulation.csv
+//   [9]  Sample-accurate events   -> func_events.csv
+//   [10] Preset cross-ramp        -> func_cross_ramp.csv
+//   [11] Jump delay-time mode     -> func_jump_mode.csv
+//   [12] Real-time safety         -> func_rt_safety.csv
+//
+// Every process() call, and the setters the processor calls on the audio
+// thread, runs inside an RtGuard::ScopedRealtime (rt_guard.h): an
+// allocation, lock or blocking syscall anywhere under it is printed with a
+// backtrace as it happens and fails [12].
 //
 // Pair with viz_delay_functional.py for the dashboard.
 #include <iostream>
@@ -22,12 +32,22 @@
 #include <random>
 #include <string>
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <filesystem>
 #include <fstream>
 #include <limits>
+#include <mutex>
+#include <thread>
 
 #include <JuceHeader.h>
 #include "dsp/engine/delay/delay_engine.h"
+#include "dsp/engine/delay/param_event_scheduler.h"
+#include "dsp/engine/metering/load_meter.h"
+#include "dsp/engine/metering/spectrum_analyzer.h"
+#include "utils/helpers/spsc_ring.h"
+#include "BlockParameters.h"
+#include "rt_guard.h"
 
 using namespace MarsDSP::DSP;
 namespace fs = std::filesystem;
@@ -132,6 +152,7 @@ static std::unique_ptr<DelayEngine<float>> makeEngine(
 static void processN(DelayEngine<float>& e, juce::AudioBuffer<float>& buf, int n)
 {
     juce::dsp::AudioBlock<float> block(buf);
+    const RtGuard::ScopedRealtime rt;
     e.process(block, n);
 }
 
@@ -210,7 +231,11 @@ static void testExtremeParams()
         juce::AudioBuffer<float> buf(2, bs);
         bool ok = true;
         for (int i = 0; i < steps; ++i) {
-            const float paramVal = perStep(*e, i, steps);
+            float paramVal;
+            {
+                const RtGuard::ScopedRealtime rt;
+                paramVal = perStep(*e, i, steps);
+            }
             fillNoise(buf, rng, 0.2f);
             processN(*e, buf, bs);
             const bool stepOk = finiteAndBounded(buf, 32.0f);
@@ -354,7 +379,10 @@ static void testMonoStereoSwitching()
     bool ok = true;
     for (int i = 0; i < 200; ++i) {
         const bool doSwitch = (i % 17) == 0;
-        if (doSwitch) e->setMono(!e->isMono());
+        if (doSwitch) {
+            const RtGuard::ScopedRealtime rt;
+            e->setMono(!e->isMono());
+        }
         fillNoise(buf, rng);
         processN(*e, buf, 512);
         const bool stepOk = finiteAndBounded(buf);
@@ -403,6 +431,495 @@ static void testStreamingVersion()
     EXPECT(versionOk, "streamingVersion must be >= 1");
 }
 
+// --------------------------------------------------------------------- [8]
+static void testModulation()
+{
+    std::cout << "\n[8] LFO modulation of delay time and feedback\n";
+    const double sr = 48000.0;
+    const int bs = 512;
+    auto csv = openCsv("func_modulation.csv",
+                       "shape,synced,depth_ms,max_diff_vs_static,peak,passed");
+
+    const char* shapeNames[] = { "sine", "triangle", "random" };
+    for (int shape = 0; shape < 3; ++shape) {
+        for (int synced = 0; synced < 2; ++synced) {
+            for (const float depthMs : { 0.0f, 8.0f }) {
+                auto ref = makeEngine(sr, bs);
+                auto mod = makeEngine(sr, bs);
+                mod->setModShape(static_cast<LfoShape>(shape));
+                mod->setModRateParam(3.0f);
+                mod->setModDepthParam(depthMs);
+                mod->setModFeedbackParam(depthMs > 0.0f ? 0.5f : 0.0f);
+                mod->setModSync(synced == 1, MarsDSP::SyncDivision::Eighth);
+
+                juce::AudioBuffer<float> bufRef(2, bs), bufMod(2, bs);
+                std::mt19937 rng(1234);
+                bool finite = true;
+                float maxDiff = 0.0f, peak = 0.0f;
+                for (int i = 0; i < 200; ++i) {
+                    // 128 bpm transport, ppq at the start of each block
+                    mod->setHostTempo(128.0, i * bs * 128.0 / (60.0 * sr), true);
+                    fillNoise(bufRef, rng);
+                    bufMod.makeCopyOf(bufRef);
+                    processN(*ref, bufRef, bs);
+                    processN(*mod, bufMod, bs);
+                    if (!finiteAndBounded(bufMod)) { finite = false; break; }
+                    peak = std::max(peak, bufferPeak(bufMod));
+                    for (int c = 0; c < 2; ++c)
+                        for (int n = 0; n < bs; ++n)
+                            maxDiff = std::max(maxDiff, std::abs(bufMod.getSample(c, n) - bufRef.getSample(c, n)));
+                }
+
+                // zero depth must leave the engine bit-identical, any depth must move it
+                const bool ok = finite && (depthMs == 0.0f ? maxDiff == 0.0f : maxDiff > 1.0e-3f);
+                csv << shapeNames[shape] << "," << synced << "," << depthMs << "," << maxDiff << ","
+                    << peak << "," << (ok ? 1 : 0) << "\n";
+                EXPECT(ok, shapeNames[shape] << (synced ? " synced" : " free") << " depth=" << depthMs
+                           << "ms: maxDiff=" << maxDiff << (finite ? "" : " (non-finite)"));
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------- [9]
+static void testSampleAccurateEvents()
+{
+    std::cout << "\n[9] Sample-accurate parameter events\n";
+    const double sr = 48000.0;
+    const int bs = 1024;
+    auto csv = openCsv("func_events.csv", "case,offset,max_diff_vs_split,passed");
+
+    // reference: the same block rendered as two process() calls around the
+    // quad-aligned split, with the setter in between. Two calls are two host
+    // blocks to the LFOs and the duck, so both stay idle here (no
+    // modulation, fixed delay time); the next case covers them.
+    auto render = [&](int offset, bool useEvents) {
+        auto e = makeEngine(sr, bs, false, 120.0f, 0.0f, 0.6f);
+        e->reset();     // settle on the knobs: no glide or duck from the defaults
+        juce::AudioBuffer<float> buf(2, bs);
+        std::vector<float> out;
+        std::mt19937 rng(77);
+        for (int b = 0; b < 24; ++b) {
+            fillNoise(buf, rng);
+            juce::dsp::AudioBlock<float> block(buf);
+            const float mix = (b & 1) ? 1.0f : 0.0f;
+            const float fb  = (b & 1) ? 0.2f : 0.6f;
+            {
+                const RtGuard::ScopedRealtime rt;
+                e->setHostTempo(140.0, b * bs * 140.0 / (60.0 * sr), true);
+                if (useEvents) {
+                    const ParamEvent events[] = { { offset, EngineParam::Mix, mix },
+                                                  { std::min(offset + 1, bs - 1), EngineParam::Feedback, fb } };
+                    e->process(block, bs, events, 2);
+                } else {
+                    const int split = offset & ~3;
+                    if (split > 0) e->process(block.getSubBlock(0, static_cast<size_t>(split)), split);
+                    e->setMixParam(mix);
+                    e->setFeedbackParam(fb);
+                    e->process(block.getSubBlock(static_cast<size_t>(split), static_cast<size_t>(bs - split)), bs - split);
+                }
+            }
+            for (int c = 0; c < 2; ++c)
+                out.insert(out.end(), buf.getReadPointer(c), buf.getReadPointer(c) + bs);
+        }
+        return out;
+    };
+    auto maxDiff = [](const std::vector<float>& a, const std::vector<float>& b) {
+        float d = 0.0f;
+        for (size_t i = 0; i < a.size(); ++i) d = std::max(d, std::abs(a[i] - b[i]));
+        return d;
+    };
+
+    for (const int offset : { 0, 4, 513, 514, 1020, 1023 }) {
+        const float d = maxDiff(render(offset, true), render(offset, false));
+        const bool ok = d == 0.0f;
+        csv << "split," << offset << "," << d << "," << (ok ? 1 : 0) << "\n";
+        EXPECT(ok, "event at " << offset << " must match a split at " << (offset & ~3) << ": maxDiff=" << d);
+    }
+
+    // the offset has to matter: mid-block events are not applied at the block start
+    const float d = maxDiff(render(512, true), render(0, true));
+    csv << "timing,512," << d << "," << (d > 1.0e-3f ? 1 : 0) << "\n";
+    EXPECT(d > 1.0e-3f, "event at 512 vs 0 should differ: maxDiff=" << d);
+
+    // block-rate state steps once per host block however many events split
+    // it: with the delay knob moving every block (ducking) and synced
+    // modulation running, events that leave every value where it is must
+    // not change the duck envelope
+    auto duckEnvelope = [&](int numEvents) {
+        auto e = makeEngine(sr, bs, false, 120.0f, 0.5f, 0.6f);
+        e->setModDepthParam(4.0f);
+        e->setModFeedbackParam(0.3f);
+        e->setModSync(true, MarsDSP::SyncDivision::Sixteenth);
+        juce::AudioBuffer<float> buf(2, bs);
+        std::vector<float> envelope;
+        std::mt19937 rng(78);
+        std::vector<ParamEvent> events;
+        for (int i = 0; i < numEvents; ++i)
+            events.push_back({ (i + 1) * bs / (numEvents + 1), EngineParam::Mix, 0.5f });
+        for (int b = 0; b < 48; ++b) {
+            fillNoise(buf, rng);
+            juce::dsp::AudioBlock<float> block(buf);
+            {
+                const RtGuard::ScopedRealtime rt;
+                e->setHostTempo(140.0, b * bs * 140.0 / (60.0 * sr), true);
+                e->setDelayTimeParam(b < 24 ? 120.0f + 40.0f * static_cast<float>(b) : 300.0f);
+                e->process(block, bs, events.data(), static_cast<int>(events.size()));
+            }
+            DelayTelemetry t {};
+            e->measure(block, bs, t);
+            envelope.push_back(t.duckGain);
+        }
+        return envelope;
+    };
+    const auto envelope0 = duckEnvelope(0);
+    const float minDuck  = *std::min_element(envelope0.begin(), envelope0.end());
+    for (const int n : { 1, 7, 63 }) {
+        const float dd = maxDiff(envelope0, duckEnvelope(n));
+        const bool ok  = dd < 1.0e-4f && minDuck < 0.99f;
+        csv << "duck_envelope," << n << "," << dd << "," << (ok ? 1 : 0) << "\n";
+        EXPECT(ok, n << " events must leave the duck envelope alone: maxDiff=" << dd << " (min duck " << minDuck << ")");
+    }
+}
+
+// -------------------------------------------------------------------- [10]
+static void testCrossRamp()
+{
+    std::cout << "\n[10] Preset cross-ramp\n";
+    const double sr = 48000.0;
+    const int bs = 64;
+    const int switchBlock = 100, numBlocks = 1500;
+    const int start = switchBlock * bs;
+    auto csv = openCsv("func_cross_ramp.csv", "case,kink_instant,kink_cross_ramp,mid_diff,settle_diff,passed");
+
+    // a 200 Hz sine, then the preset's parameters all move at once.
+    // instant = the usual one-block ramps
+    struct Case { const char* name; float mixFrom, mix, fb, lowCut, highCut, crossfeed; };
+    const Case cases[] = {
+        { "mix_feedback", 0.0f, 1.0f, 0.5f, 20.0f,  20000.0f, 0.3f },
+        { "cutoffs",      1.0f, 1.0f, 0.3f, 400.0f, 3000.0f,  0.0f },
+    };
+
+    auto render = [&](const Case& c, bool crossRamp, double phase) {
+        auto e = makeEngine(sr, bs, false, 121.25f, c.mixFrom, 0.3f);
+        e->reset();     // start from settled smoothers
+        juce::AudioBuffer<float> buf(2, bs);
+        std::vector<float> out;
+        for (int b = 0; b < numBlocks; ++b) {
+            if (b == switchBlock) {
+                const RtGuard::ScopedRealtime rt;
+                if (crossRamp) e->startCrossRamp(50.0f);
+                e->setMixParam(c.mix);
+                e->setFeedbackParam(c.fb);
+                e->setLowCutParam(c.lowCut);
+                e->setHighCutParam(c.highCut);
+                e->setCrossfeedParam(c.crossfeed);
+            }
+            for (int ch = 0; ch < 2; ++ch)
+                for (int n = 0; n < bs; ++n)
+                    buf.setSample(ch, n, 0.5f * static_cast<float>(std::sin(2.0 * M_PI * 200.0 * (b * bs + n) / sr + phase)));
+            processN(*e, buf, bs);
+            out.insert(out.end(), buf.getReadPointer(0), buf.getReadPointer(0) + bs);
+        }
+        return out;
+    };
+    // largest second difference from just before the switch to 60 ms after
+    auto maxKink = [&](const std::vector<float>& y) {
+        float k = 0.0f;
+        for (int n = start - bs; n < start + static_cast<int>(0.060 * sr); ++n)
+            k = std::max(k, std::abs(y[static_cast<size_t>(n)] - 2.0f * y[static_cast<size_t>(n - 1)] + y[static_cast<size_t>(n - 2)]));
+        return k;
+    };
+    auto maxDiff = [](const std::vector<float>& a, const std::vector<float>& b, int from, int to) {
+        float d = 0.0f;
+        for (int n = from; n < to; ++n) d = std::max(d, std::abs(a[static_cast<size_t>(n)] - b[static_cast<size_t>(n)]));
+        return d;
+    };
+
+    for (const auto& c : cases) {
+        // a step lands wherever the sine happens to be, so take the worst of several phases
+        float kinkInstant = 0.0f, kinkRamped = 0.0f, midDiff = 1.0e30f, settleDiff = 0.0f;
+        for (int p = 0; p < 8; ++p) {
+            const double phase = p * M_PI / 8.0;
+            const auto instant = render(c, false, phase);
+            const auto ramped  = render(c, true,  phase);
+            kinkInstant = std::max(kinkInstant, maxKink(instant));
+            kinkRamped  = std::max(kinkRamped,  maxKink(ramped));
+
+            // still mid-glide 10 ms in, then both land on the same settings
+            // without the buffers having been cleared
+            midDiff    = std::min(midDiff, maxDiff(ramped, instant, start + static_cast<int>(0.010 * sr), start + static_cast<int>(0.012 * sr)));
+            settleDiff = std::max(settleDiff, maxDiff(ramped, instant, (numBlocks - 50) * bs, numBlocks * bs));
+        }
+
+        const bool smoother = kinkRamped < 0.5f * kinkInstant;
+        const bool gliding  = midDiff > 1.0e-2f;
+        const bool settled  = settleDiff < 1.0e-3f;
+        csv << c.name << "," << kinkInstant << "," << kinkRamped << "," << midDiff << "," << settleDiff << ","
+            << ((smoother && gliding && settled) ? 1 : 0) << "\n";
+        EXPECT(smoother, c.name << ": cross-ramp kink " << kinkRamped << " should be well under instant " << kinkInstant);
+        EXPECT(gliding,  c.name << ": cross-ramp should still differ from instant 10 ms in: maxDiff=" << midDiff);
+        EXPECT(settled,  c.name << ": cross-ramp should settle onto the instant render: maxDiff=" << settleDiff);
+    }
+}
+
+// -------------------------------------------------------------------- [11]
+static void testJumpMode()
+{
+    std::cout << "\n[11] Jump delay-time mode\n";
+    const double sr = 48000.0;
+    const int bs = 128;
+    const int switchBlock = 100, numBlocks = 300;
+    const int start = switchBlock * bs;
+    const float fadeMs = 20.0f;
+    auto csv = openCsv("func_jump_mode.csv", "case,value,passed");
+
+    // wet-only 500 Hz sine, fb 0, the time moves 100 → 250 ms at the switch
+    auto render = [&](DelayTimeMode mode, bool moveTime) {
+        auto e = makeEngine(sr, bs, false, 100.0f, 1.0f, 0.0f);
+        e->setDelayTimeMode(mode);
+        e->setJumpFadeMs(fadeMs);
+        e->reset();
+        juce::AudioBuffer<float> buf(2, bs);
+        std::vector<float> out;
+        for (int b = 0; b < numBlocks; ++b) {
+            if (b == switchBlock && moveTime) {
+                const RtGuard::ScopedRealtime rt;
+                e->setDelayTimeParam(250.0f);
+            }
+            for (int ch = 0; ch < 2; ++ch)
+                for (int n = 0; n < bs; ++n)
+                    buf.setSample(ch, n, 0.5f * static_cast<float>(std::sin(2.0 * M_PI * 500.0 * (b * bs + n) / sr)));
+            processN(*e, buf, bs);
+            out.insert(out.end(), buf.getReadPointer(0), buf.getReadPointer(0) + bs);
+        }
+        return out;
+    };
+    // largest deviation of the upward zero-crossing interval from the 96-sample period
+    auto maxPeriodError = [&](const std::vector<float>& y, int from, int to) {
+        double last = -1.0, err = 0.0;
+        for (int n = from; n < to; ++n) {
+            if (y[static_cast<size_t>(n - 1)] < 0.0f && y[static_cast<size_t>(n)] >= 0.0f) {
+                const double t = (n - 1) + y[static_cast<size_t>(n - 1)] / (y[static_cast<size_t>(n - 1)] - y[static_cast<size_t>(n)]);
+                if (last >= 0.0) err = std::max(err, std::abs((t - last) - sr / 500.0));
+                last = t;
+            }
+        }
+        return err;
+    };
+
+    // steady state: both modes read one head at the same spot. What's left is
+    // glide's duck, which never quite releases back to unity.
+    {
+        const auto glide = render(DelayTimeMode::Glide, false);
+        const auto jump  = render(DelayTimeMode::Jump,  false);
+        float d = 0.0f;
+        for (size_t n = static_cast<size_t>(start) / 2; n < glide.size(); ++n)
+            d = std::max(d, std::abs(glide[n] - jump[n]));
+        const bool ok = d < 2.0e-3f;
+        csv << "steady_vs_glide," << d << "," << (ok ? 1 : 0) << "\n";
+        EXPECT(ok, "jump mode with a fixed time should match glide: maxDiff=" << d);
+    }
+
+    const auto glide = render(DelayTimeMode::Glide, true);
+    const auto jump  = render(DelayTimeMode::Jump,  true);
+
+    // glide bends the pitch on the way to the new time, jump holds it
+    const float window = 0.3f;
+    const double glideErr = maxPeriodError(glide, start, start + static_cast<int>(window * sr));
+    const double jumpErr  = maxPeriodError(jump,  start, start + static_cast<int>(window * sr));
+    const bool noGlide = jumpErr < 0.25 * glideErr && jumpErr < 1.0;
+    csv << "period_error_glide," << glideErr << ",1\n";
+    csv << "period_error_jump," << jumpErr << "," << (noGlide ? 1 : 0) << "\n";
+    EXPECT(noGlide, "jump pitch error " << jumpErr << " samples should be well under glide " << glideErr);
+
+    // once the fade is over the output is the new tap: compare against a jump
+    // engine that sat at 250 ms all along
+    {
+        auto e = makeEngine(sr, bs, false, 250.0f, 1.0f, 0.0f);
+        e->setDelayTimeMode(DelayTimeMode::Jump);
+        e->reset();
+        juce::AudioBuffer<float> buf(2, bs);
+        std::vector<float> ref;
+        for (int b = 0; b < numBlocks; ++b) {
+            for (int ch = 0; ch < 2; ++ch)
+                for (int n = 0; n < bs; ++n)
+                    buf.setSample(ch, n, 0.5f * static_cast<float>(std::sin(2.0 * M_PI * 500.0 * (b * bs + n) / sr)));
+            processN(*e, buf, bs);
+            ref.insert(ref.end(), buf.getReadPointer(0), buf.getReadPointer(0) + bs);
+        }
+        const int settled = start + static_cast<int>((fadeMs + 5.0f) * 0.001f * sr) + bs;
+        float d = 0.0f;
+        for (int n = settled; n < numBlocks * bs; ++n)
+            d = std::max(d, std::abs(jump[static_cast<size_t>(n)] - ref[static_cast<size_t>(n)]));
+        const bool ok = d < 1.0e-3f;
+        csv << "after_fade_vs_new_tap," << d << "," << (ok ? 1 : 0) << "\n";
+        EXPECT(ok, "after the fade, jump output should be the 250 ms tap: maxDiff=" << d);
+    }
+}
+
+// -------------------------------------------------------------------- [12]
+// The smallest AudioProcessor an APVTS can hang off, so ParameterBridge can
+// be attached the way ChronosProcessor attaches it.
+struct BridgeHost final : juce::AudioProcessor
+{
+    juce::AudioProcessorValueTreeState apvts { *this, nullptr, "Parameters", Chronos::createParameterLayout() };
+
+    const juce::String getName() const override { return "BridgeHost"; }
+    void prepareToPlay(double, int) override {}
+    void releaseResources() override {}
+    void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override {}
+    double getTailLengthSeconds() const override { return 0.0; }
+    bool acceptsMidi() const override { return false; }
+    bool producesMidi() const override { return false; }
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool hasEditor() const override { return false; }
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+    void getStateInformation(juce::MemoryBlock&) override {}
+    void setStateInformation(const void*, int) override {}
+};
+
+// Runs last: the sections above already processed every block under the
+// guard, so here the counts only have to be zero. Then the rest of what
+// ChronosProcessor::processBlock does on the audio thread with SharedCode
+// types (the processor itself only builds into the plugin): the metering
+// path, and the parameter path through Chronos::applyBlockParameters, the
+// same function processBlock calls. Finally a check that the guard does
+// trap what it claims to.
+static void testRealtimeSafety()
+{
+    std::cout << "\n[12] Real-time safety\n";
+    auto csv = openCsv("func_rt_safety.csv", "case,kind,violations,passed");
+    if (!RtGuard::kSupported) {
+        std::cout << "  skipped: the guard needs Linux / glibc without sanitizers\n";
+        csv << "unsupported,all,0,1\n";
+        return;
+    }
+
+    constexpr RtGuard::Kind kinds[] = { RtGuard::Kind::Alloc, RtGuard::Kind::Free,
+                                        RtGuard::Kind::Lock, RtGuard::Kind::Syscall };
+    auto snapshot = [&] {
+        std::array<uint64_t, std::size(kinds)> v {};
+        for (size_t k = 0; k < v.size(); ++k) v[k] = RtGuard::violations(kinds[k]);
+        return v;
+    };
+    auto expectClean = [&](const char* name, const auto& before) {
+        const auto after = snapshot();
+        for (size_t k = 0; k < after.size(); ++k) {
+            const uint64_t n = after[k] - before[k];
+            csv << name << "," << RtGuard::kindName(kinds[k]) << "," << n << "," << (n == 0 ? 1 : 0) << "\n";
+            EXPECT(n == 0, name << ": " << n << " " << RtGuard::kindName(kinds[k]) << " call(s) on the audio thread");
+        }
+    };
+
+    // ---- every block of sections [1] .. [11] ----
+    expectClean("functional_sweeps", std::array<uint64_t, std::size(kinds)> {});
+
+    // ---- processBlock's metering path: load meter, measure, telemetry ring, analyzer ----
+    {
+        const auto before = snapshot();
+        const double sr = 48000.0;
+        const int bs = 512;
+        auto e = makeEngine(sr, bs);
+        MarsDSP::DSP::LoadMeter loadMeter;
+        loadMeter.prepare(sr);
+        MarsDSP::SpscRing<DelayTelemetry, 256> telemetry;
+        MarsDSP::DSP::SpectrumAnalyzer analyzer;
+        analyzer.prepare(sr);
+        e->setWaveformHistoryEnabled(true);
+        juce::AudioBuffer<float> buf(2, bs);
+        std::mt19937 rng(4711);
+        for (int b = 0; b < 400; ++b) {
+            fillNoise(buf, rng);
+            const RtGuard::ScopedRealtime rt;
+            juce::ScopedNoDenormals noDenormals;
+            const MarsDSP::DSP::LoadMeter::ScopedBlock timing(loadMeter, bs);
+            const juce::dsp::AudioBlock<float> block(buf);
+            e->process(block, bs);
+            DelayTelemetry frame;
+            e->measure(block, bs, frame);
+            telemetry.push(frame);
+            analyzer.push(buf.getReadPointer(0), buf.getReadPointer(1), bs);
+        }
+        expectClean("processor_metering", before);
+    }
+
+    // ---- processBlock's parameter path: event collection, bridge poll / markDirty ----
+    {
+        const juce::ScopedJuceInitialiser_GUI juceInit;    // the APVTS starts a timer
+        const double sr = 48000.0;
+        const int bs = 256;
+        BridgeHost host;
+        Chronos::ParameterBridge params;
+        params.attach(host.apvts);
+        ParamEventScheduler<> scheduler;
+        auto e = makeEngine(sr, bs);
+        auto* mix = host.apvts.getParameter(Chronos::ParamID::kMix);
+        juce::AudioBuffer<float> buf(2, bs);
+        std::mt19937 rng(1234);
+
+        const auto before = snapshot();
+        constexpr int kBlocks = 400, kEventsPerBlock = 3;
+        int64_t timeline = 0;
+        int delivered = 0, blocksWithDirty = 0, retried = 0;
+        uint32_t retriedLast = 0;
+        bool retriesComeBack = true;     // every held-back parameter is dirty again next block
+        for (int b = 0; b < kBlocks; ++b) {
+            // host and UI side: a knob move and events up to two blocks ahead
+            mix->setValueNotifyingHost(static_cast<float>(b % 10) / 10.0f);
+            for (int k = 0; k < kEventsPerBlock; ++k)
+                scheduler.push(EngineParam::Feedback, 0.2f + 0.1f * static_cast<float>(k),
+                               timeline + (b * 37 + k * 101) % (2 * bs));
+            fillNoise(buf, rng);
+
+            // ChronosProcessor::processBlock's parameter step, then the engine
+            const RtGuard::ScopedRealtime rt;
+            const auto applied = Chronos::applyBlockParameters(params, scheduler, *e, timeline, bs);
+            blocksWithDirty += applied.dirty != 0 ? 1 : 0;
+            retriesComeBack = retriesComeBack && (applied.dirty & retriedLast) == retriedLast;
+            retriedLast = applied.retried;
+            retried += std::popcount(applied.retried);
+            const juce::dsp::AudioBlock<float> block(buf);
+            e->process(block, bs, scheduler.events(), applied.numEvents);
+            timeline += bs;
+            delivered += applied.numEvents;
+        }
+        expectClean("processor_params", before);
+        EXPECT(delivered + scheduler.pendingCount() == kBlocks * kEventsPerBlock && blocksWithDirty == kBlocks,
+               "parameter path lost work: " << delivered << " events delivered, " << scheduler.pendingCount()
+               << " pending, " << blocksWithDirty << " / " << kBlocks << " blocks saw a dirty parameter");
+        EXPECT(retried > 0 && retriesComeBack && (params.poll() & retriedLast) == retriedLast,
+               "an event-covered parameter was not marked dirty again for the next block");
+    }
+
+    // ---- the guard catches an allocation, a lock and a syscall ----
+    {
+        const auto before = snapshot();
+        std::mutex m;
+        {
+            const RtGuard::ScopedRealtime rt;
+            const RtGuard::ScopedQuiet quiet;
+            auto* p = new int(1);
+            delete p;
+            m.lock();
+            m.unlock();
+            std::this_thread::yield();
+        }
+        const auto after = snapshot();
+        bool trapped = true;
+        for (size_t k = 0; k < after.size(); ++k) {
+            const uint64_t n = after[k] - before[k];
+            csv << "guard_self_test," << RtGuard::kindName(kinds[k]) << "," << n << "," << (n > 0 ? 1 : 0) << "\n";
+            trapped = trapped && n > 0;
+        }
+        EXPECT(trapped, "RtGuard missed a deliberate allocation, lock or syscall");
+    }
+}
+
 // ------------------------------------------------------------------- summary
 static void writeSummary()
 {
@@ -421,6 +938,11 @@ int main()
     testMonoStereoSwitching();
     testResetClearsState();
     testStreamingVersion();
+    testModulation();
+    testSampleAccurateEvents();
+    testCrossRamp();
+    testJumpMode();
+    testRealtimeSafety();
     writeSummary();
 
     std::cout << "\n===========================================\n";
@@ -0,0 +1,205 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <iomanip>
+#include <cstdint>
+#include "utils/helpers/event_queue.h"
+#include "dsp/engine/delay/param_event_scheduler.h"
+
+using namespace MarsDSP;
+using namespace MarsDSP::DSP;
+
+// EventQueue: capacity / FIFO order on one thread, then several producers
+// racing one consumer. Every event must arrive exactly once and in order per
+// producer. Then ParamEventScheduler on top of it: time order across blocks,
+// the per-block drain bound, and a full pending heap still letting due
+// events through → event_queue.csv
+struct Event
+{
+    std::uint32_t producer;
+    std::uint32_t seq;
+};
+
+int main()
+{
+    bool passed = true;
+
+    std::ofstream csv("tests/simd_harness/logs/event_queue.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/event_queue.csv" << std::endl;
+        return 1;
+    }
+    csv << "case,producer,pushed,received,full_retries,passed\n";
+
+    // ---- single thread: holds exactly Capacity, drains in FIFO order ----
+    {
+        EventQueue<Event, 64> queue;
+        std::uint32_t pushed = 0;
+        while (queue.push({ 0, pushed }))
+            ++pushed;
+
+        Event e {};
+        std::uint32_t received = 0;
+        bool ordered = true;
+        while (queue.pop(e))
+            ordered = ordered && e.seq == received++;
+
+        // wraps around cleanly after a full drain
+        const bool reuse = queue.push({ 0, 99 }) && queue.pop(e) && e.seq == 99 && !queue.pop(e);
+
+        const bool ok = pushed == 64 && received == 64 && ordered && reuse;
+        passed = passed && ok;
+        csv << "capacity,0," << pushed << "," << received << ",0," << (ok ? 1 : 0) << "\n";
+        std::cout << "  capacity / fifo      pushed " << pushed << "  received " << received << "  "
+                  << (ok ? "PASSED" : "FAILED") << std::endl;
+    }
+
+    // ---- producers racing one consumer ----
+    {
+        constexpr int numProducers = 3;
+        constexpr std::uint32_t perProducer = 100000;
+        EventQueue<Event, 256> queue;
+
+        std::atomic<bool> go { false };
+        std::vector<std::uint64_t> retries(numProducers, 0);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < numProducers; ++p)
+            producers.emplace_back([&, p]
+            {
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                for (std::uint32_t i = 0; i < perProducer; ++i)
+                    while (!queue.push({ static_cast<std::uint32_t>(p), i }))
+                    {
+                        ++retries[static_cast<size_t>(p)];
+                        std::this_thread::yield();
+                    }
+            });
+
+        std::vector<std::uint32_t> next(numProducers, 0);
+        bool ordered = true;
+        std::uint64_t received = 0;
+        go.store(true, std::memory_order_release);
+
+        Event e {};
+        while (received < static_cast<std::uint64_t>(numProducers) * perProducer)
+        {
+            if (!queue.pop(e))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            ordered = ordered && e.producer < numProducers && e.seq == next[e.producer];
+            if (e.producer < numProducers) ++next[e.producer];
+            ++received;
+        }
+        for (auto& t : producers) t.join();
+        const bool drained = !queue.pop(e);
+
+        for (int p = 0; p < numProducers; ++p)
+        {
+            const bool ok = ordered && drained && next[static_cast<size_t>(p)] == perProducer;
+            passed = passed && ok;
+            csv << "mpsc," << p << "," << perProducer << "," << next[static_cast<size_t>(p)] << ","
+                << retries[static_cast<size_t>(p)] << "," << (ok ? 1 : 0) << "\n";
+            std::cout << "  producer " << p << "           received " << std::setw(7) << next[static_cast<size_t>(p)]
+                      << " / " << perProducer << "  full retries " << retries[static_cast<size_t>(p)] << "  "
+                      << (ok ? "PASSED" : "FAILED") << std::endl;
+        }
+    }
+
+    // ---- scheduler: shuffled stamps come out in time order, stable for equal stamps ----
+    {
+        constexpr int blockSize = 64, numEvents = 200;
+        ParamEventScheduler<256, 256, 256> scheduler;
+        std::uint32_t rng = 0x2468ACEu;
+        for (int i = 0; i < numEvents; ++i)
+        {
+            rng = rng * 1664525u + 1013904223u;
+            // value carries the arrival index; stamps collide in steps of 8
+            (void) scheduler.push(EngineParam::Mix, static_cast<float>(i), static_cast<int64_t>((rng >> 16) % (4 * blockSize)) & ~7);
+        }
+
+        int received = 0;
+        bool ordered = true;
+        for (int b = 0; b < 4; ++b)
+        {
+            const int n = scheduler.collect(static_cast<int64_t>(b) * blockSize, blockSize);
+            const ParamEvent* events = scheduler.events();
+            for (int i = 0; i < n; ++i)
+            {
+                ordered = ordered && events[i].sampleOffset >= 0 && events[i].sampleOffset < blockSize;
+                if (i > 0)
+                    ordered = ordered && (events[i - 1].sampleOffset < events[i].sampleOffset
+                                          || (events[i - 1].sampleOffset == events[i].sampleOffset && events[i - 1].value < events[i].value));
+            }
+            received += n;
+        }
+
+        const bool ok = ordered && received == numEvents && scheduler.pendingCount() == 0;
+        passed = passed && ok;
+        csv << "scheduler_order,0," << numEvents << "," << received << ",0," << (ok ? 1 : 0) << "\n";
+        std::cout << "  scheduler order      pushed " << numEvents << "  received " << received << "  "
+                  << (ok ? "PASSED" : "FAILED") << std::endl;
+    }
+
+    // ---- scheduler: a burst drains at most MaxDrainPerBlock per block ----
+    {
+        constexpr int blockSize = 64, maxDrain = 32, numEvents = 100;
+        ParamEventScheduler<128, 64, maxDrain> scheduler;
+        for (int i = 0; i < numEvents; ++i)
+            (void) scheduler.push(EngineParam::Feedback, 0.5f, 0);
+
+        int received = 0, blocks = 0;
+        bool bounded = true;
+        while (received < numEvents && blocks < 16)
+        {
+            const int n = scheduler.collect(static_cast<int64_t>(blocks++) * blockSize, blockSize);
+            bounded = bounded && n <= maxDrain;
+            received += n;
+        }
+
+        const bool ok = bounded && received == numEvents && blocks == (numEvents + maxDrain - 1) / maxDrain;
+        passed = passed && ok;
+        csv << "scheduler_drain,0," << numEvents << "," << received << ",0," << (ok ? 1 : 0) << "\n";
+        std::cout << "  scheduler drain      pushed " << numEvents << "  received " << received << " in " << blocks
+                  << " blocks  " << (ok ? "PASSED" : "FAILED") << std::endl;
+    }
+
+    // ---- scheduler: a heap full of later events doesn't hold back due ones ----
+    {
+        constexpr int blockSize = 64, maxPending = 32;
+        ParamEventScheduler<128, maxPending, 64> scheduler;
+        for (int i = 0; i < maxPending; ++i)
+            (void) scheduler.push(EngineParam::DelayTime, 100.0f, 1000000 + i);
+        const bool filled = scheduler.collect(0, blockSize) == 0 && scheduler.pendingCount() == maxPending;
+
+        // three due mid-block, two for a later block that no longer fit
+        for (int i = 0; i < 3; ++i)
+            (void) scheduler.push(EngineParam::Mix, 0.25f * static_cast<float>(i), blockSize + 10 + i);
+        (void) scheduler.push(EngineParam::Mix, 1.0f, 500000);
+        (void) scheduler.push(EngineParam::Mix, 1.0f, 500001);
+        const int n = scheduler.collect(blockSize, blockSize);
+        bool atZero = n == 3;
+        for (int i = 0; atZero && i < n; ++i)
+            atZero = scheduler.events()[i].sampleOffset == 0 && scheduler.events()[i].value == 0.25f * static_cast<float>(i);
+
+        // the queue stays usable, and the heap still delivers what it holds
+        const bool flows = scheduler.push(EngineParam::Mix, 0.5f, 2 * blockSize) && scheduler.collect(2 * blockSize, blockSize) == 1
+                           && scheduler.collect(1000000, blockSize) == maxPending;
+
+        const bool ok = filled && atZero && flows && scheduler.droppedCount() == 2;
+        passed = passed && ok;
+        csv << "scheduler_full,0," << maxPending + 6 << "," << n << "," << scheduler.droppedCount() << "," << (ok ? 1 : 0) << "\n";
+        std::cout << "  scheduler full       due " << n << " at offset 0  dropped " << scheduler.droppedCount() << "  "
+                  << (ok ? "PASSED" : "FAILED") << std::endl;
+    }
+
+    csv.close();
+
+    std::cout << (passed ? "All event queue tests PASSED." : "Some event queue tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include "dsp/engine/metering/load_meter.h"
+#include "utils/helpers/cycle_counter.h"
+
+using namespace MarsDSP;
+using namespace MarsDSP::DSP;
+
+// Load meter: cycle counter rate against steady_clock, histogram bucket
+// edges, percentiles / overruns on a known distribution, the audio-thread
+// reset, a reader racing the writer, and the per-block overhead against a
+// 32-sample budget → load_meter.csv
+int main()
+{
+    bool passed = true;
+
+    std::ofstream csv("tests/simd_harness/logs/load_meter.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/load_meter.csv" << std::endl;
+        return 1;
+    }
+    csv << "case,value,passed\n";
+
+    auto report = [&](const std::string& name, double value, bool ok)
+    {
+        passed = passed && ok;
+        csv << name << "," << value << "," << (ok ? 1 : 0) << "\n";
+        std::cout << "  " << name << std::string(24 - std::min<size_t>(name.size(), 23), ' ')
+                  << value << "  " << (ok ? "PASSED" : "FAILED") << std::endl;
+    };
+
+    constexpr double sr = 48000.0;
+    const double cps = cyclesPerSecond();
+
+    // ---- the counter against steady_clock over 100 ms ----
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        const uint64_t c0 = readCycles();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const uint64_t c1 = readCycles();
+        const auto t1 = std::chrono::steady_clock::now();
+        const double measured = static_cast<double>(c1 - c0) / std::chrono::duration<double>(t1 - t0).count();
+        const double err = std::abs(measured / cps - 1.0);
+        report("cycle_rate_rel_err", err, err < 0.01);
+    }
+
+    // ---- every load lands in a bucket whose edges bracket it ----
+    {
+        bool bracketed = true;
+        for (float load = LoadMeter::kMinLoad; load < LoadMeter::kMaxLoad; load *= 1.0137f)
+        {
+            const int b = LoadMeter::bucketOf(load);
+            bracketed = bracketed && b > 0 && b < LoadMeter::kNumBuckets - 1
+                     && load < LoadMeter::upperEdge(b) && load >= LoadMeter::upperEdge(b - 1);
+        }
+        bracketed = bracketed && LoadMeter::bucketOf(0.0f) == 0 && LoadMeter::bucketOf(1.0e9f) == LoadMeter::kNumBuckets - 1
+                 && LoadMeter::bucketOf(std::nanf("")) == 0;
+        // widest at the bottom of an octave: one sixteenth of it
+        const double width = LoadMeter::upperEdge(LoadMeter::bucketOf(0.5f)) / 0.5 - 1.0;
+        report("bucket_edges", width, bracketed && width <= 0.0625);
+    }
+
+    // ---- percentiles and overruns on a known distribution ----
+    {
+        LoadMeter meter;
+        meter.prepare(sr);
+        const int n = 256;
+        const double cyclesPerBudget = cps * n / sr;
+        // 10000 blocks: 9890 at 10 %, 99 at 60 %, 11 at 150 %
+        for (int i = 0; i < 10000; ++i)
+        {
+            const double load = i < 9890 ? 0.10 : i < 9989 ? 0.60 : 1.50;
+            meter.addBlock(static_cast<uint64_t>(load * cyclesPerBudget), n);
+        }
+        const auto s = meter.getStats();
+        auto near = [](float got, double want) { return got >= want * 0.999 && got <= want * 1.0625; };
+        report("p50",  s.p50,  near(s.p50, 0.10));
+        report("p99",  s.p99,  near(s.p99, 0.60));
+        report("p999", s.p999, near(s.p999, 1.50));
+        report("max",  s.max,  std::abs(s.max - 1.5f) < 1.0e-3f);
+        report("overruns", static_cast<double>(s.overruns), s.overruns == 11 && s.blocks == 10000);
+
+        // reset is carried out by the next block
+        meter.requestReset();
+        report("reset_pending_blocks", static_cast<double>(meter.getStats().blocks), meter.getStats().blocks == 10000);
+        meter.addBlock(static_cast<uint64_t>(0.2 * cyclesPerBudget), n);
+        const auto r = meter.getStats();
+        report("reset_blocks", static_cast<double>(r.blocks), r.blocks == 1 && r.overruns == 0 && near(r.p999, 0.2));
+    }
+
+    // ---- a reader polling while the writer runs never sees more than was written ----
+    {
+        LoadMeter meter;
+        meter.prepare(sr);
+        constexpr uint64_t total = 2000000;
+        std::atomic<bool> done { false };
+        bool consistent = true;
+        std::thread reader([&]
+        {
+            uint64_t lastBlocks = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                const auto s = meter.getStats();
+                consistent = consistent && s.blocks >= lastBlocks && s.blocks <= total && s.p50 <= s.p99 && s.p99 <= s.p999;
+                lastBlocks = s.blocks;
+                std::this_thread::yield();
+            }
+        });
+        for (uint64_t i = 0; i < total; ++i)
+            meter.addBlock(1000 + (i & 1023), 64);
+        done.store(true, std::memory_order_release);
+        reader.join();
+        report("reader_race", static_cast<double>(meter.getStats().blocks), consistent && meter.getStats().blocks == total);
+    }
+
+    // ---- overhead: what ScopedBlock costs per block, against a 32-sample budget ----
+    {
+        LoadMeter meter;
+        meter.prepare(sr);
+        constexpr int iterations = 1000000;
+        double best = 1.0e30;
+        for (int run = 0; run < 5; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                const LoadMeter::ScopedBlock timing(meter, 32);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / iterations);
+        }
+        const double budgetNs = 32.0 / sr * 1.0e9;
+        const double share = best / budgetNs;
+        report("overhead_ns_per_block", best, true);
+        report("overhead_share_32", share, share < 1.0e-3);
+    }
+
+    csv.close();
+
+    std::cout << (passed ? "All load meter tests PASSED." : "Some load meter tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <JuceHeader.h>
+#include "PresetBank.h"
+#include "FactoryPresets.h"
+#include "rt_guard.h"
+
+using namespace Chronos;
+
+// PresetBank: names and values round-trip through the fixed-stride layout,
+// lookups make no call rt_guard.h traps, malformed banks come up empty, a state
+// record saved under an old parameter ID restores into the renamed parameter,
+// and the factory bank installs, maps and loads every program in range
+// → preset_bank.csv
+int main()
+{
+    bool passed = true;
+
+    std::ofstream csv("tests/simd_harness/logs/preset_bank.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/preset_bank.csv" << std::endl;
+        return 1;
+    }
+    csv << "case,presets,rt_violations,passed\n";
+
+    auto report = [&](const std::string& name, int presets, uint64_t violations, bool ok)
+    {
+        passed = passed && ok;
+        csv << name << "," << presets << "," << violations << "," << (ok ? 1 : 0) << "\n";
+        std::cout << "  " << name << std::string(20 - std::min<size_t>(name.size(), 19), ' ')
+                  << "presets " << presets << "  rt violations " << violations << "  "
+                  << (ok ? "PASSED" : "FAILED") << std::endl;
+    };
+
+    // presets with distinct in-range values for every parameter
+    std::vector<PresetBank::Preset> presets;
+    for (int i = 0; i < 64; ++i)
+    {
+        PresetBank::Preset preset { "Preset " + std::to_string(i), BinaryState::defaults() };
+        for (size_t p = 0; p < preset.values.size(); ++p)
+        {
+            const auto& spec = kParamSpecs[p];
+            const float t = static_cast<float>((i * 7 + static_cast<int>(p) * 3) % 16) / 15.0f;
+            preset.values[p] = spec.kind == ParamKind::Float ? spec.min + (spec.max - spec.min) * t
+                                                             : (t >= 0.5f ? spec.max : spec.min);
+        }
+        presets.push_back(preset);
+    }
+    presets[5].name = "A name that is much longer than the thirty-one bytes a record holds";
+
+    const auto bytes = PresetBank::serialise(presets);
+    const PresetBank bank(bytes.data(), bytes.size());
+
+    // ---- round trip ----
+    {
+        bool ok = bank.size() == static_cast<int>(presets.size());
+        for (int i = 0; ok && i < bank.size(); ++i)
+        {
+            std::array<float, kNumParams> values {};
+            const auto expectedName = presets[static_cast<size_t>(i)].name.substr(0, PresetBank::kNameSize - 1);
+            ok = bank.load(i, values) && values == presets[static_cast<size_t>(i)].values
+                 && bank.name(i) == expectedName;
+        }
+        report("round trip", bank.size(), 0, ok);
+    }
+
+    // ---- switching allocates, locks and blocks on nothing (0 where the guard is unsupported) ----
+    {
+        std::array<float, kNumParams> values {};
+        size_t nameBytes = 0;
+        const uint64_t before = RtGuard::violations();
+        {
+            const RtGuard::ScopedRealtime rt;
+            for (int pass = 0; pass < 100; ++pass)
+                for (int i = 0; i < bank.size(); ++i)
+                {
+                    (void) bank.load(i, values);
+                    nameBytes += bank.name(i).size();
+                }
+        }
+        const uint64_t violations = RtGuard::violations() - before;
+        report("rt safe lookup", bank.size(), violations, violations == 0 && nameBytes > 0);
+    }
+
+    // ---- bad input ----
+    {
+        std::array<float, kNumParams> values = BinaryState::defaults();
+        const auto untouched = values;
+        const bool badIndex = !bank.load(-1, values) && !bank.load(bank.size(), values)
+                              && values == untouched && bank.name(bank.size()).empty();
+        report("bad index", bank.size(), 0, badIndex);
+
+        const PresetBank truncated(bytes.data(), bytes.size() - 1);
+        report("truncated bank", truncated.size(), 0, truncated.size() == 0);
+
+        const char foreign[] = "<?xml version=\"1.0\"?><PARAMETERS/>";
+        const PresetBank notABank(foreign, sizeof(foreign));
+        report("foreign bytes", notABank.size(), 0, notABank.size() == 0 && !notABank.load(0, values));
+    }
+
+    // ---- old IDs: a record saved before a rename restores into the renamed parameter ----
+    {
+        static constexpr std::array<BinaryState::IdRename, 2> renames {{
+            { kPluginStateVersion, "time",      "delayTimeMs" },
+            { kPluginStateVersion, "delayTimeMs", ParamID::kDelayTime },
+        }};
+        constexpr auto delayTime = static_cast<size_t>(Param::DelayTime);
+        const float stored = kParamSpecs[delayTime].max;
+
+        std::array<uint8_t, BinaryState::kStateSize> blob {};
+        auto saved = BinaryState::defaults();
+        saved[delayTime] = stored;
+        BinaryState::write(blob.data(), saved);
+        BinaryState::Detail::put32(blob.data() + BinaryState::kHeaderSize
+                                   + delayTime * BinaryState::kRecordSize, BinaryState::idHash("time"));
+
+        auto restore = [&](const int version)
+        {
+            BinaryState::Detail::put16(blob.data() + 4, static_cast<uint16_t>(version));
+            auto values = BinaryState::defaults();
+            BinaryState::Header header {};
+            return BinaryState::read(blob.data(), blob.size(), values, header, renames) ? values[delayTime] : -1.0f;
+        };
+
+        // migrated from the older version, chained through both renames;
+        // an unknown ID at the current version, so the default stays
+        const bool ok = restore(kPluginStateVersion - 1) == stored
+                        && restore(kPluginStateVersion) == kParamSpecs[delayTime].defaultValue;
+        report("old id migrated", 1, 0, ok);
+    }
+
+    // ---- factory bank: every program in range, uniquely named ----
+    const auto factory = factoryPresets();
+    {
+        bool ok = !factory.empty();
+        for (size_t i = 0; i < factory.size(); ++i)
+        {
+            ok = ok && !factory[i].name.empty() && factory[i].name.size() < PresetBank::kNameSize;
+            for (size_t j = 0; j < i; ++j)
+                ok = ok && factory[i].name != factory[j].name;
+            for (size_t p = 0; p < factory[i].values.size(); ++p)
+                ok = ok && kParamSpecs[p].min <= factory[i].values[p] && factory[i].values[p] <= kParamSpecs[p].max;
+        }
+        report("factory presets", static_cast<int>(factory.size()), 0, ok);
+    }
+
+    // ---- install: written once, mapped like the processor maps it, never overwritten ----
+    {
+        const auto file = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                              .getChildFile("chronos_preset_bank_test").getChildFile("Presets.chronosbank");
+        file.deleteFile();
+
+        bool ok = PresetBank::installIfMissing(file, factory);
+        int mapped = 0;
+        {
+            const auto bank = PresetBank::openShared(file);
+            mapped = bank->size();
+            ok = ok && mapped == static_cast<int>(factory.size());
+            for (int i = 0; ok && i < mapped; ++i)
+            {
+                std::array<float, kNumParams> values {};
+                ok = bank->load(i, values) && values == factory[static_cast<size_t>(i)].values
+                     && bank->name(i) == factory[static_cast<size_t>(i)].name;
+            }
+        }
+
+        // a bank already on disk (the user's own) is kept as it is
+        ok = ok && PresetBank::installIfMissing(file, { factory.front() });
+        ok = ok && PresetBank::openShared(file)->size() == static_cast<int>(factory.size());
+        file.getParentDirectory().deleteRecursively();
+        report("factory install", mapped, 0, ok);
+    }
+
+    csv.close();
+
+    std::cout << (passed ? "All preset bank tests PASSED." : "Some preset bank tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
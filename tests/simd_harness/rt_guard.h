@@ -0,0 +1,353 @@
+// Real-time safety checker: traps allocations, locks and blocking syscalls
+// made while a thread is inside a ScopedRealtime.
+//
+//   {
+//       const RtGuard::ScopedRealtime rt;       // this thread is the audio thread now
+//       engine.process(block, n);
+//   }
+//   EXPECT(RtGuard::violations() == 0, ...);
+//
+// Interposes, for the whole executable: malloc / calloc / realloc / free /
+// aligned allocation, every global operator new / delete, pthread mutex,
+// rwlock, condition-variable and semaphore waits, and the libc wrappers of
+// the syscalls that block or hit the filesystem (read, write, open, openat,
+// close, nanosleep, clock_nanosleep, usleep, sched_yield, mmap, munmap).
+// A call from inside a ScopedRealtime is counted by kind and printed with a
+// backtrace (first kMaxTraces; link with ENABLE_EXPORTS for function names,
+// pipe through c++filt to demangle); a call from anywhere else passes
+// straight through. glibc's calls to itself don't go through the
+// interposers, so what's caught is what the code under test - engine, JUCE,
+// libstdc++ - calls, not every syscall the kernel sees.
+//
+// Linux / glibc without sanitizers only (RtGuard::kSupported): elsewhere
+// ScopedRealtime does nothing and violations() stays 0. Defines the
+// interposers, so include it from exactly one .cpp per executable.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__) && defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define CHRONOS_RT_GUARD 1
+#else
+#define CHRONOS_RT_GUARD 0
+#endif
+
+#if CHRONOS_RT_GUARD
+#include <cerrno>
+#include <cstdarg>
+#include <cstring>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+extern "C" {
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void* __libc_memalign(size_t, size_t);
+    void  __libc_free(void*);
+}
+#endif
+
+namespace RtGuard
+{
+    enum class Kind { Alloc, Free, Lock, Syscall, Count };
+
+    inline constexpr bool kSupported = CHRONOS_RT_GUARD != 0;
+    inline constexpr int  kMaxTraces = 8;
+
+    namespace detail
+    {
+        // constant-initialised, so reading it never allocates
+        inline thread_local int depth = 0;
+        inline thread_local int quiet = 0;
+        inline std::array<std::atomic<uint64_t>, static_cast<size_t>(Kind::Count)> counts {};
+        inline std::atomic<int> tracesLeft { kMaxTraces };
+
+#if CHRONOS_RT_GUARD
+        inline void writeStr(const char* s) noexcept
+        {
+            const ssize_t ignored = ::write(2, s, std::strlen(s));
+            static_cast<void>(ignored);
+        }
+
+        // the reporting itself may allocate and write, so it runs outside the scope
+        [[gnu::noinline]] inline void violation(const Kind kind, const char* what) noexcept
+        {
+            const int saved = depth;
+            depth = 0;
+            counts[static_cast<size_t>(kind)].fetch_add(1, std::memory_order_relaxed);
+            if (quiet == 0 && tracesLeft.fetch_sub(1, std::memory_order_relaxed) > 0)
+            {
+                writeStr("  RT VIOLATION  ");
+                writeStr(what);
+                writeStr(" on a real-time thread\n");
+                void* frames[48];
+                const int n = ::backtrace(frames, 48);
+                ::backtrace_symbols_fd(frames + 1, n - 1, 2);
+            }
+            depth = saved;
+        }
+
+        inline void check(const Kind kind, const char* what) noexcept
+        {
+            if (depth > 0) [[unlikely]]
+                violation(kind, what);
+        }
+
+        // the next definition of a libc symbol after ours
+        template<typename Fn>
+        Fn next(std::atomic<Fn>& slot, const char* name) noexcept
+        {
+            Fn fn = slot.load(std::memory_order_relaxed);
+            if (fn == nullptr)
+            {
+                fn = reinterpret_cast<Fn>(::dlsym(RTLD_NEXT, name));
+                slot.store(fn, std::memory_order_relaxed);
+            }
+            return fn;
+        }
+
+        // backtrace() dlopens libgcc_s on first use, which allocates
+        inline const bool primed = [] {
+            void* frame[1];
+            ::backtrace(frame, 1);
+            return true;
+        }();
+#endif
+    }
+
+    // marks the calling thread real-time for the scope's lifetime; nests
+    class ScopedRealtime
+    {
+    public:
+        ScopedRealtime() noexcept  { ++detail::depth; }
+        ~ScopedRealtime()          { --detail::depth; }
+
+        ScopedRealtime(const ScopedRealtime&) = delete;
+        ScopedRealtime& operator=(const ScopedRealtime&) = delete;
+    };
+
+    // lets a known, accepted call through (e.g. the test's own logging)
+    class ScopedAllow
+    {
+    public:
+        ScopedAllow() noexcept : saved(detail::depth) { detail::depth = 0; }
+        ~ScopedAllow()         { detail::depth = saved; }
+
+        ScopedAllow(const ScopedAllow&) = delete;
+        ScopedAllow& operator=(const ScopedAllow&) = delete;
+
+    private:
+        int saved;
+    };
+
+    // counts violations without printing them (a test's deliberate ones)
+    class ScopedQuiet
+    {
+    public:
+        ScopedQuiet() noexcept  { ++detail::quiet; }
+        ~ScopedQuiet()          { --detail::quiet; }
+
+        ScopedQuiet(const ScopedQuiet&) = delete;
+        ScopedQuiet& operator=(const ScopedQuiet&) = delete;
+    };
+
+    inline uint64_t violations(const Kind kind) noexcept
+    {
+        return detail::counts[static_cast<size_t>(kind)].load(std::memory_order_relaxed);
+    }
+
+    inline uint64_t violations() noexcept
+    {
+        uint64_t total = 0;
+        for (const auto& c : detail::counts)
+            total += c.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    inline const char* kindName(const Kind kind) noexcept
+    {
+        switch (kind)
+        {
+            case Kind::Alloc:   return "alloc";
+            case Kind::Free:    return "free";
+            case Kind::Lock:    return "lock";
+            case Kind::Syscall: return "syscall";
+            default:            return "?";
+        }
+    }
+}
+
+#if CHRONOS_RT_GUARD
+
+// ------------------------------------------------------------------ malloc
+extern "C" {
+
+void* malloc(size_t n) noexcept
+{
+    RtGuard::detail::check(RtGuard::Kind::Alloc, "malloc");
+    return __libc_malloc(n);
+}
+
+void* calloc(size_t count, size_t n) noexcept
+{
+    RtGuard::detail::check(RtGuard::Kind::Alloc, "calloc");
+    return __libc_calloc(count, n);
+}
+
+void* realloc(void* p, size_t n) noexcept
+{
+    RtGuard::detail::check(RtGuard::Kind::Alloc, "realloc");
+    return __libc_realloc(p, n);
+}
+
+void free(void* p) noexcept
+{
+    if (p != nullptr)
+        RtGuard::detail::check(RtGuard::Kind::Free, "free");
+    __libc_free(p);
+}
+
+void* memalign(size_t alignment, size_t n) noexcept
+{
+    RtGuard::detail::check(RtGuard::Kind::Alloc, "memalign");
+    return __libc_memalign(alignment, n);
+}
+
+void* aligned_alloc(size_t alignment, size_t n) noexcept
+{
+    RtGuard::detail::check(RtGuard::Kind::Alloc, "aligned_alloc");
+    return __libc_memalign(alignment, n);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t n) noexcept
+{
+    RtGuard::detail::check(RtGuard::Kind::Alloc, "posix_memalign");
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    void* p = __libc_memalign(alignment, n);
+    if (p == nullptr)
+        return ENOMEM;
+    *out = p;
+    return 0;
+}
+
+// ------------------------------------------------------------------- locks
+#define CHRONOS_RT_GUARD_FORWARD(kind, ret, name, params, args, except)             \
+    ret name params except                                                          \
+    {                                                                               \
+        static std::atomic<ret (*) params> real { nullptr };                        \
+        RtGuard::detail::check(RtGuard::Kind::kind, #name);                         \
+        return RtGuard::detail::next(real, #name) args;                             \
+    }
+
+CHRONOS_RT_GUARD_FORWARD(Lock, int, pthread_mutex_lock, (pthread_mutex_t* m), (m), noexcept)
+CHRONOS_RT_GUARD_FORWARD(Lock, int, pthread_mutex_timedlock, (pthread_mutex_t* m, const struct timespec* t), (m, t), noexcept)
+CHRONOS_RT_GUARD_FORWARD(Lock, int, pthread_rwlock_rdlock, (pthread_rwlock_t* l), (l), noexcept)
+CHRONOS_RT_GUARD_FORWARD(Lock, int, pthread_rwlock_wrlock, (pthread_rwlock_t* l), (l), noexcept)
+CHRONOS_RT_GUARD_FORWARD(Lock, int, pthread_cond_wait, (pthread_cond_t* c, pthread_mutex_t* m), (c, m), )
+CHRONOS_RT_GUARD_FORWARD(Lock, int, pthread_cond_timedwait, (pthread_cond_t* c, pthread_mutex_t* m, const struct timespec* t), (c, m, t), )
+CHRONOS_RT_GUARD_FORWARD(Lock, int, sem_wait, (sem_t* s), (s), )
+CHRONOS_RT_GUARD_FORWARD(Lock, int, sem_timedwait, (sem_t* s, const struct timespec* t), (s, t), )
+
+// ---------------------------------------------------------------- syscalls
+CHRONOS_RT_GUARD_FORWARD(Syscall, ssize_t, read, (int fd, void* buf, size_t n), (fd, buf, n), )
+CHRONOS_RT_GUARD_FORWARD(Syscall, ssize_t, write, (int fd, const void* buf, size_t n), (fd, buf, n), )
+CHRONOS_RT_GUARD_FORWARD(Syscall, int, close, (int fd), (fd), )
+CHRONOS_RT_GUARD_FORWARD(Syscall, int, nanosleep, (const struct timespec* t, struct timespec* rem), (t, rem), )
+CHRONOS_RT_GUARD_FORWARD(Syscall, int, clock_nanosleep, (clockid_t c, int flags, const struct timespec* t, struct timespec* rem), (c, flags, t, rem), )
+CHRONOS_RT_GUARD_FORWARD(Syscall, int, usleep, (useconds_t us), (us), )
+CHRONOS_RT_GUARD_FORWARD(Syscall, int, sched_yield, (), (), noexcept)
+CHRONOS_RT_GUARD_FORWARD(Syscall, void*, mmap, (void* a, size_t n, int prot, int flags, int fd, off_t off), (a, n, prot, flags, fd, off), noexcept)
+CHRONOS_RT_GUARD_FORWARD(Syscall, int, munmap, (void* a, size_t n), (a, n), noexcept)
+#undef CHRONOS_RT_GUARD_FORWARD
+
+// open / openat are variadic: the mode is only there with O_CREAT / O_TMPFILE
+int open(const char* path, int flags, ...)
+{
+    static std::atomic<int (*)(const char*, int, ...)> real { nullptr };
+    RtGuard::detail::check(RtGuard::Kind::Syscall, "open");
+    mode_t mode = 0;
+    if ((flags & O_CREAT) != 0 || (flags & O_TMPFILE) == O_TMPFILE)
+    {
+        va_list args;
+        va_start(args, flags);
+        mode = static_cast<mode_t>(va_arg(args, int));
+        va_end(args);
+    }
+    return RtGuard::detail::next(real, "open")(path, flags, mode);
+}
+
+int openat(int dir, const char* path, int flags, ...)
+{
+    static std::atomic<int (*)(int, const char*, int, ...)> real { nullptr };
+    RtGuard::detail::check(RtGuard::Kind::Syscall, "openat");
+    mode_t mode = 0;
+    if ((flags & O_CREAT) != 0 || (flags & O_TMPFILE) == O_TMPFILE)
+    {
+        va_list args;
+        va_start(args, flags);
+        mode = static_cast<mode_t>(va_arg(args, int));
+        va_end(args);
+    }
+    return RtGuard::detail::next(real, "openat")(dir, path, flags, mode);
+}
+
+}
+
+// -------------------------------------------------------- operator new / delete
+namespace RtGuard::detail
+{
+    inline void* newImpl(const std::size_t n, const std::size_t alignment, const bool nothrow)
+    {
+        check(Kind::Alloc, "operator new");
+        void* p = alignment > alignof(std::max_align_t) ? __libc_memalign(alignment, n == 0 ? 1 : n)
+                                                         : __libc_malloc(n == 0 ? 1 : n);
+        if (p == nullptr && !nothrow)
+            throw std::bad_alloc();
+        return p;
+    }
+
+    inline void deleteImpl(void* p) noexcept
+    {
+        if (p != nullptr)
+            check(Kind::Free, "operator delete");
+        __libc_free(p);
+    }
+}
+
+void* operator new  (std::size_t n)                                          { return RtGuard::detail::newImpl(n, 0, false); }
+void* operator new[](std::size_t n)                                          { return RtGuard::detail::newImpl(n, 0, false); }
+void* operator new  (std::size_t n, const std::nothrow_t&) noexcept          { return RtGuard::detail::newImpl(n, 0, true); }
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept          { return RtGuard::detail::newImpl(n, 0, true); }
+void* operator new  (std::size_t n, std::align_val_t a)                      { return RtGuard::detail::newImpl(n, static_cast<std::size_t>(a), false); }
+void* operator new[](std::size_t n, std::align_val_t a)                      { return RtGuard::detail::newImpl(n, static_cast<std::size_t>(a), false); }
+void* operator new  (std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return RtGuard::detail::newImpl(n, static_cast<std::size_t>(a), true); }
+void* operator new[](std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return RtGuard::detail::newImpl(n, static_cast<std::size_t>(a), true); }
+
+void operator delete  (void* p) noexcept                                     { RtGuard::detail::deleteImpl(p); }
+void operator delete[](void* p) noexcept                                     { RtGuard::detail::deleteImpl(p); }
+void operator delete  (void* p, std::size_t) noexcept                        { RtGuard::detail::deleteImpl(p); }
+void operator delete[](void* p, std::size_t) noexcept                        { RtGuard::detail::deleteImpl(p); }
+void operator delete  (void* p, const std::nothrow_t&) noexcept              { RtGuard::detail::deleteImpl(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept              { RtGuard::detail::deleteImpl(p); }
+void operator delete  (void* p, std::align_val_t) noexcept                   { RtGuard::detail::deleteImpl(p); }
+void operator delete[](void* p, std::align_val_t) noexcept                   { RtGuard::detail::deleteImpl(p); }
+void operator delete  (void* p, std::size_t, std::align_val_t) noexcept      { RtGuard::detail::deleteImpl(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept      { RtGuard::detail::deleteImpl(p); }
+void operator delete  (void* p, std::align_val_t, const std::nothrow_t&) noexcept { RtGuard::detail::deleteImpl(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { RtGuard::detail::deleteImpl(p); }
+
+#endif
@@ -0,0 +1,200 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <functional>
+#include "dsp/math/fastermath_batch.h"
+
+using namespace MarsDSP;
+
+// span batch API checks:
+//   1. every batch entry point matches its per-vector SIMD kernel bit for bit
+//      for all 4 output alignments and awkward lengths (head / body / tail)
+//   2. in-place processing works
+//   3. throughput of each batch call vs a hand-rolled loadu/storeu loop
+//      → simd_batch_throughput.csv
+struct BatchInfo
+{
+    std::string name;
+    float lo, hi;                                               // input range
+    std::function<void(std::span<const float>, std::span<float>)> batch;
+    std::function<void(std::span<const float>, std::span<float>)> loop;   // hand-rolled, kernel inlined
+    SIMD_M128 (*simd)(SIMD_M128);
+};
+
+template<typename Batch, typename Kernel>
+static BatchInfo makeInfo(std::string name, float lo, float hi, Batch batch, Kernel kernel)
+{
+    // what callers wrote before the batch API: unaligned quads, no tail handling
+    auto loop = [kernel](std::span<const float> in, std::span<float> out)
+    {
+        for (std::size_t i = 0; i + 4 <= in.size(); i += 4)
+            SIMD_MM(storeu_ps)(&out[i], kernel(SIMD_MM(loadu_ps)(&in[i])));
+    };
+    return { std::move(name), lo, hi, batch, loop, kernel };
+}
+
+// reference: the per-vector kernel on a zero-padded copy, one quad at a time
+static void referenceApply(const BatchInfo& b, const float* in, float* out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i += 4)
+    {
+        alignas(16) float buf[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        const std::size_t count = std::min<std::size_t>(4, n - i);
+        std::copy_n(in + i, count, buf);
+        SIMD_MM(store_ps)(buf, b.simd(SIMD_MM(load_ps)(buf)));
+        std::copy_n(buf, count, out + i);
+    }
+}
+
+int main()
+{
+    const std::vector<BatchInfo> funcs = {
+        makeInfo("sin",          -3.1f,  3.1f,  [](auto i, auto o) { fasterSin(i, o); },            [](SIMD_M128 x) { return fasterSin(x); }),
+        makeInfo("cos",          -3.1f,  3.1f,  [](auto i, auto o) { fasterCos(i, o); },            [](SIMD_M128 x) { return fasterCos(x); }),
+        makeInfo("tan",          -1.5f,  1.5f,  [](auto i, auto o) { fasterTan(i, o); },            [](SIMD_M128 x) { return fasterTan(x); }),
+        makeInfo("boundtopi",    -50.0f, 50.0f, [](auto i, auto o) { boundToPi(i, o); },            [](SIMD_M128 x) { return boundToPiSIMD(x); }),
+        makeInfo("tanh",         -5.0f,  5.0f,  [](auto i, auto o) { fasterTanh(i, o); },           [](SIMD_M128 x) { return fasterTanh(x); }),
+        makeInfo("tanh_bounded", -8.0f,  8.0f,  [](auto i, auto o) { fasterTanhBounded(i, o); },    [](SIMD_M128 x) { return fasterTanhBounded(x); }),
+        makeInfo("tanh_rcp",     -8.0f,  8.0f,  [](auto i, auto o) { fasterTanhRcpBounded(i, o); }, [](SIMD_M128 x) { return fasterTanhRcpBounded(x); }),
+        makeInfo("tanh54",       -8.0f,  8.0f,  [](auto i, auto o) { fasterTanh54Bounded(i, o); },  [](SIMD_M128 x) { return fasterTanh54Bounded(x); }),
+        makeInfo("tanh32",       -8.0f,  8.0f,  [](auto i, auto o) { fasterTanh32Bounded(i, o); },  [](SIMD_M128 x) { return fasterTanh32Bounded(x); }),
+        makeInfo("tanh_lut",     -8.0f,  8.0f,  [](auto i, auto o) { fasterTanhLut(i, o); },        [](SIMD_M128 x) { return fasterTanhLut(x); }),
+        makeInfo("logcosh",      -10.0f, 10.0f, [](auto i, auto o) { fasterLogCosh(i, o); },        [](SIMD_M128 x) { return fasterLogCosh(x); }),
+        makeInfo("exp2",         -20.0f, 20.0f, [](auto i, auto o) { fasterExp2(i, o); },           [](SIMD_M128 x) { return fasterExp2(x); }),
+        makeInfo("exp",          -20.0f, 20.0f, [](auto i, auto o) { fasterExp(i, o); },            [](SIMD_M128 x) { return fasterExp(x); }),
+        makeInfo("log2",         1.0e-4f, 4.0f, [](auto i, auto o) { fasterLog2(i, o); },           [](SIMD_M128 x) { return fasterLog2(x); }),
+        makeInfo("pow",          1.0e-4f, 4.0f, [](auto i, auto o) { fasterPow(i, 0.37f, o); },
+                                                [](SIMD_M128 x) { return fasterPow(x, SIMD_MM(set1_ps)(0.37f)); }),
+        makeInfo("db_to_gain",   -96.0f, 12.0f, [](auto i, auto o) { dbToGain(i, o); },             [](SIMD_M128 x) { return dbToGain(x); }),
+        makeInfo("gain_to_db",   1.0e-4f, 4.0f, [](auto i, auto o) { gainToDb(i, o); },             [](SIMD_M128 x) { return gainToDb(x); }),
+    };
+
+    const std::vector<std::size_t> lengths = { 0, 1, 2, 3, 4, 5, 7, 15, 16, 17, 31, 33, 100, 1027 };
+    std::mt19937 rng(42);
+    bool passed = true;
+
+    // ---- 1 + 2. correctness ----
+    for (const auto& f : funcs)
+    {
+        std::uniform_real_distribution<float> dist(f.lo, f.hi);
+        bool ok = true;
+
+        for (std::size_t len : lengths)
+        {
+            // +4 slack so every offset (and so every out alignment) fits
+            std::vector<float> in(len + 4), out(len + 4), ref(len + 4);
+            for (auto& v : in) v = dist(rng);
+
+            for (std::size_t offset = 0; offset < 4; ++offset)
+            {
+                std::fill(out.begin(), out.end(), -12345.0f);
+                f.batch(std::span<const float>(in.data() + offset, len), std::span<float>(out.data() + offset, len));
+                referenceApply(f, in.data() + offset, ref.data() + offset, len);
+
+                if (std::memcmp(out.data() + offset, ref.data() + offset, len * sizeof(float)) != 0)
+                    ok = false;
+                // nothing past the end may be touched
+                if (offset + len < out.size() && out[offset + len] != -12345.0f)
+                    ok = false;
+
+                // in-place
+                std::vector<float> inplace(in);
+                f.batch(std::span<const float>(inplace.data() + offset, len), std::span<float>(inplace.data() + offset, len));
+                if (std::memcmp(inplace.data() + offset, ref.data() + offset, len * sizeof(float)) != 0)
+                    ok = false;
+            }
+        }
+
+        if (!ok) std::cout << "FAILED batch " << f.name << " does not match the per-vector kernel" << std::endl;
+        passed = passed && ok;
+    }
+
+    // sincos has two outputs; check it against the per-vector kernel separately
+    {
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        bool ok = true;
+        for (std::size_t len : lengths)
+        {
+            std::vector<float> in(len + 4), s(len + 4), c(len + 8);
+            for (auto& v : in) v = dist(rng);
+            for (std::size_t offset = 0; offset < 4; ++offset)
+            {
+                // cos output deliberately at a different alignment than sin
+                fasterSinCos(std::span<const float>(in.data() + offset, len),
+                             std::span<float>(s.data() + offset, len), std::span<float>(c.data() + offset + 1, len));
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    float rs, rc;
+                    const std::size_t q = i & ~std::size_t(3);
+                    alignas(16) float buf[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    alignas(16) float bs[4], bc[4];
+                    std::copy_n(in.data() + offset + q, std::min<std::size_t>(4, len - q), buf);
+                    SIMD_M128 vs, vc;
+                    fasterSinCos(SIMD_MM(load_ps)(buf), vs, vc);
+                    SIMD_MM(store_ps)(bs, vs);
+                    SIMD_MM(store_ps)(bc, vc);
+                    rs = bs[i - q];
+                    rc = bc[i - q];
+                    if (s[offset + i] != rs || c[offset + 1 + i] != rc) ok = false;
+                }
+            }
+        }
+        if (!ok) std::cout << "FAILED batch sincos does not match the per-vector kernel" << std::endl;
+        passed = passed && ok;
+    }
+
+    std::cout << (passed ? "Batch correctness PASSED." : "Batch correctness FAILED.") << std::endl;
+
+    // ---- 3. throughput ----
+    std::ofstream csv("tests/simd_harness/logs/simd_batch_throughput.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_batch_throughput.csv" << std::endl;
+        return 1;
+    }
+    csv << "func,batch_msamples_per_s,loop_msamples_per_s,speedup\n";
+    csv << std::fixed << std::setprecision(3);
+
+    const std::size_t n = 4096;
+    const int reps = 2000;
+    std::vector<float> in(n), out(n);
+
+    std::cout << "\nThroughput (" << n << " samples x " << reps << " reps, Msamples/s):" << std::endl;
+    for (const auto& f : funcs)
+    {
+        std::uniform_real_distribution<float> dist(f.lo, f.hi);
+        for (auto& v : in) v = dist(rng);
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < reps; ++r)
+        {
+            f.batch(in, out);
+            if (out[0] > 1.0e30f) std::cout << "Never happens";
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < reps; ++r)
+        {
+            f.loop(in, out);
+            if (out[0] > 1.0e30f) std::cout << "Never happens";
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        const double samples = static_cast<double>(n) * reps;
+        const double batchMsps = samples / std::chrono::duration<double, std::micro>(t1 - t0).count();
+        const double loopMsps  = samples / std::chrono::duration<double, std::micro>(t2 - t1).count();
+
+        csv << f.name << "," << batchMsps << "," << loopMsps << "," << (batchMsps / loopMsps) << "\n";
+        std::cout << "  " << std::left << std::setw(14) << f.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(9) << batchMsps << " batch  " << std::setw(9) << loopMsps << " loop  ("
+                  << std::setprecision(2) << (batchMsps / loopMsps) << "x)" << std::defaultfloat << std::endl;
+    }
+    csv.close();
+
+    return passed ? 0 : 1;
+}
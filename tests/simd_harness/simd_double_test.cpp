@@ -0,0 +1,174 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+#include <numbers>
+#include "dsp/math/fastermath_double.h"
+
+using namespace MarsDSP;
+
+// Accuracy sweep for the double-precision family. Every function is checked
+// against the long double libm reference, and the SSE2 / AVX lanes against the
+// scalar path, which runs the same operation sequence.
+struct FuncInfo
+{
+    std::string name;
+    double start, end;
+    bool relative;              // bound is relative to the reference
+    double documentedMaxErr;
+    SIMD_M128D (*simd)(SIMD_M128D);
+#ifdef MARSCORE_SIMD_AVX
+    SIMD_M256D (*avx)(SIMD_M256D);
+#endif
+    double (*scalar)(double);
+    long double (*reference)(long double);
+};
+
+#ifdef MARSCORE_SIMD_AVX
+#define AVX_KERNEL(fn) [](SIMD_M256D x) { return fn(x); },
+#else
+#define AVX_KERNEL(fn)
+#endif
+
+int main()
+{
+    const int steps = 65536;
+
+    const std::vector<FuncInfo> funcs = {
+        { "sin",       -std::numbers::pi, std::numbers::pi, false, 2.5e-16,
+          [](SIMD_M128D x) { return fasterSin(x); }, AVX_KERNEL(fasterSin)
+          [](double x) { return fasterSin(x); }, [](long double x) { return sinl(x); } },
+        { "cos",       -std::numbers::pi, std::numbers::pi, false, 2.5e-16,
+          [](SIMD_M128D x) { return fasterCos(x); }, AVX_KERNEL(fasterCos)
+          [](double x) { return fasterCos(x); }, [](long double x) { return cosl(x); } },
+        // LFO phase accumulators and biquad angles can run well past 2π
+        { "sin_wide",  -1.0e5, 1.0e5, false, 4.0e-16,
+          [](SIMD_M128D x) { return fasterSin(x); }, AVX_KERNEL(fasterSin)
+          [](double x) { return fasterSin(x); }, [](long double x) { return sinl(x); } },
+        { "cos_wide",  -1.0e5, 1.0e5, false, 4.0e-16,
+          [](SIMD_M128D x) { return fasterCos(x); }, AVX_KERNEL(fasterCos)
+          [](double x) { return fasterCos(x); }, [](long double x) { return cosl(x); } },
+        { "tan",       -1.5, 1.5, true, 6.0e-16,
+          [](SIMD_M128D x) { return fasterTan(x); }, AVX_KERNEL(fasterTan)
+          [](double x) { return fasterTan(x); }, [](long double x) { return tanl(x); } },
+        { "tanh",      -20.0, 20.0, false, 2.5e-16,
+          [](SIMD_M128D x) { return fasterTanh(x); }, AVX_KERNEL(fasterTanh)
+          [](double x) { return fasterTanh(x); }, [](long double x) { return tanhl(x); } },
+        { "tanh_small", -0.7, 0.7, true, 4.0e-16,
+          [](SIMD_M128D x) { return fasterTanh(x); }, AVX_KERNEL(fasterTanh)
+          [](double x) { return fasterTanh(x); }, [](long double x) { return tanhl(x); } },
+        // error of the wrapped angle, compared modulo 2π
+        { "boundToPi", -100.0, 100.0, false, 5.0e-14,
+          [](SIMD_M128D x) { return boundToPiSIMD(x); }, AVX_KERNEL(boundToPiSIMD)
+          [](double x) { return boundToPi(x); },
+          [](long double x) { return remainderl(x, 2.0L * std::numbers::pi_v<long double>); } },
+    };
+
+    std::ofstream csv("tests/simd_harness/logs/simd_double.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_double.csv" << std::endl;
+        return 1;
+    }
+
+    csv << "func,x,std_ref,fast_simd,err_simd,diff_simd_scalar,diff_avx_scalar\n";
+    csv << std::scientific << std::setprecision(17);
+
+#ifndef MARSCORE_SIMD_AVX
+    std::cout << "  (AVX path not compiled in, build with -mavx to check it)" << std::endl;
+#endif
+
+    bool passed = true;
+    for (const auto& f : funcs)
+    {
+        const double step_size = (f.end - f.start) / steps;
+        double maxErr = 0.0, maxDiff = 0.0, maxDiffAvx = 0.0;
+
+        for (int i = 0; i <= steps; i += 4)
+        {
+            double x_vals[4];
+            for (int j = 0; j < 4; ++j)
+                x_vals[j] = (i + j <= steps) ? f.start + static_cast<double>(i + j) * step_size : f.end;
+
+            double simd_results[4], avx_results[4];
+            SIMD_MM(storeu_pd)(simd_results, f.simd(SIMD_MM(loadu_pd)(x_vals)));
+            SIMD_MM(storeu_pd)(simd_results + 2, f.simd(SIMD_MM(loadu_pd)(x_vals + 2)));
+#ifdef MARSCORE_SIMD_AVX
+            SIMD_MM256(storeu_pd)(avx_results, f.avx(SIMD_MM256(loadu_pd)(x_vals)));
+#else
+            std::copy(simd_results, simd_results + 4, avx_results);
+#endif
+
+            for (int j = 0; j < 4; ++j)
+            {
+                if (i + j > steps) break;
+
+                const long double ref = f.reference(x_vals[j]);
+                const double scalar = f.scalar(x_vals[j]);
+                const double norm = f.relative ? static_cast<double>(std::abs(ref)) : 1.0;
+
+                double err = static_cast<double>(std::abs(ref - static_cast<long double>(simd_results[j])));
+                if (f.name == "boundToPi")
+                    err = std::min(err, std::abs(err - 2.0 * std::numbers::pi));
+                err /= norm;
+                const double diff = std::abs(simd_results[j] - scalar) / norm;
+                const double diffAvx = std::abs(avx_results[j] - scalar) / norm;
+
+                maxErr = std::max(maxErr, err);
+                maxDiff = std::max(maxDiff, diff);
+                maxDiffAvx = std::max(maxDiffAvx, diffAvx);
+
+                if ((i + j) % 32 == 0)
+                    csv << f.name << "," << x_vals[j] << "," << static_cast<double>(ref) << "," << simd_results[j] << ","
+                        << err << "," << diff << "," << diffAvx << "\n";
+            }
+        }
+
+        // scalar and SIMD run the same operation sequence; allow for FMA contraction
+        const bool ok = maxErr <= f.documentedMaxErr && maxDiff <= f.documentedMaxErr && maxDiffAvx <= f.documentedMaxErr;
+        passed = passed && ok;
+        std::cout << "  " << std::setw(10) << f.name << "  max " << (f.relative ? "rel" : "abs") << " err "
+                  << std::scientific << std::setprecision(3) << maxErr << "  (bound " << f.documentedMaxErr
+                  << ")  SIMD vs scalar " << maxDiff << "  AVX vs scalar " << maxDiffAvx << "  "
+                  << (ok ? "PASSED" : "FAILED") << std::defaultfloat << std::endl;
+    }
+
+    csv.close();
+
+    // special values: NaN propagates, huge / infinite angles fall back to
+    // (sin, cos) = (0, 1), tanh saturates exactly
+    {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const double inf = std::numeric_limits<double>::infinity();
+        const double in[4] = { nan, inf, -1.0e300, 40.0 };
+
+        double s[4], c[4], th[4];
+        SIMD_M128D vs, vc;
+        fasterSinCos(SIMD_MM(loadu_pd)(in), vs, vc);
+        SIMD_MM(storeu_pd)(s, vs);
+        SIMD_MM(storeu_pd)(c, vc);
+        fasterSinCos(SIMD_MM(loadu_pd)(in + 2), vs, vc);
+        SIMD_MM(storeu_pd)(s + 2, vs);
+        SIMD_MM(storeu_pd)(c + 2, vc);
+        SIMD_MM(storeu_pd)(th, fasterTanh(SIMD_MM(loadu_pd)(in)));
+        SIMD_MM(storeu_pd)(th + 2, fasterTanh(SIMD_MM(loadu_pd)(in + 2)));
+
+        const bool edges = std::isnan(s[0]) && std::isnan(c[0]) && std::isnan(th[0])
+                        && s[1] == 0.0 && c[1] == 1.0 && s[2] == 0.0 && c[2] == 1.0
+                        && th[1] == 1.0 && th[2] == -1.0 && th[3] == 1.0
+                        && std::isnan(fasterSin(nan)) && std::isnan(fasterTanh(nan))
+                        && fasterTanh(-inf) == -1.0 && fasterCos(inf) == 1.0;
+        if (!edges)
+        {
+            std::cout << "FAILED special values (NaN / inf / huge angles)" << std::endl;
+            passed = false;
+        }
+    }
+
+    std::cout << (passed ? "All double-precision tests PASSED." : "Some double-precision tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
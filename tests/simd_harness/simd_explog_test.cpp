@@ -0,0 +1,122 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include "dsp/math/fastermath.h"
+
+using namespace MarsDSP;
+
+// Accuracy sweep for the control-rate exp / log / pow / dB helpers. Each
+// function is swept over the range the engine actually feeds it and fails if
+// it exceeds the bound documented next to its kernel in fastermath.h.
+struct FuncInfo
+{
+    std::string name;
+    float start, end;
+    bool relative;              // bound is relative to the reference
+    double documentedMaxErr;
+    SIMD_M128 (*simd)(SIMD_M128);
+    float (*scalar)(float);
+    double (*reference)(double);
+};
+
+int main()
+{
+    const int steps = 16384;
+
+    const std::vector<FuncInfo> funcs = {
+        { "exp2",     -126.0f, 126.0f,  true,  2.0e-7,
+          [](SIMD_M128 x) { return fasterExp2(x); }, [](float x) { return fasterExp2(x); },
+          [](double x) { return std::exp2(x); } },
+        { "exp",      -20.0f,  20.0f,   true,  1.5e-6,
+          [](SIMD_M128 x) { return fasterExp(x); }, [](float x) { return fasterExp(x); },
+          [](double x) { return std::exp(x); } },
+        { "log2_near1", 0.7071f, 1.4142f, false, 1.5e-7,
+          [](SIMD_M128 x) { return fasterLog2(x); }, [](float x) { return fasterLog2(x); },
+          [](double x) { return std::log2(x); } },
+        { "log2",     1.0e-6f, 1.0e6f,  false, 2.0e-6,
+          [](SIMD_M128 x) { return fasterLog2(x); }, [](float x) { return fasterLog2(x); },
+          [](double x) { return std::log2(x); } },
+        // one-pole decay over a block: 0.999^n, the SmootherBank::beginBlock lag case
+        { "pow_decay", 1.0f,   4096.0f, true,  1.0e-6,
+          [](SIMD_M128 n) { return fasterPow(SIMD_MM(set1_ps)(0.999f), n); },
+          [](float n) { return fasterPow(0.999f, n); },
+          [](double n) { return std::pow(static_cast<double>(0.999f), n); } },
+        { "db_to_gain", -99.0f, 120.0f, true,  1.5e-6,
+          [](SIMD_M128 x) { return dbToGain(x); }, [](float x) { return dbToGain(x); },
+          [](double x) { return std::pow(10.0, x / 20.0); } },
+        { "gain_to_db", 1.0e-5f, 4.0f,  false, 1.5e-5,
+          [](SIMD_M128 x) { return gainToDb(x); }, [](float x) { return gainToDb(x); },
+          [](double x) { return 20.0 * std::log10(x); } },
+    };
+
+    std::ofstream csv("tests/simd_harness/logs/simd_explog.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_explog.csv" << std::endl;
+        return 1;
+    }
+
+    csv << "func,x,std_ref,fast_simd,err_simd,diff_simd_scalar\n";
+    csv << std::scientific << std::setprecision(9);
+
+    bool passed = true;
+    for (const auto& f : funcs)
+    {
+        const float step_size = (f.end - f.start) / steps;
+        double maxErr = 0.0, maxDiff = 0.0;
+
+        for (int i = 0; i <= steps; i += 4)
+        {
+            float x_vals[4];
+            for (int j = 0; j < 4; ++j)
+                x_vals[j] = (i + j <= steps) ? f.start + static_cast<float>(i + j) * step_size : f.end;
+
+            float simd_results[4];
+            SIMD_MM(storeu_ps)(simd_results, f.simd(SIMD_MM(loadu_ps)(x_vals)));
+
+            for (int j = 0; j < 4; ++j)
+            {
+                if (i + j > steps) break;
+
+                const double ref = f.reference(x_vals[j]);
+                double err = std::abs(ref - simd_results[j]);
+                if (f.relative) err /= std::abs(ref);
+                double diff = std::abs(simd_results[j] - f.scalar(x_vals[j]));
+                if (f.relative) diff /= std::abs(ref);
+
+                maxErr = std::max(maxErr, err);
+                maxDiff = std::max(maxDiff, diff);
+
+                if ((i + j) % 8 == 0)
+                    csv << f.name << "," << x_vals[j] << "," << ref << "," << simd_results[j] << ","
+                        << err << "," << diff << "\n";
+            }
+        }
+
+        // scalar and SIMD run the same operation sequence; allow for FMA contraction
+        const bool ok = maxErr <= f.documentedMaxErr && maxDiff <= f.documentedMaxErr;
+        passed = passed && ok;
+        std::cout << "  " << std::setw(10) << f.name << "  max " << (f.relative ? "rel" : "abs") << " err "
+                  << std::scientific << maxErr << "  (bound " << f.documentedMaxErr << ")  SIMD vs scalar "
+                  << maxDiff << "  " << (ok ? "PASSED" : "FAILED") << std::defaultfloat << std::endl;
+    }
+
+    csv.close();
+
+    // edge conventions shared with juce::Decibels
+    const bool edges = dbToGain(-100.0f) == 0.0f && dbToGain(-250.0f) == 0.0f
+                    && gainToDb(0.0f) == -100.0f && gainToDb(-1.0f) == -100.0f
+                    && fasterLog2(0.0f) == -126.0f && fasterLog2(std::nanf("")) == -126.0f;
+    if (!edges)
+    {
+        std::cout << "FAILED edge conventions (dB floor / log2 clamp)" << std::endl;
+        passed = false;
+    }
+
+    std::cout << (passed ? "All exp/log tests PASSED." : "Some exp/log tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include <numbers>
+#include "dsp/engine/modulation/lfo_bank.h"
+#include "utils/helpers/temposync.h"
+
+using namespace MarsDSP;
+using namespace MarsDSP::DSP;
+
+// LFO bank: shapes against a double-precision reference driven by the same
+// integer phase, block advance against per-sample stepping, rate accuracy and
+// the host tempo-sync helpers → simd_lfo_bank.csv
+struct Check
+{
+    std::string name;
+    double maxErr;
+    double bound;
+};
+
+static double cycleOf(const std::uint32_t phase) { return static_cast<double>(phase) / 4294967296.0; }
+
+int main()
+{
+    constexpr double fs = 48000.0;
+    constexpr int numSamples = 96000;
+    const double rates[8] = { 0.05, 0.3, 1.0, 2.5, 7.0, 13.0, 55.0, 440.0 };
+
+    std::vector<Check> checks;
+
+    std::ofstream csv("tests/simd_harness/logs/simd_lfo_bank.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_lfo_bank.csv" << std::endl;
+        return 1;
+    }
+    csv << "shape,lfo,sample,cycle,value,reference\n";
+    csv << std::scientific << std::setprecision(9);
+
+    // ---- sine / triangle vs reference at the same phase, 8 LFOs in two registers ----
+    for (const auto shape : { LfoShape::Sine, LfoShape::Triangle })
+    {
+        LfoBank<8> bank;
+        bank.prepare(fs);
+        for (int i = 0; i < 8; ++i)
+        {
+            bank.setRateHz(i, rates[i]);
+            bank.setShape(i, shape);
+        }
+
+        double maxErr = 0.0;
+        for (int n = 0; n < numSamples; ++n)
+        {
+            bank.process();
+            for (int i = 0; i < 8; ++i)
+            {
+                const double t   = cycleOf(bank.getPhase(i));
+                const double ref = shape == LfoShape::Sine ? std::sin(2.0 * std::numbers::pi * t)
+                                 : t < 0.25 ? 4.0 * t : t < 0.75 ? 2.0 - 4.0 * t : 4.0 * t - 4.0;
+                maxErr = std::max(maxErr, std::abs(bank.value(i) - ref));
+                if (n % 97 == 0 && (i == 2 || i == 6))
+                    csv << (shape == LfoShape::Sine ? "sine" : "triangle") << "," << i << "," << n << "," << t << ","
+                        << bank.value(i) << "," << ref << "\n";
+            }
+        }
+        // sine inherits the pade fasterSin error, largest towards ±π
+        checks.push_back({ shape == LfoShape::Sine ? "sine" : "triangle", maxErr,
+                           shape == LfoShape::Sine ? 1.5e-5 : 1.0e-6 });
+    }
+
+    // ---- smoothed random: bounded, and continuous across cycle boundaries ----
+    {
+        LfoBank<8> bank;
+        bank.prepare(fs);
+        for (int i = 0; i < 8; ++i)
+        {
+            bank.setRateHz(i, rates[i]);
+            bank.setShape(i, LfoShape::SmoothRandom);
+        }
+
+        float prev[8] = {};
+        double maxExcess = 0.0;     // step beyond the sin² slope limit, or beyond [-1, 1]
+        for (int n = 0; n < numSamples; ++n)
+        {
+            bank.process();
+            for (int i = 0; i < 8; ++i)
+            {
+                const float v = bank.value(i);
+                // |d/dt (b - a)·sin²(πt/2)| ≤ 2 · π/2 per cycle
+                const double limit = std::numbers::pi * rates[i] / fs + 1.0e-6;
+                if (n > 0) maxExcess = std::max(maxExcess, std::abs(static_cast<double>(v - prev[i])) - limit);
+                maxExcess = std::max(maxExcess, std::abs(static_cast<double>(v)) - 1.0);
+                prev[i] = v;
+                if (n % 97 == 0 && (i == 2 || i == 6))
+                    csv << "random," << i << "," << n << "," << cycleOf(bank.getPhase(i)) << "," << v << ",0\n";
+            }
+        }
+        checks.push_back({ "random_slope", std::max(maxExcess, 0.0), 0.0 });
+    }
+
+    // ---- advance(n) lands on the same phase and value as n × process() ----
+    {
+        LfoBank<8> stepped, block;
+        stepped.prepare(fs);
+        block.prepare(fs);
+        for (int i = 0; i < 8; ++i)
+        {
+            const auto shape = static_cast<LfoShape>(i % 3);
+            stepped.setRateHz(i, rates[i]); stepped.setShape(i, shape);
+            block.setRateHz(i, rates[i]);   block.setShape(i, shape);
+        }
+
+        double maxDiff = 0.0;
+        const int blockSizes[] = { 1, 7, 64, 100, 512 };
+        for (int b = 0; b < 200; ++b)
+        {
+            const int bs = blockSizes[b % 5];
+            for (int n = 0; n < bs; ++n) stepped.process();
+            block.advance(bs);
+            for (int i = 0; i < 8; ++i)
+            {
+                if (stepped.getPhase(i) != block.getPhase(i)) maxDiff = std::max(maxDiff, 1.0);
+                maxDiff = std::max(maxDiff, static_cast<double>(std::abs(stepped.value(i) - block.value(i))));
+            }
+        }
+        checks.push_back({ "advance_vs_process", maxDiff, 0.0 });
+    }
+
+    // ---- rate accuracy: one second at 1 Hz is one full cycle ----
+    // the increment is rounded to fs/2^32 Hz, so it may drift by half a step per second
+    {
+        LfoBank<4> bank;
+        bank.prepare(fs);
+        bank.setRateHz(0, 1.0);
+        bank.advance(static_cast<int>(fs));
+        const double t = cycleOf(bank.getPhase(0));
+        checks.push_back({ "rate_1hz_drift", std::min(t, 1.0 - t), 0.5 * fs / 4294967296.0 });
+    }
+
+    // ---- tempo sync helpers ----
+    {
+        double maxErr = 0.0;
+        maxErr = std::max(maxErr, std::abs(syncedRateHz(120.0, SyncDivision::Quarter) - 2.0));
+        maxErr = std::max(maxErr, std::abs(syncedRateHz(90.0, SyncDivision::Bar) - 0.375));
+        maxErr = std::max(maxErr, std::abs(cycleOf(phaseFromPpq(1.5, SyncDivision::Quarter)) - 0.5));
+        maxErr = std::max(maxErr, std::abs(cycleOf(phaseFromPpq(-0.25, SyncDivision::Quarter)) - 0.75));
+        maxErr = std::max(maxErr, std::abs(cycleOf(phaseFromPpq(9.0, SyncDivision::TwoBars)) - 0.125));
+        checks.push_back({ "tempo_sync", maxErr, 1.0e-9 });
+    }
+
+    csv.close();
+
+    bool passed = true;
+    for (const auto& c : checks)
+    {
+        const bool ok = c.maxErr <= c.bound;
+        passed = passed && ok;
+        std::cout << "  " << std::left << std::setw(20) << c.name << std::right << "  max err " << std::scientific
+                  << c.maxErr << "  (bound " << c.bound << ")  " << (ok ? "PASSED" : "FAILED") << std::defaultfloat << std::endl;
+    }
+
+    std::cout << (passed ? "All LFO bank tests PASSED." : "Some LFO bank tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
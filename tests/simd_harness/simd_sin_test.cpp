@@ -4,6 +4,8 @@
 #include <numbers>
 #include <vector>
 #include <iomanip>
+#include <algorithm>
+#include <limits>
 #include "dsp/math/fastermath.h"
 
 int main()
@@ -78,5 +80,103 @@ int main()
     csv.close();
     std::cout << "Successfully generated tests/simd_harness/logs/simd_sin_results.csv with " << (steps + 1) << " data points." << std::endl;
 
-    return 0;
+    // full-range sweep of the fused fasterSinCos kernel. the Pade kernels
+    // above only hold on [-π, π]; this one range-reduces itself.
+    const float fr_end = 1.0e5f;
+    const int fr_steps = 1 << 17;
+    const float fr_step_size = 2.0f * fr_end / fr_steps;
+
+    std::ofstream fr_csv("tests/simd_harness/logs/simd_sin_fullrange_results.csv");
+    if (!fr_csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_sin_fullrange_results.csv" << std::endl;
+        return 1;
+    }
+
+    fr_csv << "x,std_sin,sincos_scalar,sincos_simd,abs_err_scalar,abs_err_simd,diff_simd_scalar\n";
+    fr_csv << std::fixed << std::setprecision(10);
+
+    double max_err_near = 0.0, max_err_far = 0.0, max_diff = 0.0;
+
+    for (int i = 0; i <= fr_steps; i += 4)
+    {
+        float x_vals[4];
+        for (int j = 0; j < 4; ++j)
+            x_vals[j] = (i + j <= fr_steps) ? -fr_end + static_cast<float>(i + j) * fr_step_size : 0.0f;
+
+        SIMD_M128 vs, vc;
+        MarsDSP::fasterSinCos(SIMD_MM(loadu_ps)(x_vals), vs, vc);
+
+        float simd_results[4];
+        SIMD_MM(storeu_ps)(simd_results, vs);
+
+        for (int j = 0; j < 4; ++j)
+        {
+            if (i + j > fr_steps) break;
+
+            const float x = x_vals[j];
+            float s, c;
+            MarsDSP::fasterSinCos(x, s, c);
+
+            const double ref = std::sin(static_cast<double>(x));
+            const double err_scalar = std::abs(ref - s);
+            const double err_simd = std::abs(ref - simd_results[j]);
+            const double diff = std::abs(s - simd_results[j]);
+
+            if (std::abs(x) <= 8192.0f) max_err_near = std::max(max_err_near, err_simd);
+            else                        max_err_far  = std::max(max_err_far, err_simd);
+            max_diff = std::max(max_diff, diff);
+
+            // the full file would be huge; keep every 16th point for plotting
+            if ((i + j) % 16 == 0)
+                fr_csv << x << "," << ref << "," << s << "," << simd_results[j] << ","
+                       << err_scalar << "," << err_simd << "," << diff << "\n";
+        }
+    }
+
+    fr_csv.close();
+
+    // documented in fastermath.h: ~1e-7 for |x| <= 8192, ~1e-6 up to 1e5
+    bool passed = max_err_near < 2.0e-7 && max_err_far < 2.0e-6 && max_diff < 1.0e-6;
+
+    // past kMaxRange only boundedness is promised; NaN must propagate
+    {
+        const float edge[4] = { 1.0e7f, -3.4e38f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() };
+        SIMD_M128 vs, vc;
+        MarsDSP::fasterSinCos(SIMD_MM(loadu_ps)(edge), vs, vc);
+        float es[4], ec[4];
+        SIMD_MM(storeu_ps)(es, vs);
+        SIMD_MM(storeu_ps)(ec, vc);
+
+        for (int j = 0; j < 3; ++j)
+            if (!(std::abs(es[j]) <= 1.0f && std::abs(ec[j]) <= 1.0f))
+            {
+                std::cout << "FAILED fasterSinCos not bounded at x = " << edge[j] << std::endl;
+                passed = false;
+            }
+        if (!std::isnan(es[3]) || !std::isnan(ec[3]))
+        {
+            std::cout << "FAILED fasterSinCos does not propagate NaN" << std::endl;
+            passed = false;
+        }
+
+        // the scalar kernel must agree without ever converting NaN / inf to int
+        for (int j = 0; j < 4; ++j)
+        {
+            float s, c;
+            MarsDSP::fasterSinCos(edge[j], s, c);
+            const bool same = j < 3 ? (s == es[j] && c == ec[j]) : (std::isnan(s) && std::isnan(c));
+            if (!same)
+            {
+                std::cout << "FAILED scalar fasterSinCos differs from SIMD at x = " << edge[j] << std::endl;
+                passed = false;
+            }
+        }
+    }
+
+    std::cout << "fasterSinCos sin: max abs err " << max_err_near << " (|x| <= 8192), "
+              << max_err_far << " (|x| <= 1e5), SIMD vs scalar " << max_diff
+              << (passed ? "  PASSED" : "  FAILED") << std::endl;
+
+    return passed ? 0 : 1;
 }
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include <numbers>
+#include "dsp/engine/smoothing/smoother_bank.h"
+
+using namespace MarsDSP;
+using namespace MarsDSP::DSP;
+
+// Smoother bank: linear ramps and one-pole lag lanes against double-precision
+// references over random targets and block sizes, quad ramps against the
+// scalar at(), snap / block hand-over and projectEnd → simd_smoother_bank.csv
+struct Check
+{
+    std::string name;
+    double maxErr;
+    double bound;
+};
+
+int main()
+{
+    constexpr double fs = 48000.0;
+    constexpr int numParams = 8;
+    constexpr int numBlocks = 400;
+    const int blockSizes[] = { 1, 3, 4, 7, 64, 100, 511, 512 };
+    const double lagMs[] = { 1.0, 20.0, 150.0, 1000.0 };
+
+    std::vector<Check> checks;
+
+    std::ofstream csv("tests/simd_harness/logs/simd_smoother_bank.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_smoother_bank.csv" << std::endl;
+        return 1;
+    }
+    csv << "param,block,sample,value,reference\n";
+    csv << std::scientific << std::setprecision(9);
+
+    // lanes 0-3 linear, lanes 4-7 one-pole lag at lagMs[p - 4]
+    SmootherBank<numParams> bank;
+    double refValue[numParams] {};
+    double lagDecay[numParams] {};
+    for (int p = 4; p < numParams; ++p)
+    {
+        bank.setLagMs(p, lagMs[p - 4], fs);
+        lagDecay[p] = std::exp(-2.0 * std::numbers::pi / (lagMs[p - 4] * 0.001 * fs));
+    }
+
+    std::uint32_t rng = 0x1234567u;
+    auto nextTarget = [&]
+    {
+        rng = rng * 1664525u + 1013904223u;
+        return static_cast<float>(rng >> 8) / 16777216.0f * 2.0f - 1.0f;
+    };
+
+    double linErr = 0.0, lagErr = 0.0, quadVsAt = 0.0, endErr = 0.0, driftErr = 0.0;
+    int sampleClock = 0;
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        const int n = blockSizes[b % 8];
+        float targets[numParams];
+        for (int p = 0; p < numParams; ++p)
+        {
+            // hold targets for a few blocks so the lag lanes settle now and then
+            targets[p] = (b % 5 == 0 || p < 4) ? nextTarget() : bank.getTarget(p);
+            bank.setTarget(p, targets[p]);
+        }
+        bank.beginBlock(n);
+
+        for (int p = 0; p < numParams; ++p)
+        {
+            const double start = refValue[p];
+            const double end   = p < 4 ? static_cast<double>(targets[p])
+                                       : targets[p] + (start - targets[p]) * std::pow(lagDecay[p], n);
+
+            // block end
+            const double e = std::abs(bank.getBlockEnd(p) - end);
+            if (p < 4) endErr = std::max(endErr, e);
+            else       lagErr = std::max(lagErr, e);
+
+            // every sample of the block, relative to the ramp the bank started from
+            const auto ramp = bank.ramp(p);
+            auto vQ = SIMD_MM(setzero_ps)();
+            for (int i = 0; i < n; i += 4, vQ = SIMD_MM(add_ps)(vQ, SIMD_MM(set1_ps)(1.0f)))
+            {
+                alignas(16) float quad[4];
+                SIMD_MM(store_ps)(quad, ramp.quad(vQ));
+                for (int j = 0; j < 4 && i + j < n; ++j)
+                {
+                    const double ref = bank.getCurrent(p) + (bank.getBlockEnd(p) - static_cast<double>(bank.getCurrent(p))) * (i + j) / n;
+                    const float  at  = bank.at(p, i + j);
+                    if (p < 4) linErr = std::max(linErr, std::abs(quad[j] - ref));
+                    quadVsAt = std::max(quadVsAt, static_cast<double>(std::abs(quad[j] - at)));
+                    if ((p == 1 || p == 6) && (sampleClock + i + j) % 13 == 0)
+                        csv << p << "," << b << "," << sampleClock + i + j << "," << quad[j] << "," << ref << "\n";
+                }
+            }
+
+            // the float bank and the double reference must not walk apart over blocks
+            driftErr = std::max(driftErr, std::abs(bank.getCurrent(p) - start));
+            refValue[p] = end;
+        }
+
+        bank.endBlock();
+        sampleClock += n;
+    }
+
+    // values in [-1, 1], deltas ≤ 2 / n: a few float ulps of the larger endpoint
+    checks.push_back({ "linear_ramp",     linErr,   2.0e-6 });
+    checks.push_back({ "linear_end",      endErr,   0.0 });
+    // the lag coefficient goes through fasterExp / fasterLog2 (as OnePoleLag
+    // did), and the log error is scaled by the block length in the decay
+    checks.push_back({ "lag_end",         lagErr,   5.0e-5 });
+    checks.push_back({ "quad_vs_at",      quadVsAt, 2.0e-6 });
+    checks.push_back({ "block_handover",  driftErr, 5.0e-5 });
+
+    // ---- snap: no ramp in the next block, lag lanes included ----
+    {
+        double maxErr = 0.0;
+        for (int p = 0; p < numParams; ++p)
+        {
+            bank.snap(p, 0.25f);
+            bank.setTarget(p, 0.25f);
+        }
+        bank.beginBlock(64);
+        for (int p = 0; p < numParams; ++p)
+        {
+            for (int i = 0; i < 64; ++i)
+                maxErr = std::max(maxErr, static_cast<double>(std::abs(bank.at(p, i) - 0.25f)));
+            alignas(16) float quad[4];
+            SIMD_MM(store_ps)(quad, bank.ramp(p).quad(SIMD_MM(set1_ps)(15.0f)));
+            for (float v : quad)
+                maxErr = std::max(maxErr, static_cast<double>(std::abs(v - 0.25f)));
+        }
+        bank.endBlock();
+        checks.push_back({ "snap", maxErr, 0.0 });
+    }
+
+    // ---- projectEnd: the block end beginBlock would reach, bank untouched ----
+    {
+        double maxErr = 0.0;
+        for (const int n : blockSizes)
+        {
+            for (int p = 0; p < numParams; ++p)
+            {
+                const float toward = nextTarget();
+                const float before = bank.getCurrent(p);
+                const float projected = bank.projectEnd(p, toward, n);
+                maxErr = std::max(maxErr, static_cast<double>(std::abs(bank.getCurrent(p) - before)));
+                bank.setTarget(p, toward);
+                bank.beginBlock(n);
+                maxErr = std::max(maxErr, static_cast<double>(std::abs(bank.getBlockEnd(p) - projected)));
+            }
+            bank.endBlock();
+        }
+        checks.push_back({ "project_end", maxErr, 0.0 });
+    }
+
+    csv.close();
+
+    bool passed = true;
+    for (const auto& c : checks)
+    {
+        const bool ok = c.maxErr <= c.bound;
+        passed = passed && ok;
+        std::cout << "  " << std::left << std::setw(20) << c.name << std::right << "  max err " << std::scientific
+                  << c.maxErr << "  (bound " << c.bound << ")  " << (ok ? "PASSED" : "FAILED") << std::defaultfloat << std::endl;
+    }
+
+    std::cout << (passed ? "All smoother bank tests PASSED." : "Some smoother bank tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <numbers>
+#include <vector>
+#include <iomanip>
+#include <algorithm>
+#include "dsp/math/fastermath.h"
+#include "dsp/engine/saturation/tanh_adaa.h"
+
+using namespace MarsDSP;
+using namespace MarsDSP::DSP;
+
+// ADAA tanh checks:
+//   1. fasterLogCosh accuracy vs std::log(std::cosh) → simd_tanh_adaa_results.csv
+//   2. TanhADAA1 SIMD path matches the scalar path sample for sample
+//   3. alias energy below fs/4 of a driven 5010 Hz sine, memoryless vs ADAA1
+//      → simd_tanh_adaa_alias.csv
+
+// energy below maxHz that is NOT on a harmonic of f0 (i.e. aliasing), relative
+// to the harmonic energy. ADAA1's kernel is a sinc² that is weak near Nyquist,
+// so the meaningful (and audible) win is on aliases folded into the lower band.
+static double aliasRatioDb(const std::vector<float>& y, double fs, double f0, double maxHz)
+{
+    const int N = static_cast<int>(y.size());
+    const double binHz = fs / N;
+    double harmonic = 0.0, alias = 0.0;
+
+    for (int k = 1; k < N / 2 && k * binHz < maxHz; ++k)
+    {
+        // direct DFT; N is small enough for a test
+        double re = 0.0, im = 0.0;
+        const double w = 2.0 * std::numbers::pi * k / N;
+        for (int n = 0; n < N; ++n)
+        {
+            re += y[n] * std::cos(w * n);
+            im -= y[n] * std::sin(w * n);
+        }
+        const double p = re * re + im * im;
+        const double ratio = (k * binHz) / f0;
+        if (std::abs(ratio - std::round(ratio)) < 1.0e-6) harmonic += p;
+        else                                               alias    += p;
+    }
+    return 10.0 * std::log10(alias / harmonic);
+}
+
+int main()
+{
+    bool passed = true;
+
+    // ---- 1. log-cosh accuracy ----
+    {
+        const float start = -10.0f;
+        const float end = 10.0f;
+        const int steps = 4096;
+        const float step_size = (end - start) / steps;
+
+        std::ofstream csv("tests/simd_harness/logs/simd_tanh_adaa_results.csv");
+        if (!csv.is_open())
+        {
+            std::cerr << "Failed to open tests/simd_harness/logs/simd_tanh_adaa_results.csv" << std::endl;
+            return 1;
+        }
+
+        csv << "x,std_logcosh,logcosh_scalar,logcosh_simd,abs_err_scalar,abs_err_simd,diff_simd_scalar\n";
+        csv << std::fixed << std::setprecision(10);
+
+        double maxErr = 0.0;
+        for (int i = 0; i <= steps; i += 4)
+        {
+            float x_vals[4];
+            for (int j = 0; j < 4; ++j)
+                x_vals[j] = (i + j <= steps) ? start + static_cast<float>(i + j) * step_size : 0.0f;
+
+            float simd_results[4];
+            SIMD_MM(storeu_ps)(simd_results, fasterLogCosh(SIMD_MM(loadu_ps)(x_vals)));
+
+            for (int j = 0; j < 4; ++j)
+            {
+                if (i + j > steps) break;
+
+                const double ref = std::log(std::cosh(static_cast<double>(x_vals[j])));
+                const float scalar = fasterLogCosh(x_vals[j]);
+                const double errScalar = std::abs(ref - scalar);
+                const double errSimd = std::abs(ref - simd_results[j]);
+                maxErr = std::max(maxErr, errSimd);
+
+                csv << x_vals[j] << "," << ref << "," << scalar << "," << simd_results[j] << ","
+                    << errScalar << "," << errSimd << "," << std::abs(scalar - simd_results[j]) << "\n";
+            }
+        }
+        csv.close();
+
+        // float rounding of |x| near 10 is ~5e-7 on its own
+        const bool ok = maxErr < 2.0e-6;
+        passed = passed && ok;
+        std::cout << "fasterLogCosh max abs err " << maxErr << (ok ? "  PASSED" : "  FAILED") << std::endl;
+    }
+
+    // ---- 2. SIMD vs scalar streaming ----
+    {
+        const int n = 4096;
+        std::vector<float> x(n);
+        for (int i = 0; i < n; ++i)
+            x[i] = 3.0f * std::sin(0.01f * i) + ((i % 97 == 0) ? 2.0f : 0.0f);
+
+        TanhADAA1<> simd, scalar;
+        double maxDiff = 0.0;
+        for (int i = 0; i < n; i += 4)
+        {
+            float out[4];
+            SIMD_MM(storeu_ps)(out, simd.process(SIMD_MM(loadu_ps)(&x[i])));
+            for (int j = 0; j < 4; ++j)
+                maxDiff = std::max(maxDiff, static_cast<double>(std::abs(out[j] - scalar.process(x[i + j]))));
+        }
+        const bool ok = maxDiff < 1.0e-5;
+        passed = passed && ok;
+        std::cout << "TanhADAA1 SIMD vs scalar max diff " << maxDiff << (ok ? "  PASSED" : "  FAILED") << std::endl;
+    }
+
+    // ---- 3. alias reduction ----
+    {
+        const double fs = 48000.0;
+        const double f0 = 5010.0;
+        const int n = 4800;
+        const std::vector<float> drives = { 1.0f, 2.0f, 4.0f, 8.0f };
+
+        std::ofstream csv("tests/simd_harness/logs/simd_tanh_adaa_alias.csv");
+        csv << "drive,alias_db_memoryless,alias_db_adaa1,improvement_db\n";
+
+        for (float drive : drives)
+        {
+            std::vector<float> yMem(n), yAdaa(n);
+            TanhADAA1<> adaa;
+            // let the one-sample history settle on the waveform before measuring
+            for (int i = 0; i < n; ++i)
+                adaa.process(drive * static_cast<float>(std::sin(2.0 * std::numbers::pi * f0 * (i - n) / fs)));
+            for (int i = 0; i < n; i += 4)
+            {
+                float xin[4];
+                for (int j = 0; j < 4; ++j)
+                    xin[j] = drive * static_cast<float>(std::sin(2.0 * std::numbers::pi * f0 * (i + j) / fs));
+                SIMD_MM(storeu_ps)(&yMem[i],  fasterTanhBounded(SIMD_MM(loadu_ps)(xin)));
+                SIMD_MM(storeu_ps)(&yAdaa[i], adaa.process(SIMD_MM(loadu_ps)(xin)));
+            }
+
+            const double mem = aliasRatioDb(yMem, fs, f0, fs / 4.0);
+            const double ad  = aliasRatioDb(yAdaa, fs, f0, fs / 4.0);
+            csv << drive << "," << mem << "," << ad << "," << (mem - ad) << "\n";
+            std::cout << "drive " << drive << ": alias " << mem << " dB → " << ad << " dB" << std::endl;
+
+            // at real drive ADAA1 must buy a clear improvement
+            if (drive >= 4.0f && mem - ad < 12.0)
+            {
+                std::cout << "FAILED alias reduction at drive " << drive << std::endl;
+                passed = false;
+            }
+        }
+    }
+
+    std::cout << (passed ? "All ADAA tests PASSED." : "Some ADAA tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
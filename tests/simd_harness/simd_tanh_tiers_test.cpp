@@ -0,0 +1,110 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include "dsp/math/fastermath.h"
+
+using namespace MarsDSP;
+
+// Accuracy sweep for every TanhTier saturator. Covers [-8, 8] so the clamp
+// region of each tier is exercised, and fails if any tier exceeds the max
+// error documented next to its kernel in fastermath.h.
+struct TierInfo
+{
+    std::string name;
+    float documentedMaxErr;
+    SIMD_M128 (*simd)(SIMD_M128);
+    float (*scalar)(float);
+};
+
+int main()
+{
+    const float start = -8.0f;
+    const float end = 8.0f;
+    const int steps = 8192;
+    const float step_size = (end - start) / steps;
+
+    const std::vector<TierInfo> tiers = {
+        { "pade76",     1.1e-4f, fasterTanhTiered<TanhTier::Pade76>,     fasterTanhTiered<TanhTier::Pade76>     },
+        { "pade76rcp",  1.1e-4f, fasterTanhTiered<TanhTier::Pade76Rcp>,  fasterTanhTiered<TanhTier::Pade76Rcp>  },
+        { "pade54",     1.5e-3f, fasterTanhTiered<TanhTier::Pade54>,     fasterTanhTiered<TanhTier::Pade54>     },
+        { "rational32", 2.5e-2f, fasterTanhTiered<TanhTier::Rational32>, fasterTanhTiered<TanhTier::Rational32> },
+        { "lut",        7.0e-6f, fasterTanhTiered<TanhTier::Lut>,        fasterTanhTiered<TanhTier::Lut>        },
+    };
+
+    std::ofstream csv("tests/simd_harness/logs/simd_tanh_tiers_results.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/simd_tanh_tiers_results.csv" << std::endl;
+        return 1;
+    }
+
+    csv << "x,std_tanh";
+    for (const auto& t : tiers) csv << "," << t.name << "_simd";
+    for (const auto& t : tiers) csv << ",abs_err_simd_" << t.name;
+    csv << ",diff_simd_scalar\n";
+    csv << std::fixed << std::setprecision(10);
+
+    std::vector<float> maxErr(tiers.size(), 0.0f);
+    float maxSimdScalar = 0.0f;
+
+    for (int i = 0; i <= steps; i += 4)
+    {
+        float x_vals[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (int j = 0; j < 4; ++j)
+            x_vals[j] = (i + j <= steps) ? start + static_cast<float>(i + j) * step_size : 0.0f;
+
+        const SIMD_M128 vx = SIMD_MM(loadu_ps)(x_vals);
+
+        float simd_results[8][4];
+        for (size_t t = 0; t < tiers.size(); ++t)
+            SIMD_MM(storeu_ps)(simd_results[t], tiers[t].simd(vx));
+
+        for (int j = 0; j < 4; ++j)
+        {
+            if (i + j > steps) break;
+
+            const float x = x_vals[j];
+            const float ref = std::tanh(x);
+            float diff = 0.0f;
+
+            csv << x << "," << ref;
+            for (size_t t = 0; t < tiers.size(); ++t)
+                csv << "," << simd_results[t][j];
+            for (size_t t = 0; t < tiers.size(); ++t)
+            {
+                const float err = std::abs(ref - simd_results[t][j]);
+                maxErr[t] = std::max(maxErr[t], err);
+                diff = std::max(diff, std::abs(simd_results[t][j] - tiers[t].scalar(x)));
+                csv << "," << err;
+            }
+            csv << "," << diff << "\n";
+            maxSimdScalar = std::max(maxSimdScalar, diff);
+        }
+    }
+
+    csv.close();
+    std::cout << "Successfully generated tests/simd_harness/logs/simd_tanh_tiers_results.csv with " << (steps + 1) << " data points." << std::endl;
+
+    bool passed = true;
+    for (size_t t = 0; t < tiers.size(); ++t)
+    {
+        const bool ok = maxErr[t] <= tiers[t].documentedMaxErr;
+        passed = passed && ok;
+        std::cout << "  " << std::setw(10) << tiers[t].name << "  max abs err " << std::scientific
+                  << maxErr[t] << "  (bound " << tiers[t].documentedMaxErr << ")  "
+                  << (ok ? "PASSED" : "FAILED") << std::defaultfloat << std::endl;
+    }
+
+    // scalar tails use a true divide; SIMD rcp tiers may differ by the NR error
+    if (maxSimdScalar > 1.0e-6f)
+    {
+        std::cout << "FAILED SIMD vs scalar agreement: " << maxSimdScalar << std::endl;
+        passed = false;
+    }
+
+    return passed ? 0 : 1;
+}
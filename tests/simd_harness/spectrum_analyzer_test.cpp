@@ -0,0 +1,208 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <cmath>
+#include <cstdint>
+#include "dsp/engine/metering/spectrum_analyzer.h"
+#include "utils/helpers/spsc_ring.h"
+#include "rt_guard.h"
+
+using namespace MarsDSP;
+using namespace MarsDSP::DSP;
+
+// Spectrum analyser: SpscRing bulk push / pop across the wrap, a sine's band
+// and level at two sample rates, release, nothing rt_guard.h traps on push
+// or analyse (allocation of any form, lock, blocking syscall),
+// and the analysis thread running and reporting its load → spectrum_analyzer.csv
+static int loudestBand(const SpectrumAnalyzer::Bands& bands)
+{
+    int best = 0;
+    for (int b = 1; b < SpectrumAnalyzer::kNumBands; ++b)
+        if (bands[static_cast<size_t>(b)] > bands[static_cast<size_t>(best)])
+            best = b;
+    return best;
+}
+
+static void pushSine(SpectrumAnalyzer& analyzer, double hz, double sr, float amplitude, int numSamples, bool stereo, int64_t& phase)
+{
+    std::vector<float> left(256), right(256);
+    for (int done = 0; done < numSamples; done += 256)
+    {
+        for (int n = 0; n < 256; ++n)
+        {
+            left[static_cast<size_t>(n)]  = amplitude * static_cast<float>(std::sin(2.0 * M_PI * hz * static_cast<double>(phase + n) / sr));
+            right[static_cast<size_t>(n)] = left[static_cast<size_t>(n)];
+        }
+        phase += 256;
+        analyzer.push(left.data(), stereo ? right.data() : nullptr, 256);
+    }
+}
+
+int main()
+{
+    bool passed = true;
+
+    std::ofstream csv("tests/simd_harness/logs/spectrum_analyzer.csv");
+    if (!csv.is_open())
+    {
+        std::cerr << "Failed to open tests/simd_harness/logs/spectrum_analyzer.csv" << std::endl;
+        return 1;
+    }
+    csv << "case,value,passed\n";
+
+    auto report = [&](const std::string& name, double value, bool ok)
+    {
+        passed = passed && ok;
+        csv << name << "," << value << "," << (ok ? 1 : 0) << "\n";
+        std::cout << "  " << name << std::string(24 - std::min<size_t>(name.size(), 23), ' ')
+                  << value << "  " << (ok ? "PASSED" : "FAILED") << std::endl;
+    };
+
+    // ---- SpscRing bulk: odd-sized pushes / pops across many wraps, all-or-nothing when full ----
+    {
+        SpscRing<float, 64> ring;
+        std::vector<float> in(64), out(64);
+        uint32_t written = 0, read = 0;
+        bool ordered = true;
+        for (int round = 0; round < 200; ++round)
+        {
+            const size_t n = 1 + static_cast<size_t>(round * 7 % 23);
+            for (size_t i = 0; i < n; ++i)
+                in[i] = static_cast<float>(written + i);
+            if (ring.pushN(in.data(), n))
+                written += static_cast<uint32_t>(n);
+            const size_t got = ring.popN(out.data(), 1 + static_cast<size_t>(round * 5 % 17));
+            for (size_t i = 0; i < got; ++i)
+                ordered = ordered && out[i] == static_cast<float>(read++);
+        }
+        for (size_t got; (got = ring.popN(out.data(), 64)) > 0;)
+            for (size_t i = 0; i < got; ++i)
+                ordered = ordered && out[i] == static_cast<float>(read++);
+        report("ring_bulk_ordered", static_cast<double>(read), ordered && read == written && written > 1000);
+
+        // 60 in, then 5 more doesn't fit and must leave the ring untouched
+        const bool fits    = ring.pushN(in.data(), 60);
+        const bool refused = !ring.pushN(in.data(), 5);
+        const size_t left  = ring.popN(out.data(), 64);
+        report("ring_bulk_all_or_none", static_cast<double>(left), fits && refused && left == 60);
+    }
+
+    // ---- a sine lands in its band at about its level, at 48 and 96 kHz ----
+    for (const double sr : { 48000.0, 96000.0 })
+    {
+        auto analyzer = std::make_unique<SpectrumAnalyzer>();
+        analyzer->prepare(sr);
+        int64_t phase = 0;
+        pushSine(*analyzer, 1000.0, sr, 0.5f, SpectrumAnalyzer::kFftSize * 2, true, phase);
+        const bool ran = analyzer->analyse();
+
+        SpectrumAnalyzer::Bands bands {};
+        const bool got = analyzer->readSpectrum(bands);
+        const int band = loudestBand(bands);
+
+        // the band's centre within one band width of 1 kHz; -6 dB minus at
+        // most the Hann scalloping loss (1.42 dB); 10 kHz far down
+        const float top   = std::min(SpectrumAnalyzer::kMaxHz, 0.5f * static_cast<float>(sr));
+        const float ratio = std::pow(top / SpectrumAnalyzer::kMinHz, 1.0f / SpectrumAnalyzer::kNumBands);
+        const float centre = SpectrumAnalyzer::bandCentreHz(band, sr);
+        int far = 0;
+        while (SpectrumAnalyzer::bandCentreHz(far, sr) < 10000.0f)
+            ++far;
+        const std::string rate = std::to_string(static_cast<int>(sr / 1000.0));
+        report("sine_band_hz_" + rate, centre, ran && got && centre > 1000.0f / ratio && centre < 1000.0f * ratio);
+        report("sine_level_db_" + rate, bands[static_cast<size_t>(band)],
+               bands[static_cast<size_t>(band)] > -6.03f - 1.5f && bands[static_cast<size_t>(band)] < -6.03f + 0.1f);
+        report("sine_10k_db_" + rate, bands[static_cast<size_t>(far)], bands[static_cast<size_t>(far)] < -60.0f);
+
+        // nothing new to read until the next frame
+        report("read_only_new_" + rate, 0.0, !analyzer->readSpectrum(bands));
+    }
+
+    // ---- mono push, release, and push / analyse under RtGuard (0 where it is unsupported) ----
+    {
+        auto analyzer = std::make_unique<SpectrumAnalyzer>();
+        analyzer->prepare(48000.0);
+        int64_t phase = 0;
+        std::vector<float> block(256, 0.25f);
+
+        const uint64_t before = RtGuard::violations();
+        {
+            const RtGuard::ScopedRealtime rt;
+            for (int i = 0; i < 64; ++i)
+                analyzer->push(block.data(), nullptr, 256);
+        }
+        const uint64_t pushViolations = RtGuard::violations() - before;
+        report("push_rt_violations", static_cast<double>(pushViolations), pushViolations == 0);
+
+        pushSine(*analyzer, 440.0, 48000.0, 1.0f, SpectrumAnalyzer::kFftSize, false, phase);
+        const uint64_t beforeAnalyse = RtGuard::violations();
+        {
+            const RtGuard::ScopedRealtime rt;
+            analyzer->analyse();
+        }
+        const uint64_t analyseViolations = RtGuard::violations() - beforeAnalyse;
+        report("analyse_rt_violations", static_cast<double>(analyseViolations), analyseViolations == 0);
+
+        SpectrumAnalyzer::Bands bands {};
+        analyzer->readSpectrum(bands);
+        const int band = loudestBand(bands);
+        const float start = bands[static_cast<size_t>(band)];
+        report("mono_sine_db", start, start > -1.5f && start < 0.1f);
+
+        // silence: no new samples, so every frame releases kReleaseMs-style
+        bool falling = true;
+        float level = start;
+        for (int frame = 0; frame < SpectrumAnalyzer::kFramesPerSecond * SpectrumAnalyzer::kReleaseMs / 1000; ++frame)
+        {
+            falling = falling && !analyzer->analyse();
+            analyzer->readSpectrum(bands);
+            falling = falling && bands[static_cast<size_t>(band)] < level;
+            level = bands[static_cast<size_t>(band)];
+        }
+        // one time constant covers 1 - 1/e of the way to the floor
+        const float expected = SpectrumAnalyzer::kFloorDb + (start - SpectrumAnalyzer::kFloorDb) / static_cast<float>(M_E);
+        report("release_after_tau_db", level, falling && std::abs(level - expected) < 1.0f);
+
+        // a full FIFO drops whole blocks and keeps working
+        for (size_t i = 0; i < 2 * SpectrumAnalyzer::kFifoSize / 256; ++i)
+            analyzer->push(block.data(), nullptr, 256);
+        report("overflow_recovers", 0.0, analyzer->analyse());
+    }
+
+    // ---- the analysis thread: frames arrive at the frame rate, load reported ----
+    {
+        auto analyzer = std::make_unique<SpectrumAnalyzer>();
+        analyzer->prepare(48000.0);
+        analyzer->start();
+        analyzer->start();                                  // idempotent
+
+        int64_t phase = 0;
+        int frames = 0;
+        SpectrumAnalyzer::Bands bands {};
+        const auto begin = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - begin < std::chrono::milliseconds(1500))
+        {
+            pushSine(*analyzer, 2000.0, 48000.0, 0.5f, 512, true, phase);
+            frames += analyzer->readSpectrum(bands) ? 1 : 0;
+            std::this_thread::sleep_for(std::chrono::microseconds(10667));
+        }
+        const float load = analyzer->getLoad();
+        const bool running = analyzer->isRunning();
+        analyzer->stop();
+
+        const float centre = SpectrumAnalyzer::bandCentreHz(loudestBand(bands), 48000.0);
+        report("thread_frames", frames, running && frames >= SpectrumAnalyzer::kFramesPerSecond && !analyzer->isRunning());
+        report("thread_sine_hz", centre, centre > 1800.0f && centre < 2200.0f);
+        report("thread_load", load, load > 0.0f && load < 0.5f);
+    }
+
+    csv.close();
+
+    std::cout << (passed ? "All spectrum analyzer tests PASSED." : "Some spectrum analyzer tests FAILED.") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -1,7 +1,7 @@
 #!/usr/bin/env python3
 """Chronos DelayEngine functional test dashboard.
 
-Reads the seven CSVs produced by delay_functional_test and renders a
+Reads the CSVs produced by delay_functional_test and renders a
 single-page dashboard with per-test pass/fail indicators and detailed
 evidence for each case.
 
@@ -14,6 +14,8 @@ CSVs expected (under tests/simd_harness/logs):
   func_mode_switch.csv
   func_reset.csv
   func_streaming.csv
+  func_modulation.csv
+  func_events.csv
   func_summary.csv
 
 Output:
@@ -269,6 +271,73 @@ def panel_streaming(ax, df):
     status_label(ax, ok)
 
 
+def panel_modulation(ax, df):
+    labels = [r.shape + "\n" + ("sync" if r.synced else "free") + f" {r.depth_ms:g}ms" for r in df.itertuples()]
+    xs = np.arange(len(df))
+    colors = [PASS_COLOR if int(p) == 1 else FAIL_COLOR for p in df["passed"]]
+    ax.bar(xs, np.maximum(df["max_diff_vs_static"], 1e-9),
+           color=colors, edgecolor="black", linewidth=0.5)
+    ax.set_xticks(xs)
+    ax.set_xticklabels(labels, fontsize=7)
+    ax.set_yscale("log")
+    ax.set_ylim(bottom=1e-9)
+    ax.set_ylabel("max |out - unmodulated|")
+    ax.set_title("[8] LFO modulation (0 ms must be bit-identical)", fontsize=11)
+    ax.grid(True, axis="y", alpha=0.3)
+    status_label(ax, bool((df["passed"] == 1).all()))
+
+
+def panel_events(ax, df):
+    labels = [("event @" if r.case == "split" else "512 vs 0\n@") + f"{int(r.offset)}" for r in df.itertuples()]
+    xs = np.arange(len(df))
+    colors = [PASS_COLOR if int(p) == 1 else FAIL_COLOR for p in df["passed"]]
+    ax.bar(xs, np.maximum(df["max_diff_vs_split"], 1e-9),
+           color=colors, edgecolor="black", linewidth=0.5)
+    ax.set_xticks(xs)
+    ax.set_xticklabels(labels, fontsize=8)
+    ax.set_yscale("log")
+    ax.set_ylim(bottom=1e-9)
+    ax.set_ylabel("max |events - split render|")
+    ax.set_title("[9] Sample-accurate events (must match a quad-aligned split)", fontsize=11)
+    ax.grid(True, axis="y", alpha=0.3)
+    status_label(ax, bool((df["passed"] == 1).all()))
+
+
+def panel_cross_ramp(ax, df):
+    xs = np.arange(len(df))
+    w = 0.38
+    ax.bar(xs - w / 2, df["kink_instant"], w, color="#868e96",
+           edgecolor="black", linewidth=0.5, label="instant (one block)")
+    ax.bar(xs + w / 2, df["kink_cross_ramp"], w, color="#1c7ed6",
+           edgecolor="black", linewidth=0.5, label="cross-ramp 50 ms")
+    ax.set_xticks(xs)
+    ax.set_xticklabels(df["case"], fontsize=9)
+    ax.set_yscale("log")
+    ax.set_ylabel("max 2nd difference around the switch")
+    ax.set_title("[10] Preset cross-ramp (lower = smoother switch)", fontsize=11)
+    ax.legend(fontsize=8, loc="upper left")
+    ax.grid(True, axis="y", alpha=0.3)
+    status_label(ax, bool((df["passed"] == 1).all()))
+
+
+def panel_jump_mode(ax, df):
+    labels = {"steady_vs_glide": "steady:\njump vs glide",
+              "period_error_glide": "glide:\nperiod error",
+              "period_error_jump": "jump:\nperiod error",
+              "after_fade_vs_new_tap": "after fade:\nvs 250 ms tap"}
+    xs = np.arange(len(df))
+    colors = [PASS_COLOR if int(p) == 1 else FAIL_COLOR for p in df["passed"]]
+    colors = ["#868e96" if c == "period_error_glide" else col for c, col in zip(df["case"], colors)]
+    ax.bar(xs, np.maximum(df["value"], 1e-9), color=colors, edgecolor="black", linewidth=0.5)
+    ax.set_xticks(xs)
+    ax.set_xticklabels([labels.get(c, c) for c in df["case"]], fontsize=8)
+    ax.set_yscale("log")
+    ax.set_ylabel("max |diff| (samples for period error)")
+    ax.set_title("[11] Jump delay-time mode (100 -> 250 ms, 20 ms fade)", fontsize=11)
+    ax.grid(True, axis="y", alpha=0.3)
+    status_label(ax, bool((df["passed"] == 1).all()))
+
+
 # -------------- main ------------------------------------------------------
 def main():
     summary     = must_read("func_summary.csv")
@@ -280,11 +349,15 @@ def main():
     mode_sw     = must_read("func_mode_switch.csv")
     reset       = must_read("func_reset.csv")
     streaming   = must_read("func_streaming.csv")
+    modulation  = must_read("func_modulation.csv")
+    events      = must_read("func_events.csv")
+    cross_ramp  = must_read("func_cross_ramp.csv")
+    jump_mode   = must_read("func_jump_mode.csv")
 
-    fig = plt.figure(figsize=(18, 22))
+    fig = plt.figure(figsize=(18, 28))
     gs = gridspec.GridSpec(
-        nrows=6, ncols=2, figure=fig,
-        height_ratios=[0.6, 1.1, 1.3, 1.3, 1.3, 0.7],
+        nrows=8, ncols=2, figure=fig,
+        height_ratios=[0.6, 1.1, 1.3, 1.3, 1.3, 1.1, 1.0, 1.0],
         hspace=0.50, wspace=0.22,
         left=0.06, right=0.96, top=0.97, bottom=0.04)
 
@@ -307,8 +380,16 @@ def main():
     panel_mode_switch(fig.add_subplot(gs[4, 0]), mode_sw)
     panel_reset(fig.add_subplot(gs[4, 1]), reset)
 
-    # Row 5: streaming (spans)
-    panel_streaming(fig.add_subplot(gs[5, :]), streaming)
+    # Row 5: streaming | modulation
+    panel_streaming(fig.add_subplot(gs[5, 0]), streaming)
+    panel_modulation(fig.add_subplot(gs[5, 1]), modulation)
+
+    # Row 6: sample-accurate events | preset cross-ramp
+    panel_events(fig.add_subplot(gs[6, 0]), events)
+    panel_cross_ramp(fig.add_subplot(gs[6, 1]), cross_ramp)
+
+    # Row 7: jump delay-time mode (spans)
+    panel_jump_mode(fig.add_subplot(gs[7, :]), jump_mode)
 
     fig.savefig(OUT_PATH, dpi=140)
     plt.close(fig)
@@ -17,7 +17,7 @@ def plot_trig_test(csv_path):
     
     fig, (ax1, ax2) = plt.subplots(2, 1, figsize=(12, 10), gridspec_kw={'height_ratios': [2, 1]})
     
-    if 'std_sin' in df.columns or 'std_cos' in df.columns or 'std_tan' in df.columns or 'std_tanh' in df.columns:
+    if any(c.startswith('std_') for c in df.columns):
         std_col = [c for c in df.columns if c.startswith('std_')][0]
         ax1.plot(df[x_col], df[std_col], label='Standard (Ref)', color='black', alpha=0.5, linewidth=2)
         